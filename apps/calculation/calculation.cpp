@@ -216,17 +216,20 @@ Calculation::EqualSign Calculation::exactAndApproximateDisplayedOutputsAreEqual(
    * We can safely use an exception checkpoint here because we are sure of not
    * modifying any pre-existing node in the pool. We are sure there cannot be a
    * Store in the exactOutput. */
+  char * treePoolCursor = TreePool::sharedPool()->cursor();
   Poincare::ExceptionCheckpoint ecp;
   if (ExceptionRun(ecp)) {
     Expression exactOutputExpression = exactOutput();
     if (input().recursivelyMatches(Expression::IsPercent, context)) {
       /* When the input contains percent, the exact expression is not fully
        * reduced so we need to reduce it again prior to computing equal sign */
-      PoincareHelpers::CloneAndSimplify(&exactOutputExpression, context, Poincare::ReductionTarget::User, SymbolicComputation::ReplaceAllSymbolsWithDefinitionsOrUndefined);
+      PoincareHelpers::CloneAndSimplifyWithReductionCache(&exactOutputExpression, context, Poincare::ReductionTarget::User, SymbolicComputation::ReplaceAllSymbolsWithDefinitionsOrUndefined);
     }
     m_equalSign = Expression::ExactAndApproximateExpressionsAreEqual(exactOutputExpression, approximateOutput(NumberOfSignificantDigits::UserDefined)) ? EqualSign::Equal : EqualSign::Approximation;
     return m_equalSign;
   } else {
+    // Forget the reductions cached before the rollback
+    context->tidyDownstreamPoolFrom(treePoolCursor);
     /* Do not override m_equalSign in case there is enough room in the pool
      * later to compute it. */
     return EqualSign::Approximation;
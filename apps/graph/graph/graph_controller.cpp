@@ -64,6 +64,12 @@ template <typename T> static Coordinate2D<T> evaluatorSecondCurve(T t, const voi
   const ContinuousFunction * f = static_cast<const ContinuousFunction *>(model);
   return f->evaluateXYAtParameter(t, context, 1);
 }
+static void valuesEvaluator(const float * t, float * values, int n, const void * model, Context * context) {
+  static_cast<const ContinuousFunction *>(model)->evaluateValuesAtParameters(t, values, n, context);
+}
+static void valuesEvaluatorSecondCurve(const float * t, float * values, int n, const void * model, Context * context) {
+  static_cast<const ContinuousFunction *>(model)->evaluateValuesAtParameters(t, values, n, context, 1);
+}
 template <typename T, int coordinate> static Coordinate2D<T> parametricExpressionEvaluator(T t, const void * model, Context * context) {
   const Expression * e = static_cast<const Expression *>(model);
   assert(e->numberOfChildren() == 2);
@@ -181,9 +187,9 @@ Range2D GraphController::optimalRange(bool computeX, bool computeY, Range2D orig
         continue;
       }
       bool alongY = f->isAlongY();
-      zoom.fitMagnitude(evaluator, f.operator->(), alongY);
+      zoom.fitMagnitude(evaluator, f.operator->(), alongY, valuesEvaluator);
       if (f->numberOfSubCurves() > 1) {
-        zoom.fitMagnitude(evaluatorSecondCurve, f.operator->(), alongY);
+        zoom.fitMagnitude(evaluatorSecondCurve, f.operator->(), alongY, valuesEvaluatorSecondCurve);
       }
     }
   }
@@ -128,6 +128,9 @@ static Coordinate2D<T> evaluateXY(T t, void * model, void * context) { return re
 template<typename T>
 static Coordinate2D<T> evaluateXYSecondCurve(T t, void * model, void * context) { return reinterpret_cast<ContinuousFunction *>(model)->evaluateXYAtParameter(t, reinterpret_cast<Context *>(context), 1); }
 
+template<int CurveIndex>
+static bool enclosureXY(float t1, float t2, void * model, void * context, Coordinate2D<float> * lowerBound, Coordinate2D<float> * upperBound, bool * isContinuous) { return reinterpret_cast<ContinuousFunction *>(model)->enclosureBetweenParameters(t1, t2, reinterpret_cast<Context *>(context), lowerBound, upperBound, isContinuous, CurveIndex); }
+
 static Coordinate2D<float> evaluateInfinity(float t, void *, void *) { return Coordinate2D<float>(INFINITY, INFINITY); }
 static Coordinate2D<float> evaluateMinusInfinity(float t, void *, void *) { return Coordinate2D<float>(-INFINITY, -INFINITY); }
 static Coordinate2D<float> evaluateZero(float t, void *, void *) { return Coordinate2D<float>(t, 0.f); }
@@ -188,14 +191,14 @@ void GraphView::drawCartesian(KDContext * ctx, KDRect rect, ContinuousFunction *
 
   // - Draw first curve
   CurveDrawing firstCurve(Curve2D(evaluateXY<float>, f), context(), tStart, tEnd, tStep, f->color(), true, f->properties().plotIsDotted());
-  firstCurve.setPrecisionOptions(true, evaluateXY<double>, discontinuity);
+  firstCurve.setPrecisionOptions(true, evaluateXY<double>, discontinuity, enclosureXY<0>);
   firstCurve.setPatternOptions(pattern, patternStart, patternEnd, patternLower, patternUpper, patternWithoutCurve, axis);
   firstCurve.draw(this, ctx, rect);
 
   // - Draw second curve
   if (hasTwoCurves) {
     CurveDrawing secondCurve(Curve2D(evaluateXYSecondCurve<float>, f), context(), tStart, tEnd, tStep, f->color(), true, f->properties().plotIsDotted());
-    secondCurve.setPrecisionOptions(true, evaluateXYSecondCurve<double>, discontinuity);
+    secondCurve.setPrecisionOptions(true, evaluateXYSecondCurve<double>, discontinuity, enclosureXY<1>);
     secondCurve.setPatternOptions(pattern, patternStart, patternEnd, patternLower2, Curve2D(), patternWithoutCurve, axis);
     secondCurve.draw(this, ctx, rect);
   }
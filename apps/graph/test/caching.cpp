@@ -116,6 +116,8 @@ QUIZ_CASE(graph_caching) {
   assert_cache_stays_valid("f(x)=1/x");
   assert_cache_stays_valid("f(x)=1/x", -5e-5f, 5e-5f);
   assert_cache_stays_valid("f(x)=-e^x");
+  assert_cache_stays_valid("f(x)=int(e^(-t^2),t,0,x)");
+  assert_cache_stays_valid("f(x)=int(1/t,t,1,x)", 0.5f, 20.f);
 
   assert_cache_stays_valid("r=1", 0.f, 360.f);
   assert_cache_stays_valid("r=θ", 0.f, 360.f);
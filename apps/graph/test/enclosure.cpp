@@ -0,0 +1,50 @@
+#include <quiz.h>
+#include "helper.h"
+#include <apps/shared/global_context.h>
+
+using namespace Poincare;
+using namespace Shared;
+
+namespace Graph {
+
+void assert_enclosure_is(const char * definition, float t1, float t2, bool isContinuous, Coordinate2D<float> expectedLowerBound = Coordinate2D<float>(), Coordinate2D<float> expectedUpperBound = Coordinate2D<float>()) {
+  GlobalContext globalContext;
+  ContinuousFunctionStore functionStore;
+  ContinuousFunction * function = addFunction(definition, &functionStore, &globalContext);
+  Coordinate2D<float> lowerBound, upperBound;
+  bool enclosureIsContinuous;
+  quiz_assert_print_if_failure(function->enclosureBetweenParameters(t1, t2, &globalContext, &lowerBound, &upperBound, &enclosureIsContinuous), definition);
+  quiz_assert_print_if_failure(enclosureIsContinuous == isContinuous, definition);
+  quiz_assert_print_if_failure(function->isDiscontinuousBetweenFloatValues(t1, t2, &globalContext) == !isContinuous, definition);
+  if (isContinuous) {
+    quiz_assert_print_if_failure(lowerBound.x1() == expectedLowerBound.x1() && lowerBound.x2() == expectedLowerBound.x2(), definition);
+    quiz_assert_print_if_failure(upperBound.x1() == expectedUpperBound.x1() && upperBound.x2() == expectedUpperBound.x2(), definition);
+  }
+  functionStore.removeAll();
+}
+
+QUIZ_CASE(graph_enclosure) {
+  // Only the real complex format is enclosed
+  Preferences::ComplexFormat previousComplexFormat = Preferences::sharedPreferences()->complexFormat();
+  Preferences::sharedPreferences()->setComplexFormat(Preferences::ComplexFormat::Real);
+  assert_enclosure_is("f(x)=x^2", 1.f, 2.f, true, Coordinate2D<float>(1.f, 1.f), Coordinate2D<float>(2.f, 4.f));
+  assert_enclosure_is("f(x)=floor(x)", 1.25f, 1.75f, true, Coordinate2D<float>(1.25f, 1.f), Coordinate2D<float>(1.75f, 1.f));
+  // Vertical curves are enclosed along y
+  assert_enclosure_is("x=y^3", 1.f, 2.f, true, Coordinate2D<float>(1.f, 1.f), Coordinate2D<float>(8.f, 2.f));
+  // Jumps and asymptotes
+  assert_enclosure_is("f(x)=floor(x)", 0.5f, 1.5f, false);
+  assert_enclosure_is("f(x)=1/x", -1.f, 1.f, false);
+
+  // Parametric curves are not enclosed
+  GlobalContext globalContext;
+  ContinuousFunctionStore functionStore;
+  ContinuousFunction * function = addFunction("f(t)=[[t][t^2]]", &functionStore, &globalContext);
+  Coordinate2D<float> lowerBound, upperBound;
+  bool isContinuous;
+  quiz_assert(!function->enclosureBetweenParameters(1.f, 2.f, &globalContext, &lowerBound, &upperBound, &isContinuous));
+  functionStore.removeAll();
+
+  Preferences::sharedPreferences()->setComplexFormat(previousComplexFormat);
+}
+
+}
@@ -1,6 +1,8 @@
 #include "apps_container.h"
 #include "global_preferences.h"
 #include <poincare/init.h>
+#include <poincare/reduction_profiler.h>
+#include <poincare/tree_pool.h>
 
 #define DUMMY_MAIN 0
 #if DUMMY_MAIN
@@ -37,6 +39,10 @@ void ion_main(int argc, const char * const argv[]) {
   // Initialize Poincare::TreePool::sharedPool
   Poincare::Init();
 
+#if POINCARE_TREE_POOL_STATISTICS
+  bool logPoolStatistics = false;
+#endif
+
 #if EPSILON_GETOPT
   for (int i=1; i<argc; i++) {
     if (argv[i][0] != '-' || argv[i][1] != '-') {
@@ -80,6 +86,26 @@ void ion_main(int argc, const char * const argv[]) {
       continue;
     }
 
+#if POINCARE_REDUCTION_PROFILER
+    /* Option to print the reduction profile on exit:
+     * $ ./epsilon.elf --reduction-profile
+     */
+    if (strcmp(argv[i], "--reduction-profile") == 0) {
+      Poincare::ReductionProfiler::Start();
+      continue;
+    }
+#endif
+
+#if POINCARE_TREE_POOL_STATISTICS
+    /* Option to print the pool statistics on exit:
+     * $ ./epsilon.elf --pool-statistics
+     */
+    if (strcmp(argv[i], "--pool-statistics") == 0) {
+      logPoolStatistics = true;
+      continue;
+    }
+#endif
+
     /* Option should be given at run-time:
      * $ ./epsilon.elf --[app_name]-[option] [arguments]
      * For example:
@@ -105,6 +131,17 @@ void ion_main(int argc, const char * const argv[]) {
   Ion::setStackStart((void *)(&stackTop));
 
   AppsContainer::sharedAppsContainer()->run();
+
+#if POINCARE_REDUCTION_PROFILER
+  if (Poincare::ReductionProfiler::IsRunning()) {
+    Poincare::ReductionProfiler::Log();
+  }
+#endif
+#if POINCARE_TREE_POOL_STATISTICS
+  if (logPoolStatistics) {
+    Poincare::TreePool::sharedPool()->logStatistics();
+  }
+#endif
 }
 
 #endif
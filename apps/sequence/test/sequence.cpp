@@ -548,6 +548,44 @@ QUIZ_CASE(sequence_order) {
   store->tidyDownstreamPoolFrom();
 }
 
+void check_sequence_values_at_ranks(Sequence::Type type, const char * definition, const char * condition1, int numberOfRanks, const int * ranks, const double * results) {
+  Shared::GlobalContext globalContext;
+  SequenceStore * store = globalContext.sequenceStore();
+  SequenceContext * sequenceContext = globalContext.sequenceContext();
+
+  Sequence * seq = addSequence(store, type, definition, condition1, nullptr, sequenceContext);
+  for (int i = 0; i < numberOfRanks; i++) {
+    double un = seq->evaluateXYAtParameter(static_cast<double>(ranks[i]), sequenceContext).x2();
+    assert_roughly_equal(un, results[i], Poincare::Float<double>::Epsilon(), true);
+  }
+
+  store->removeAll();
+  store->tidyDownstreamPoolFrom(); // Cf comment above
+}
+
+QUIZ_CASE(sequence_evaluation_at_large_ranks) {
+  // Going back steps from the last checkpoint
+  constexpr int k_numberOfRanks = 5;
+  const int ranks[k_numberOfRanks] = {1500, 700, 1499, 2, 1500};
+  const double sums[k_numberOfRanks] = {1124250., 244650., 1122751., 1., 1124250.};
+  check_sequence_values_at_ranks(Sequence::Type::SingleRecurrence, "u(n)+n", "0", k_numberOfRanks, ranks, sums);
+  // Affine recurrences are computed in closed form
+  const double arithmetic[k_numberOfRanks] = {4501., 2101., 4498., 7., 4501.};
+  check_sequence_values_at_ranks(Sequence::Type::SingleRecurrence, "u(n)+3", "1", k_numberOfRanks, ranks, arithmetic);
+  const int geometricRanks[3] = {30, 5, 0};
+  const double geometric[3] = {1073741824., -32., 1.};
+  check_sequence_values_at_ranks(Sequence::Type::SingleRecurrence, "-2u(n)", "1", 3, geometricRanks, geometric);
+  const int largeRanks[3] = {1, 0, 9999};
+  const double affine[3] = {1., 0., 2.};
+  check_sequence_values_at_ranks(Sequence::Type::SingleRecurrence, "u(n)/2+1", "0", 3, largeRanks, affine);
+  // Stepping and the closed form both stop at k_maxRecurrentRank
+  const int boundaryRanks[2] = {10000, 9999};
+  const double boundarySums[2] = {NAN, 49985001.};
+  check_sequence_values_at_ranks(Sequence::Type::SingleRecurrence, "u(n)+n", "0", 2, boundaryRanks, boundarySums);
+  const double boundaryArithmetic[2] = {NAN, 29998.};
+  check_sequence_values_at_ranks(Sequence::Type::SingleRecurrence, "u(n)+3", "1", 2, boundaryRanks, boundaryArithmetic);
+}
+
 QUIZ_CASE(sequence_sum_evaluation) {
   check_sum_of_sequence_between_bounds(33.0, 3.0, 8.0, Sequence::Type::Explicit, "n", nullptr, nullptr);
   check_sum_of_sequence_between_bounds(70.0, 2.0, 8.0, Sequence::Type::SingleRecurrence, "u(n)+2", "0", nullptr);
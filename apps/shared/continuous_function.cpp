@@ -144,6 +144,11 @@ bool ContinuousFunction::isNamed() const {
 }
 
 bool ContinuousFunction::isDiscontinuousBetweenFloatValues(float x1, float x2, Poincare::Context * context) const {
+  Coordinate2D<float> lowerBound, upperBound;
+  bool isContinuous;
+  if (numberOfSubCurves() == 1 && enclosureBetweenParameters(std::min(x1, x2), std::max(x1, x2), context, &lowerBound, &upperBound, &isContinuous)) {
+    return !isContinuous;
+  }
   Expression equation = expressionReduced(context);
   return equation.isDiscontinuousBetweenValuesForSymbol(k_unknownName, x1, x2, context, complexFormat(context), Poincare::Preferences::sharedPreferences()->angleUnit());
 }
@@ -327,6 +332,7 @@ Coordinate2D<T> ContinuousFunction::templatedApproximateAtParameter(T t, Context
   }
   Expression e = expressionReduced(context);
   Preferences preferences = Preferences::ClonePreferencesWithNewComplexFormat(complexFormat(context));
+  const CompiledExpression * compiledExpression = m_model.compiledExpressionReduced(this, context, preferences.complexFormat(), preferences.angleUnit());
   if (!properties().isParametric()) {
     if (numberOfSubCurves() >= 2) {
       assert(e.numberOfChildren() > subCurveIndex);
@@ -334,11 +340,12 @@ Coordinate2D<T> ContinuousFunction::templatedApproximateAtParameter(T t, Context
     } else {
       assert(subCurveIndex == 0);
     }
+    T value = compiledExpression ? compiledExpression->approximateWithValue(t, subCurveIndex) : PoincareHelpers::ApproximateWithValueForSymbol(e, k_unknownName, t, context, &preferences, false);
     if (isAlongY()) {
       // Invert x and y with vertical lines so it can be scrolled vertically
-      return Coordinate2D<T>(PoincareHelpers::ApproximateWithValueForSymbol(e, k_unknownName, t, context, &preferences, false), t);
+      return Coordinate2D<T>(value, t);
     }
-    return Coordinate2D<T>(t, PoincareHelpers::ApproximateWithValueForSymbol(e, k_unknownName, t, context, &preferences, false));
+    return Coordinate2D<T>(t, value);
   }
   if (e.type() == ExpressionNode::Type::Dependency) {
     e = e.childAtIndex(0);
@@ -350,16 +357,83 @@ Coordinate2D<T> ContinuousFunction::templatedApproximateAtParameter(T t, Context
   assert(e.type() == ExpressionNode::Type::Matrix);
   assert(static_cast<Matrix&>(e).numberOfRows() == 2);
   assert(static_cast<Matrix&>(e).numberOfColumns() == 1);
+  if (compiledExpression) {
+    return Coordinate2D<T>(compiledExpression->approximateWithValue(t, 0), compiledExpression->approximateWithValue(t, 1));
+  }
   return Coordinate2D<T>(
       PoincareHelpers::ApproximateWithValueForSymbol(e.childAtIndex(0), k_unknownName, t, context, &preferences, false),
       PoincareHelpers::ApproximateWithValueForSymbol(e.childAtIndex(1), k_unknownName, t, context, &preferences, false));
 }
 
+void ContinuousFunction::evaluateValuesAtParameters(const float * ts, float * values, int n, Context * context, int curveIndex, float previousT, float previousValue) const {
+  assert(properties().isCartesian());
+  Preferences preferences = Preferences::ClonePreferencesWithNewComplexFormat(complexFormat(context));
+  const CompiledExpression * compiledExpression = m_model.compiledExpressionReduced(this, context, preferences.complexFormat(), preferences.angleUnit());
+  if (compiledExpression) {
+    compiledExpression->approximateBatch(ts, values, n, curveIndex);
+  } else {
+    Expression e = expressionReduced(context);
+    if (isAlongY() || numberOfSubCurves() > 1 || e.type() != ExpressionNode::Type::Integral || !static_cast<Integral &>(e).isAntiderivative(k_unknownName, context)) {
+      for (int i = 0; i < n; i++) {
+        Coordinate2D<float> xy = templatedApproximateAtParameter(ts[i], context, curveIndex);
+        values[i] = isAlongY() ? xy.x1() : xy.x2();
+      }
+      return;
+    }
+    /* The integral from a to ts[i] is the one to ts[i-1] plus the integral
+     * between ts[i-1] and ts[i]: curves are drawn from left to right, so this
+     * only integrates on one pixel per value. */
+    assert(curveIndex == 0);
+    double upperBounds[CompiledExpression::k_batchSize];
+    double integrals[CompiledExpression::k_batchSize];
+    for (int i = 0; i < n; i += CompiledExpression::k_batchSize) {
+      int batchSize = std::min(n - i, CompiledExpression::k_batchSize);
+      for (int j = 0; j < batchSize; j++) {
+        upperBounds[j] = ts[i + j];
+      }
+      static_cast<Integral &>(e).approximateAtUpperBounds<double>(upperBounds, integrals, batchSize, ApproximationContext(context, preferences.complexFormat(), preferences.angleUnit()), previousT, previousValue);
+      for (int j = 0; j < batchSize; j++) {
+        values[i + j] = integrals[j];
+      }
+      previousT = upperBounds[batchSize - 1];
+      previousValue = integrals[batchSize - 1];
+    }
+  }
+  for (int i = 0; i < n; i++) {
+    if (ts[i] < tMin() || ts[i] > tMax()) {
+      values[i] = NAN;
+    }
+  }
+}
+
+bool ContinuousFunction::enclosureBetweenParameters(float t1, float t2, Context * context, Coordinate2D<float> * lowerBound, Coordinate2D<float> * upperBound, bool * isContinuous, int curveIndex) const {
+  assert(t1 <= t2);
+  if (!properties().isCartesian() || t1 < tMin() || t2 > tMax()) {
+    return false;
+  }
+  Preferences preferences = Preferences::ClonePreferencesWithNewComplexFormat(complexFormat(context));
+  const CompiledExpression * compiledExpression = m_model.compiledExpressionReduced(this, context, preferences.complexFormat(), preferences.angleUnit());
+  CompiledExpression::Enclosure<float> enclosure;
+  if (!compiledExpression || !compiledExpression->approximateOnInterval(t1, t2, &enclosure, curveIndex)) {
+    return false;
+  }
+  *isContinuous = enclosure.isContinuous;
+  if (isAlongY()) {
+    *lowerBound = Coordinate2D<float>(enclosure.min, t1);
+    *upperBound = Coordinate2D<float>(enclosure.max, t2);
+  } else {
+    *lowerBound = Coordinate2D<float>(t1, enclosure.min);
+    *upperBound = Coordinate2D<float>(t2, enclosure.max);
+  }
+  return true;
+}
+
 /* ContinuousFunction::Model */
 
 Expression ContinuousFunction::Model::expressionReduced(const Ion::Storage::Record * record, Context * context) const {
   // m_expression might already be memmoized.
   if (m_expression.isUninitialized()) {
+    m_compiledExpression.invalidate();
     // Retrieve the expression equation's expression.
     m_expression = expressionReducedForAnalysis(record, context);
     if (properties().status() != ContinuousFunctionProperties::Status::Enabled) {
@@ -469,6 +543,30 @@ Expression ContinuousFunction::Model::expressionReduced(const Ion::Storage::Reco
   return m_expression;
 }
 
+const CompiledExpression * ContinuousFunction::Model::compiledExpressionReduced(const Ion::Storage::Record * record, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  Expression e = expressionReduced(record, context);
+  if (m_compiledExpression.needsCompilationFor(complexFormat, angleUnit)) {
+    if (properties().isParametric()) {
+      if (e.type() == ExpressionNode::Type::Dependency) {
+        e = e.childAtIndex(0);
+      }
+      if (e.type() == ExpressionNode::Type::Matrix) {
+        Expression coordinates[] = {e.childAtIndex(0), e.childAtIndex(1)};
+        m_compiledExpression.compile(coordinates, 2, k_unknownName, context, complexFormat, angleUnit);
+      } else {
+        m_compiledExpression.compile(nullptr, 0, k_unknownName, context, complexFormat, angleUnit);
+      }
+    } else if (numberOfSubCurves(record) >= 2) {
+      assert(e.numberOfChildren() == 2);
+      Expression subCurves[] = {e.childAtIndex(0), e.childAtIndex(1)};
+      m_compiledExpression.compile(subCurves, 2, k_unknownName, context, complexFormat, angleUnit);
+    } else {
+      m_compiledExpression.compile(e, k_unknownName, context, complexFormat, angleUnit);
+    }
+  }
+  return m_compiledExpression.isCompiled() ? &m_compiledExpression : nullptr;
+}
+
 Poincare::Expression ContinuousFunction::Model::expressionReducedForAnalysis(const Ion::Storage::Record * record, Poincare::Context * context) const {
   ContinuousFunctionProperties::SymbolType computedFunctionSymbol = ContinuousFunctionProperties::k_defaultSymbolType;
   ComparisonNode::OperatorType computedEquationType = ContinuousFunctionProperties::k_defaultEquationType;
@@ -15,6 +15,7 @@
 #include "packed_range_1D.h"
 #include <apps/apps_container_helper.h>
 #include <apps/i18n.h>
+#include <poincare/compiled_expression.h>
 #include <poincare/conic.h>
 #include <poincare/comparison.h>
 #include <poincare/preferences.h>
@@ -100,6 +101,16 @@ public:
   Poincare::Coordinate2D<double> evaluateXYAtParameter(double t, Poincare::Context * context, int curveIndex = 0) const override {
     return privateEvaluateXYAtParameter<double>(t, context, curveIndex);
   }
+  /* Set values[i] to the value of a cartesian function at ts[i] for i < n,
+   * approximating all the values together. The cache is not used, but the
+   * value at previousT may be provided: functions defined by an integral up
+   * to x are then integrated from it instead of from their lower bound. */
+  void evaluateValuesAtParameters(const float * ts, float * values, int n, Poincare::Context * context, int curveIndex = 0, float previousT = NAN, float previousValue = NAN) const;
+  /* Set lowerBound and upperBound to the corners of a box enclosing the curve
+   * of a cartesian function for parameters between t1 and t2, using interval
+   * arithmetic. Return false if the curve cannot be enclosed and must be
+   * evaluated point by point instead. */
+  bool enclosureBetweenParameters(float t1, float t2, Poincare::Context * context, Poincare::Coordinate2D<float> * lowerBound, Poincare::Coordinate2D<float> * upperBound, bool * isContinuous, int curveIndex = 0) const;
 
   double evaluateCurveParameter(int index, double cursorT, double cursorX, double cursorY, Poincare::Context * context) const;
 
@@ -230,6 +241,8 @@ private:
     Poincare::Expression expressionEquation(const Ion::Storage::Record * record, Poincare::Context * context, Poincare::ComparisonNode::OperatorType * computedEquationType = nullptr, ContinuousFunctionProperties::SymbolType * computedFunctionSymbol = nullptr, bool * isCartesianEquation = nullptr) const;
     // Return the derivative of the expression to plot.
     Poincare::Expression expressionDerivateReduced(const Ion::Storage::Record * record, Poincare::Context * context) const;
+    // Return the compiled expression to plot, or nullptr if it cannot be compiled
+    const Poincare::CompiledExpression * compiledExpressionReduced(const Ion::Storage::Record * record, Poincare::Context * context, Poincare::Preferences::ComplexFormat complexFormat, Poincare::Preferences::AngleUnit angleUnit) const;
     // Rename the record if needed. Record pointer might get corrupted.
     Ion::Storage::Record::ErrorStatus renameRecordIfNeeded(Ion::Storage::Record * record, Poincare::Context * context) const;
     // Build the expression from text, handling f(x)=... cartesian equations
@@ -249,6 +262,8 @@ private:
     size_t expressionSize(const Ion::Storage::Record * record) const override;
     mutable ContinuousFunctionProperties m_properties;
     mutable Poincare::Expression m_expressionDerivate;
+    // Invalidated whenever m_expression is recomputed
+    mutable Poincare::CompiledExpression m_compiledExpression;
   };
 
   // Return model pointer
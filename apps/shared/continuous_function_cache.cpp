@@ -121,7 +121,7 @@ Poincare::Coordinate2D<float> ContinuousFunctionCache::valuesAtIndex(const Conti
   assert(curveIndex == 0);
   if (function->properties().isCartesian()) {
     if (IsSignalingNan(m_cache[i])) {
-      m_cache[i] = function->privateEvaluateXYAtParameter(t, context, curveIndex).x2();
+      fillCartesianCacheFromIndex(function, context, t, i);
     }
     return Poincare::Coordinate2D<float>(t, m_cache[i]);
   }
@@ -133,6 +133,32 @@ Poincare::Coordinate2D<float> ContinuousFunctionCache::valuesAtIndex(const Conti
   return Poincare::Coordinate2D<float>(m_cache[2 * i], m_cache[2 * i + 1]);
 }
 
+void ContinuousFunctionCache::fillCartesianCacheFromIndex(const ContinuousFunction * function, Poincare::Context * context, float t, int i) {
+  /* Curves are drawn from left to right: the values following t are likely to
+   * be requested next, so they are approximated together with t. */
+  constexpr int k_batchSize = Poincare::CompiledExpression::k_batchSize;
+  float parameters[k_batchSize];
+  float values[k_batchSize];
+  int parameterIndex = i - m_startOfCache;
+  if (parameterIndex < 0) {
+    parameterIndex += k_sizeOfCache;
+  }
+  parameters[0] = t;
+  int n = 1;
+  while (n < k_batchSize && parameterIndex + n < k_sizeOfCache && IsSignalingNan(m_cache[(i + n) % k_sizeOfCache])) {
+    parameters[n] = m_tMin + (parameterIndex + n) * m_tStep;
+    n++;
+  }
+  /* The value preceding t lets functions such as ∫(f(t),t,0,x) continue the
+   * integration where it stopped. */
+  int previousIndex = (i + k_sizeOfCache - 1) % k_sizeOfCache;
+  bool hasPreviousValue = parameterIndex > 0 && !IsSignalingNan(m_cache[previousIndex]);
+  function->evaluateValuesAtParameters(parameters, values, n, context, 0, hasPreviousValue ? m_tMin + (parameterIndex - 1) * m_tStep : NAN, hasPreviousValue ? m_cache[previousIndex] : NAN);
+  for (int j = 0; j < n; j++) {
+    m_cache[(i + j) % k_sizeOfCache] = values[j];
+  }
+}
+
 void ContinuousFunctionCache::pan(ContinuousFunction * function, float newTMin) {
   assert(function->properties().isCartesian());
   if (newTMin == m_tMin) {
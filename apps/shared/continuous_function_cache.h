@@ -73,6 +73,7 @@ private:
   void setRange(float tMin, float tStep);
   int indexForParameter(const ContinuousFunction * function, float t, int curveIndex) const;
   Poincare::Coordinate2D<float> valuesAtIndex(const ContinuousFunction * function, Poincare::Context * context, float t, int i, int curveIndex);
+  void fillCartesianCacheFromIndex(const ContinuousFunction * function, Poincare::Context * context, float t, int i);
   void pan(ContinuousFunction * function, float newTMin);
 
   float m_tMin, m_tStep;
@@ -3,6 +3,7 @@
 
 #include "function_store.h"
 #include "continuous_function.h"
+#include "intersections_cache.h"
 
 namespace Shared {
 
@@ -47,6 +48,7 @@ public:
   }
   KDColor colorForRecord(Ion::Storage::Record record) const override { return modelForRecord(record)->color(); }
   ContinuousFunctionCache * cacheAtIndex(int i) const { return (i < ContinuousFunctionCache::k_numberOfAvailableCaches) ? m_functionCaches + i : nullptr; }
+  IntersectionsCache * intersectionsCache() const { return &m_intersectionsCache; }
   Ion::Storage::Record::ErrorStatus addEmptyModel() override;
   int maxNumberOfModels() const override { return k_maxNumberOfModels; }
 
@@ -73,6 +75,7 @@ private:
 
   mutable ContinuousFunction m_functions[k_maxNumberOfMemoizedModels];
   mutable ContinuousFunctionCache m_functionCaches[ContinuousFunctionCache::k_numberOfAvailableCaches];
+  mutable IntersectionsCache m_intersectionsCache;
 
 };
 
@@ -99,7 +99,8 @@ bool DoublePairStore::set(double f, int series, int i, int j, bool delayUpdate,
     return false;
   }
   assert(j <= numberOfPairsOfSeries(series));
-  if (j >= lengthOfColumn(series, i)) {
+  bool replacesValue = j < lengthOfColumn(series, i);
+  if (!replacesValue) {
     for (int k = lengthOfColumn(series, i); k < j; k++) {
       m_dataLists[series][i].addValueAtIndex(NAN, k);
     }
@@ -111,7 +112,7 @@ bool DoublePairStore::set(double f, int series, int i, int j, bool delayUpdate,
   if (setOtherColumnToDefaultIfEmpty && j >= lengthOfColumn(series, otherI)) {
     set(defaultValue(series, otherI, j), series, otherI, j, true, false);
   }
-  return updateSeries(series, delayUpdate);
+  return replacesValue ? updateSeriesAfterReplacingValue(series, i, j, delayUpdate) : updateSeries(series, delayUpdate);
 }
 
 bool DoublePairStore::setList(List list, int series, int i, bool delayUpdate, bool setOtherColumnToDefaultIfEmpty) {
@@ -114,6 +114,10 @@ protected:
   void initListsInPool();
   double defaultValue(int series, int i, int j) const;
   virtual double defaultValueForColumn1() const = 0;
+  /* Called by set instead of updateSeries when the value at row j of column i
+   * has been replaced, so that data memoized on the series can be updated
+   * rather than recomputed. */
+  virtual bool updateSeriesAfterReplacingValue(int series, int i, int j, bool delayUpdate) { return updateSeries(series, delayUpdate); }
 
   Poincare::FloatList<double> m_dataLists[k_numberOfSeries][k_numberOfColumnsPerSeries];
   DoublePairStorePreferences * m_storePreferences;
@@ -99,7 +99,7 @@ Expression ExpressionModel::expressionReduced(const Storage::Record * record, Po
        * same function. So we need to keep a valid m_expression while executing
        * 'Simplify'. Thus, we use a temporary expression. */
       Preferences preferences = Preferences::ClonePreferencesWithNewComplexFormat(complexFormat(record, context));
-      PoincareHelpers::CloneAndSimplify(&m_expression, context, ReductionTarget::SystemForApproximation, SymbolicComputation::ReplaceAllDefinedSymbolsWithDefinition, PoincareHelpers::k_defaultUnitConversion, &preferences, false);
+      PoincareHelpers::CloneAndSimplifyWithReductionCache(&m_expression, context, ReductionTarget::SystemForApproximation, SymbolicComputation::ReplaceAllDefinedSymbolsWithDefinition, PoincareHelpers::k_defaultUnitConversion, &preferences, false);
     }
   }
   return m_expression;
@@ -29,8 +29,14 @@ ContinuousFunctionStore * GlobalContext::continuousFunctionStore() {
   return &continuousFunctionStore;
 }
 
+ReductionCache * GlobalContext::reductionCache() {
+  static ReductionCache reductionCache;
+  return &reductionCache;
+}
+
 void GlobalContext::storageDidChangeForRecord(Ion::Storage::Record record) {
   m_sequenceContext.resetCache();
+  GlobalContext::reductionCache()->recordDidChange(record);
   GlobalContext::sequenceStore()->storageDidChangeForRecord(record);
   GlobalContext::continuousFunctionStore()->storageDidChangeForRecord(record);
 }
@@ -83,6 +89,23 @@ const Expression GlobalContext::protectedExpressionForSymbolAbstract(const Poinc
   return expressionForSymbolAndRecord(symbol, r, lastDescendantContext ? static_cast<Context *>(lastDescendantContext) : static_cast<Context *>(this));
 }
 
+const ExpressionNode * GlobalContext::approximableNodeForSymbol(const SymbolAbstract & symbol) {
+  /* Functions and sequences need their parameter to be substituted, so they
+   * are still copied into the pool. */
+  if (symbol.type() != ExpressionNode::Type::Symbol) {
+    return nullptr;
+  }
+  Ion::Storage::Record r = SymbolAbstractRecordWithBaseName(symbol.name());
+  if (!r.hasExtension(Ion::Storage::expExtension)
+    && !r.hasExtension(Ion::Storage::lisExtension)
+    && !r.hasExtension(Ion::Storage::matExtension))
+  {
+    return nullptr;
+  }
+  Ion::Storage::Record::Data d = r.value();
+  return Expression::ApproximableNodeAtAddress(d.buffer, d.size);
+}
+
 bool GlobalContext::setExpressionForSymbolAbstract(const Expression & expression, const SymbolAbstract & symbol) {
   /* If the new expression contains the symbol, replace it because it will be
    * destroyed afterwards (to be able to do A+2->A) */
@@ -223,6 +246,7 @@ Ion::Storage::Record GlobalContext::SymbolAbstractRecordWithBaseName(const char
 
 void GlobalContext::tidyDownstreamPoolFrom(char * treePoolCursor) {
   sequenceStore()->tidyDownstreamPoolFrom(treePoolCursor);
+  reductionCache()->tidyDownstreamPoolFrom(treePoolCursor);
 }
 
 }
@@ -10,6 +10,7 @@
 #include <assert.h>
 #include "sequence_store.h"
 #include "sequence_context.h"
+#include "reduction_cache.h"
 
 namespace Shared {
 
@@ -33,8 +34,10 @@ public:
    * Otherwise, we would need the context and the angle unit to evaluate it */
   SymbolAbstractType expressionTypeForIdentifier(const char * identifier, int length) override;
   bool setExpressionForSymbolAbstract(const Poincare::Expression & expression, const Poincare::SymbolAbstract & symbol) override;
+  const Poincare::ExpressionNode * approximableNodeForSymbol(const Poincare::SymbolAbstract & symbol) override;
   static SequenceStore * sequenceStore();
   static ContinuousFunctionStore * continuousFunctionStore();
+  static ReductionCache * reductionCache();
   void storageDidChangeForRecord(const Ion::Storage::Record record);
   SequenceContext * sequenceContext() { return &m_sequenceContext; }
   void tidyDownstreamPoolFrom(char * treePoolCursor = nullptr) override;
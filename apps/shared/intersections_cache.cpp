@@ -0,0 +1,66 @@
+#include "intersections_cache.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace Poincare;
+
+namespace Shared {
+
+void IntersectionsCache::Pair::startComputing(float start, float end) {
+  assert(start < end);
+  if (m_numberOfIntersections > k_maxNumberOfIntersections || !(start == m_end || end == m_start)) {
+    // Only contiguous intervals are cached
+    m_start = m_end = start;
+    m_numberOfIntersections = 0;
+    return;
+  }
+  int n = 0;
+  for (int i = 0; i < m_numberOfIntersections; i++) {
+    if (m_intersections[i].x1IsIn(m_start, m_end, true, false)) {
+      m_intersections[n++] = m_intersections[i];
+    }
+  }
+  m_numberOfIntersections = n;
+}
+
+void IntersectionsCache::Pair::append(Coordinate2D<double> intersection) {
+  if (m_numberOfIntersections < k_maxNumberOfIntersections) {
+    m_intersections[m_numberOfIntersections] = intersection;
+  }
+  if (m_numberOfIntersections <= k_maxNumberOfIntersections) {
+    m_numberOfIntersections++;
+  }
+}
+
+void IntersectionsCache::Pair::finishComputing(float start, float end) {
+  if (m_numberOfIntersections > k_maxNumberOfIntersections) {
+    // Too many intersections, they will be computed each time
+    m_start = m_end = NAN;
+    return;
+  }
+  m_start = std::min(m_start, start);
+  m_end = std::max(m_end, end);
+}
+
+void IntersectionsCache::Pair::setHasNoIntersections() {
+  m_start = -INFINITY;
+  m_end = INFINITY;
+  m_numberOfIntersections = 0;
+}
+
+IntersectionsCache::Pair * IntersectionsCache::pairOfRecords(Ion::Storage::Record record1, Ion::Storage::Record record2, uint32_t checksum) {
+  assert(record1 != record2);
+  for (int i = 0; i < static_cast<int>(m_pairs.length()); i++) {
+    Pair * pair = m_pairs.elementAtIndex(i);
+    if (pair->isOfRecords(record1, record2)) {
+      if (pair->checksum() != checksum) {
+        *pair = Pair(record1, record2, checksum);
+      }
+      return pair;
+    }
+  }
+  m_pairs.push(Pair(record1, record2, checksum));
+  return m_pairs.elementAtIndex(m_pairs.length() - 1);
+}
+
+}
@@ -0,0 +1,66 @@
+#ifndef SHARED_INTERSECTIONS_CACHE_H
+#define SHARED_INTERSECTIONS_CACHE_H
+
+#include <ion/ring_buffer.h>
+#include <ion/storage/record.h>
+#include <poincare/coordinate_2D.h>
+#include <assert.h>
+#include <cmath>
+
+namespace Shared {
+
+/* The IntersectionsCache stores the intersections of pairs of functions, so
+ * that the points of interest of both functions of a pair share them: each
+ * pair is solved once per interval instead of once from each side, and
+ * without building the models again when they are not memoized.
+ * Pairs are unordered and are discarded when the storage changes. */
+
+class IntersectionsCache {
+public:
+  constexpr static int k_numberOfPairs = 15;
+  constexpr static int k_maxNumberOfIntersections = 8;
+
+  class Pair {
+  public:
+    Pair() : m_checksum(0), m_start(NAN), m_end(NAN), m_numberOfIntersections(0) {}
+    Pair(Ion::Storage::Record record1, Ion::Storage::Record record2, uint32_t checksum) : m_record1(record1), m_record2(record2), m_checksum(checksum), m_start(NAN), m_end(NAN), m_numberOfIntersections(0) {}
+
+    bool isOfRecords(Ion::Storage::Record record1, Ion::Storage::Record record2) const { return (m_record1 == record1 && m_record2 == record2) || (m_record1 == record2 && m_record2 == record1); }
+    uint32_t checksum() const { return m_checksum; }
+    /* All the intersections in [start, end) are known. An interrupted
+     * computation may have overflowed the intersections of a valid range. */
+    bool hasComputed(float start, float end) const { return m_numberOfIntersections <= k_maxNumberOfIntersections && m_start <= start && end <= m_end; }
+    int numberOfIntersections() const { return m_numberOfIntersections; }
+    Poincare::Coordinate2D<double> intersectionAtIndex(int i) const { assert(0 <= i && i < m_numberOfIntersections); return m_intersections[i]; }
+
+    /* The intersections in [start, end) are appended between startComputing
+     * and finishComputing. If the computation is interrupted, the appended
+     * intersections are discarded by the next startComputing. */
+    void startComputing(float start, float end);
+    void append(Poincare::Coordinate2D<double> intersection);
+    void finishComputing(float start, float end);
+    // The functions cannot intersect, on any interval
+    void setHasNoIntersections();
+
+  private:
+    Ion::Storage::Record m_record1;
+    Ion::Storage::Record m_record2;
+    uint32_t m_checksum;
+    // Intersections are known in [m_start, m_end)
+    float m_start;
+    float m_end;
+    Poincare::Coordinate2D<double> m_intersections[k_maxNumberOfIntersections];
+    // Greater than k_maxNumberOfIntersections if the intersections overflowed
+    int m_numberOfIntersections;
+  };
+
+  // Return the pair of the two records, forgotten if the checksum changed
+  Pair * pairOfRecords(Ion::Storage::Record record1, Ion::Storage::Record record2, uint32_t checksum);
+
+private:
+  Ion::RingBuffer<Pair, k_numberOfPairs> m_pairs;
+};
+
+}
+
+#endif
@@ -96,6 +96,7 @@ WithCurves::CurveDrawing::CurveDrawing(Curve2D curve, void * context, float tSta
   m_context(context),
   m_curveDouble(nullptr),
   m_discontinuity(NoDiscontinuity),
+  m_enclosure(nullptr),
   m_tStart(tStart),
   m_tEnd(tEnd),
   m_tStep(tStep),
@@ -122,10 +123,11 @@ void WithCurves::CurveDrawing::setPatternOptions(Pattern pattern, float patternS
   m_axis = axis;
 }
 
-void WithCurves::CurveDrawing::setPrecisionOptions(bool drawStraightLinesEarly, Curve2DEvaluation<double> curveDouble, DiscontinuityTest discontinuity) {
+void WithCurves::CurveDrawing::setPrecisionOptions(bool drawStraightLinesEarly, Curve2DEvaluation<double> curveDouble, DiscontinuityTest discontinuity, Curve2DEnclosure enclosure) {
   m_drawStraightLinesEarly = drawStraightLinesEarly;
   m_curveDouble = curveDouble;
   m_discontinuity = discontinuity;
+  m_enclosure = enclosure;
 }
 
 void WithCurves::CurveDrawing::draw(const AbstractPlotView * plotView, KDContext * ctx, KDRect rect) const {
@@ -186,6 +188,14 @@ static bool pointInBoundingBox(float x1, float y1, float x2, float y2, float xC,
       && ((y1 < yC && yC < y2) || (y2 < yC && yC < y1) || (y2 == yC && yC == y1));
 }
 
+// Whether the box of corners q1 and q2 lies within tolerance of the box of p1 and p2
+static bool boxInBoundingBox(Coordinate2D<float> p1, Coordinate2D<float> p2, Coordinate2D<float> q1, Coordinate2D<float> q2, float tolerance) {
+  return std::min(p1.x1(), p2.x1()) - tolerance <= std::min(q1.x1(), q2.x1())
+      && std::max(q1.x1(), q2.x1()) <= std::max(p1.x1(), p2.x1()) + tolerance
+      && std::min(p1.x2(), p2.x2()) - tolerance <= std::min(q1.x2(), q2.x2())
+      && std::max(q1.x2(), q2.x2()) <= std::max(p1.x2(), p2.x2()) + tolerance;
+}
+
 void WithCurves::CurveDrawing::joinDots(const AbstractPlotView * plotView, KDContext * ctx, KDRect rect, float t1, Coordinate2D<float> xy1, float t2, Coordinate2D<float> xy2, int remainingIterations, DiscontinuityTest discontinuity) const {
   assert(plotView);
 
@@ -214,10 +224,29 @@ void WithCurves::CurveDrawing::joinDots(const AbstractPlotView * plotView, KDCon
     return;
   }
 
+  constexpr float dangerousSlope = 1e6f;
+  bool enclosureIsComputed = false;
+  bool enclosureIsContinuous = false;
+  if (m_enclosure && isLeftDotValid && isRightDotValid) {
+    Coordinate2D<float> lowerBound, upperBound;
+    enclosureIsComputed = m_enclosure(t1, t2, m_curve.model(), m_context, &lowerBound, &upperBound, &enclosureIsContinuous);
+    /* If the curve is continuous and does not leave the box of the two dots,
+     * the straight line joining them is drawn without evaluating the curve in
+     * between. Steep slopes are left to the double precision check below. */
+    constexpr float pixelTolerance = 1.f;
+    if (enclosureIsComputed && enclosureIsContinuous
+        && !(m_curveDouble && std::fabs((p2.x2() - p1.x2()) / (p2.x1() - p1.x1())) > dangerousSlope)
+        && boxInBoundingBox(p1, p2, plotView->floatToPixel2D(lowerBound), plotView->floatToPixel2D(upperBound), pixelTolerance)) {
+      plotView->straightJoinDots(ctx, rect, p1, p2, m_color, m_thick);
+      return;
+    }
+  }
+
   float t12 = 0.5f * (t1 + t2);
   Coordinate2D<float> xy12 = m_curve.evaluate(t12, m_context);
 
-  bool discontinuous = discontinuity(t1, t2, m_curve.model(), m_context);
+  // An enclosure also tells apart asymptotes from steep slopes
+  bool discontinuous = enclosureIsComputed ? !enclosureIsContinuous : discontinuity(t1, t2, m_curve.model(), m_context);
   if (discontinuous) {
     /* If the function is discontinuous, it can never join dots at abscissas of
      * discontinuity, and thus will always go to max recursion. To avoid this,
@@ -233,7 +262,6 @@ void WithCurves::CurveDrawing::joinDots(const AbstractPlotView * plotView, KDCon
   } else if (isLeftDotValid && isRightDotValid && (m_drawStraightLinesEarly || remainingIterations <= 0) && pointInBoundingBox(xy1.x1(), xy1.x2(), xy2.x1(), xy2.x2(), xy12.x1(), xy12.x2())) {
     /* As the middle dot is between the two dots, we assume that we
      * can draw a 'straight' line between the two */
-    constexpr float dangerousSlope = 1e6f;
     if (m_curveDouble && std::fabs((p2.x2() - p1.x2()) / (p2.x1() - p1.x1())) > dangerousSlope) {
       /* We need to make sure we're not drawing a vertical asymptote because of
        * rounding errors. */
@@ -36,6 +36,11 @@ protected:
 
   static bool NoDiscontinuity(float, float, void *, void *) { return false; }
 
+  /* Set lowerBound and upperBound to the corners of a box enclosing the curve
+   * between two parameters, or return false if it cannot be enclosed.
+   * isContinuous is set to false if the curve may jump or be undefined. */
+  typedef bool (*Curve2DEnclosure)(float t1, float t2, void * model, void * context, Poincare::Coordinate2D<float> * lowerBound, Poincare::Coordinate2D<float> * upperBound, bool * isContinuous);
+
   /* The screen is tiled with a 4×4 pattern. It takes the form of a
    * lattice with four colored sections and a transparent background.
    * e.g. With sections 1 and 3 colored by Xs:
@@ -69,7 +74,9 @@ protected:
     CurveDrawing(Curve2D curve, void * context, float tStart, float tEnd, float tStep, KDColor color, bool thick = true, bool dashed = false);
     /* If one of the pattern bound is nullptr, the main curve is used instead. */
     void setPatternOptions(Pattern pattern, float patternStart, float patternEnd, Curve2D patternLowerBound, Curve2D patternUpperBound, bool patternWithoutCurve, AbstractPlotView::Axis axis = AbstractPlotView::Axis::Horizontal);
-    void setPrecisionOptions(bool drawStraightLinesEarly, Curve2DEvaluation<double> curveDouble, DiscontinuityTest discontinuity);
+    /* The enclosure, if any, supersedes the discontinuity test and spares the
+     * evaluation of the curve between dots it proves can be joined. */
+    void setPrecisionOptions(bool drawStraightLinesEarly, Curve2DEvaluation<double> curveDouble, DiscontinuityTest discontinuity, Curve2DEnclosure enclosure = nullptr);
     void draw(const AbstractPlotView * plotView, KDContext * ctx, KDRect rect) const;
 
   private:
@@ -89,6 +96,7 @@ protected:
     void * m_context;
     Curve2DEvaluation<double> m_curveDouble;
     DiscontinuityTest m_discontinuity;
+    Curve2DEnclosure m_enclosure;
     float m_tStart;
     float m_tEnd;
     float m_tStep;
@@ -6,6 +6,7 @@
 #include <poincare/preferences.h>
 #include <poincare/print_float.h>
 #include <poincare/solver.h>
+#include "reduction_cache.h"
 
 namespace Shared {
 
@@ -136,6 +137,20 @@ inline void CloneAndSimplify(
   *e = e->cloneAndSimplify(Poincare::ReductionContext(context, ComplexFormatForPreferences(preferences, updateComplexFormatAndAngleUnit, *e, context), preferences->angleUnit(), GlobalPreferences::sharedGlobalPreferences()->unitFormat(), target, symbolicComputation, unitConversion), reductionFailure);
 }
 
+// Share the reduction with the previous ones within the global context
+inline void CloneAndSimplifyWithReductionCache(
+  Poincare::Expression * e,
+  Poincare::Context * context,
+  Poincare::ReductionTarget target,
+  Poincare::SymbolicComputation symbolicComputation = k_replaceWithDefinition,
+  Poincare::UnitConversion unitConversion = k_defaultUnitConversion,
+  Poincare::Preferences * preferences = Poincare::Preferences::sharedPreferences(),
+  bool updateComplexFormatAndAngleUnit = true,
+  bool * reductionFailure = nullptr)
+{
+  *e = ReductionCache::CloneAndSimplify(*e, Poincare::ReductionContext(context, ComplexFormatForPreferences(preferences, updateComplexFormatAndAngleUnit, *e, context), preferences->angleUnit(), GlobalPreferences::sharedGlobalPreferences()->unitFormat(), target, symbolicComputation, unitConversion), reductionFailure);
+}
+
 inline void CloneAndSimplifyAndApproximate(
   Poincare::Expression e,
   Poincare::Expression * simplifiedExpression,
@@ -0,0 +1,215 @@
+#include "reduction_cache.h"
+#include "global_context.h"
+#include <apps/apps_container_helper.h>
+#include <poincare/checkpoint.h>
+#include <poincare/symbol.h>
+#include <ion/storage/file_system.h>
+#include <string.h>
+#include <assert.h>
+
+using namespace Poincare;
+
+namespace Shared {
+
+static uint32_t Combine(uint32_t hash, uint32_t value) {
+  // FNV-1a step
+  return (hash ^ value) * 16777619u;
+}
+
+Expression ReductionCache::CloneAndSimplify(Expression e, const ReductionContext & reductionContext, bool * reductionFailure) {
+  if (reductionContext.context() == AppsContainerHelper::sharedAppsContainerGlobalContext()) {
+    /* The reduction only depends on the records of the global context: it
+     * can be shared with the previous reductions of the same expression. */
+    return GlobalContext::reductionCache()->cloneAndSimplify(e, reductionContext, reductionFailure);
+  }
+  return e.cloneAndSimplify(reductionContext, reductionFailure);
+}
+
+Expression ReductionCache::cloneAndSimplify(Expression e, const ReductionContext & reductionContext, bool * reductionFailure) {
+  uint32_t key = Key(e, reductionContext);
+  m_numberOfLookups++;
+  for (Entry & entry : m_entries) {
+    if (entry.matches(e, key, reductionContext)) {
+      if (!entry.dependenciesAreUpToDate()) {
+        if (entry.canBeReset()) {
+          entry.reset();
+        }
+        break;
+      }
+      entry.m_lastLookup = m_numberOfLookups;
+      if (reductionFailure) {
+        *reductionFailure = false;
+      }
+      return entry.m_output.clone();
+    }
+  }
+
+  bool failure = false;
+  Expression result = e.cloneAndSimplify(reductionContext, &failure);
+  if (reductionFailure) {
+    *reductionFailure = failure;
+  }
+  /* Reductions interrupted by the system checkpoint are not cached since the
+   * next attempt might succeed with more room in the pool. */
+  Entry newEntry;
+  if (failure || result.isUninitialized() || !newEntry.setDependencies(e, reductionContext.context())) {
+    return result;
+  }
+  /* Within a checkpoint, the entries created before it are kept, and the ones
+   * created after it are tidied with the GlobalContext if it rolls back. */
+  Entry * leastRecentlyUsed = nullptr;
+  for (Entry & entry : m_entries) {
+    if (!entry.canBeReset()) {
+      continue;
+    }
+    if (entry.isEmpty()) {
+      leastRecentlyUsed = &entry;
+      break;
+    }
+    if (!leastRecentlyUsed || entry.m_lastLookup < leastRecentlyUsed->m_lastLookup) {
+      leastRecentlyUsed = &entry;
+    }
+  }
+  if (!leastRecentlyUsed) {
+    return result;
+  }
+  // Free the pool before cloning the new trees
+  leastRecentlyUsed->reset();
+  newEntry.m_input = e.clone();
+  newEntry.m_output = result.clone();
+  newEntry.m_reductionContext = reductionContext;
+  newEntry.m_key = key;
+  newEntry.m_lastLookup = m_numberOfLookups;
+  *leastRecentlyUsed = newEntry;
+  return result;
+}
+
+void ReductionCache::recordDidChange(const Ion::Storage::Record record) {
+  Ion::Storage::Record::Name name = record.name();
+  for (Entry & entry : m_entries) {
+    if (entry.dependsOn(name.baseName, name.baseNameLength)) {
+      entry.reset();
+    }
+  }
+}
+
+void ReductionCache::tidyDownstreamPoolFrom(char * treePoolCursor) {
+  for (Entry & entry : m_entries) {
+    if (treePoolCursor == nullptr || entry.isDownstreamOf(treePoolCursor)) {
+      entry.reset();
+    }
+  }
+}
+
+char * ReductionCache::TopmostEndOfPool() {
+  return reinterpret_cast<char *>(Checkpoint::TopmostEndOfPool());
+}
+
+uint32_t ReductionCache::Key(const Expression e, const ReductionContext & reductionContext) {
+  uint32_t key = Combine(Combine(2166136261u, e.hash()), e.size());
+  key = Combine(key, static_cast<uint32_t>(reductionContext.complexFormat()));
+  key = Combine(key, static_cast<uint32_t>(reductionContext.angleUnit()));
+  key = Combine(key, static_cast<uint32_t>(reductionContext.unitFormat()));
+  key = Combine(key, static_cast<uint32_t>(reductionContext.target()));
+  key = Combine(key, static_cast<uint32_t>(reductionContext.symbolicComputation()));
+  key = Combine(key, static_cast<uint32_t>(reductionContext.unitConversion()));
+  return Combine(key, reductionContext.shouldExpandMultiplication() | reductionContext.shouldCheckMatrices() << 1 | reductionContext.shouldExpandLogarithm() << 2);
+}
+
+uint32_t ReductionCache::RecordChecksum(const char * baseName) {
+  Ion::Storage::Record record = Ion::Storage::FileSystem::sharedFileSystem()->recordBaseNamedWithExtensions(baseName, GlobalContext::k_extensions, GlobalContext::k_numberOfExtensions);
+  return record.isNull() ? 0 : record.checksum();
+}
+
+bool ReductionCache::Entry::matches(const Expression e, uint32_t key, const ReductionContext & reductionContext) const {
+  const ReductionContext & c = m_reductionContext;
+  return !isEmpty()
+    && m_key == key
+    && c.context() == reductionContext.context()
+    && c.complexFormat() == reductionContext.complexFormat()
+    && c.angleUnit() == reductionContext.angleUnit()
+    && c.unitFormat() == reductionContext.unitFormat()
+    && c.target() == reductionContext.target()
+    && c.symbolicComputation() == reductionContext.symbolicComputation()
+    && c.unitConversion() == reductionContext.unitConversion()
+    && c.shouldExpandMultiplication() == reductionContext.shouldExpandMultiplication()
+    && c.shouldCheckMatrices() == reductionContext.shouldCheckMatrices()
+    && c.shouldExpandLogarithm() == reductionContext.shouldExpandLogarithm()
+    && m_input.isStrictlyIdenticalTo(e);
+}
+
+bool ReductionCache::Entry::dependsOn(const char * baseName, int baseNameLength) const {
+  for (int i = 0; i < m_numberOfDependencies; i++) {
+    const char * name = m_dependencies[i].name;
+    if (strncmp(name, baseName, baseNameLength) == 0 && name[baseNameLength] == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ReductionCache::Entry::dependenciesAreUpToDate() const {
+  for (int i = 0; i < m_numberOfDependencies; i++) {
+    if (RecordChecksum(m_dependencies[i].name) != m_dependencies[i].checksum) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ReductionCache::Entry::setDependencies(const Expression e, Context * context) {
+  m_numberOfDependencies = 0;
+  return addDependencies(e, context);
+}
+
+bool ReductionCache::Entry::addDependencies(const Expression e, Context * context) {
+  if (e.type() == ExpressionNode::Type::Sequence || Expression::IsRandom(e, context)) {
+    return false;
+  }
+  if (e.isOfType({ExpressionNode::Type::Symbol, ExpressionNode::Type::Function})
+   && !(e.type() == ExpressionNode::Type::Symbol && static_cast<const Symbol &>(e).isSystemSymbol()))
+  {
+    const SymbolAbstract & symbol = static_cast<const SymbolAbstract &>(e);
+    bool isNew;
+    if (!addDependency(symbol, &isNew)) {
+      return false;
+    }
+    /* The definition is browsed only once, which also prevents looping on
+     * circularly defined symbols. */
+    if (isNew) {
+      Expression definition = context->expressionForSymbolAbstract(symbol, false);
+      if (!definition.isUninitialized() && !addDependencies(definition, context)) {
+        return false;
+      }
+    }
+  }
+  int n = e.numberOfChildren();
+  for (int i = 0; i < n; i++) {
+    if (!addDependencies(e.childAtIndex(i), context)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ReductionCache::Entry::addDependency(const SymbolAbstract & symbol, bool * isNew) {
+  const char * name = symbol.name();
+  for (int i = 0; i < m_numberOfDependencies; i++) {
+    if (strcmp(m_dependencies[i].name, name) == 0) {
+      *isNew = false;
+      return true;
+    }
+  }
+  *isNew = true;
+  if (m_numberOfDependencies == k_maxNumberOfDependencies || strlen(name) >= SymbolAbstract::k_maxNameSize) {
+    return false;
+  }
+  Dependency * dependency = m_dependencies + m_numberOfDependencies;
+  strlcpy(dependency->name, name, SymbolAbstract::k_maxNameSize);
+  // Undefined symbols depend on the absence of a record
+  dependency->checksum = RecordChecksum(name);
+  m_numberOfDependencies++;
+  return true;
+}
+
+}
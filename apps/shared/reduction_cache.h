@@ -0,0 +1,87 @@
+#ifndef SHARED_REDUCTION_CACHE_H
+#define SHARED_REDUCTION_CACHE_H
+
+#include <poincare/expression.h>
+#include <poincare/symbol_abstract.h>
+#include <ion/storage/record.h>
+
+namespace Shared {
+
+/* The ReductionCache memoizes the last simplifications of expressions within
+ * the GlobalContext, so that simplifying an identical tree with the same
+ * ReductionContext becomes a lookup. For instance, the ExpressionModels forget
+ * their reduced expression whenever any record of the storage changes, and
+ * would otherwise simplify it again although it did not depend on the record.
+ *
+ * Entries are keyed by the hash of the input tree combined with the fields of
+ * the ReductionContext, and the input is then compared with
+ * isStrictlyIdenticalTo since isIdenticalTo ignores attributes such as the
+ * arguments of functions. Each entry remembers the checksums of the records it depends
+ * on, directly or through the definitions of these records, and is discarded
+ * as soon as one of them changed. Expressions depending on sequences or on
+ * random values are not cached.
+ *
+ * Both the input and the simplified trees live in the TreePool: the cache only
+ * keeps a few entries and must be tidied alongside the GlobalContext. */
+
+class ReductionCache {
+public:
+  constexpr static int k_numberOfEntries = 4;
+  constexpr static int k_maxNumberOfDependencies = 6;
+
+  ReductionCache() : m_numberOfLookups(0) {}
+
+  /* Simplify e through the cache of the GlobalContext of the apps when it is
+   * the context of reductionContext, and without caching otherwise. */
+  static Poincare::Expression CloneAndSimplify(Poincare::Expression e, const Poincare::ReductionContext & reductionContext, bool * reductionFailure = nullptr);
+
+  /* Equivalent to e.cloneAndSimplify(reductionContext, reductionFailure). The
+   * context of reductionContext must be a GlobalContext. */
+  Poincare::Expression cloneAndSimplify(Poincare::Expression e, const Poincare::ReductionContext & reductionContext, bool * reductionFailure = nullptr);
+  // Discard the entries depending on the record
+  void recordDidChange(const Ion::Storage::Record record);
+  void tidyDownstreamPoolFrom(char * treePoolCursor = nullptr);
+
+private:
+  struct Dependency {
+    char name[Poincare::SymbolAbstract::k_maxNameSize];
+    uint32_t checksum;
+  };
+
+  class Entry {
+  public:
+    Entry() : m_key(0), m_lastLookup(0), m_numberOfDependencies(0) {}
+    bool isEmpty() const { return m_input.isUninitialized(); }
+    void reset() { *this = Entry(); }
+    bool matches(const Poincare::Expression e, uint32_t key, const Poincare::ReductionContext & reductionContext) const;
+    bool dependsOn(const char * baseName, int baseNameLength) const;
+    bool dependenciesAreUpToDate() const;
+    bool isDownstreamOf(char * treePoolCursor) { return m_input.isDownstreamOf(treePoolCursor) || m_output.isDownstreamOf(treePoolCursor); }
+    // Nodes older than the topmost checkpoint must not be freed
+    bool canBeReset() { return isEmpty() || (m_input.isDownstreamOf(TopmostEndOfPool()) && m_output.isDownstreamOf(TopmostEndOfPool())); }
+    // Return false if e cannot be cached
+    bool setDependencies(const Poincare::Expression e, Poincare::Context * context);
+
+    Poincare::Expression m_input;
+    Poincare::Expression m_output;
+    Poincare::ReductionContext m_reductionContext;
+    uint32_t m_key;
+    uint32_t m_lastLookup;
+  private:
+    bool addDependencies(const Poincare::Expression e, Poincare::Context * context);
+    bool addDependency(const Poincare::SymbolAbstract & symbol, bool * isNew);
+    Dependency m_dependencies[k_maxNumberOfDependencies];
+    int m_numberOfDependencies;
+  };
+
+  static char * TopmostEndOfPool();
+  static uint32_t Key(const Poincare::Expression e, const Poincare::ReductionContext & reductionContext);
+  static uint32_t RecordChecksum(const char * baseName);
+
+  Entry m_entries[k_numberOfEntries];
+  uint32_t m_numberOfLookups;
+};
+
+}
+
+#endif
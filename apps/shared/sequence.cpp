@@ -160,6 +160,44 @@ bool Sequence::isSimplyRecursive(Context * context) {
   }, context, SymbolicComputation::ReplaceAllDefinedSymbolsWithDefinition, static_cast<void*>(buffer));
 }
 
+template<typename T>
+bool Sequence::isAffineRecurrence(SequenceContext * sqctx, T * a, T * b) {
+  if (type() != Type::SingleRecurrence) {
+    return false;
+  }
+  constexpr size_t bufferSize = SequenceStore::k_maxSequenceNameLength + 1;
+  char buffer[bufferSize];
+  name(buffer, bufferSize);
+  Expression e = expressionClone();
+  // Terms of other sequences or at other ranks are not constant
+  if (e.isUninitialized() || e.recursivelyMatches([](const Expression e, Context * context, void * arg) {
+      if (Expression::IsRandom(e, context)) {
+        return TrinaryBoolean::True;
+      }
+      if (e.type() != ExpressionNode::Type::Sequence) {
+        return TrinaryBoolean::Unknown;
+      }
+      const Poincare::Sequence seq = static_cast<const Poincare::Sequence&>(e);
+      return strcmp(seq.name(), static_cast<char*>(arg)) != 0 || !seq.childAtIndex(0).isIdenticalTo(Symbol::Builder(UCodePointUnknown)) ? TrinaryBoolean::True : TrinaryBoolean::False;
+    }, sqctx, SymbolicComputation::ReplaceAllDefinedSymbolsWithDefinition, static_cast<void*>(buffer))) {
+    return false;
+  }
+  constexpr char k_termName[2] = {UCodePointTemporaryUnknown, 0};
+  e = e.replaceSymbolWithExpression(Poincare::Sequence::Builder(buffer, strlen(buffer), Symbol::Builder(UCodePointUnknown)), Symbol::Builder(UCodePointTemporaryUnknown));
+  Preferences preferences = Preferences::ClonePreferencesWithNewComplexFormat(complexFormat(sqctx));
+  Preferences::UnitFormat unitFormat = GlobalPreferences::sharedGlobalPreferences()->unitFormat();
+  e = e.cloneAndReduce(ReductionContext(sqctx, preferences.complexFormat(), preferences.angleUnit(), unitFormat, ReductionTarget::SystemForAnalysis));
+  Expression coefficients[Expression::k_maxNumberOfPolynomialCoefficients];
+  int degree = e.getPolynomialReducedCoefficients(k_termName, coefficients, sqctx, preferences.complexFormat(), preferences.angleUnit(), unitFormat, SymbolicComputation::ReplaceAllDefinedSymbolsWithDefinition);
+  if (degree < 0 || degree > 1) {
+    return false;
+  }
+  // Coefficients depending on n approximate to undef
+  *a = degree == 1 ? PoincareHelpers::ApproximateToScalar<T>(coefficients[1], sqctx, &preferences, false) : static_cast<T>(0.);
+  *b = PoincareHelpers::ApproximateToScalar<T>(coefficients[0], sqctx, &preferences, false);
+  return std::isfinite(*a) && std::isfinite(*b);
+}
+
 void Sequence::tidyDownstreamPoolFrom(char * treePoolCursor) const {
   model()->tidyDownstreamPoolFrom(treePoolCursor);
   m_firstInitialCondition.tidyDownstreamPoolFrom(treePoolCursor);
@@ -170,6 +208,10 @@ template<typename T>
 T Sequence::templatedApproximateAtAbscissa(T x, SequenceContext * sqctx) const {
   T n = std::round(x);
   int sequenceIndex = SequenceStore::sequenceIndexForName(fullName()[0]);
+  T value;
+  if (n >= 0 && sqctx->valueInClosedForm<T>(sequenceIndex, n, &value)) {
+    return value;
+  }
   if (sqctx->iterateUntilRank<T>(n)) {
     return sqctx->valueOfCommonRankSequenceAtPreviousRank<T>(sequenceIndex, 0);
   }
@@ -182,6 +224,10 @@ T Sequence::valueAtRank(int n, SequenceContext *sqctx) {
     return NAN;
   }
   int sequenceIndex = SequenceStore::sequenceIndexForName(fullName()[0]);
+  T value;
+  if (sqctx->valueInClosedForm<T>(sequenceIndex, n, &value)) {
+    return value;
+  }
   if (sqctx->independentSequenceRank<T>(sequenceIndex) > n || sqctx->independentSequenceRank<T>(sequenceIndex) < 0) {
     // Reset cache indexes and cache values
     sqctx->setIndependentSequenceRank<T>(-1, sequenceIndex);
@@ -194,7 +240,7 @@ T Sequence::valueAtRank(int n, SequenceContext *sqctx) {
   }
   /* In case we have sqctx->independentSequenceRank<T>(sequenceIndex) = n, we can return the
    * value */
-  T value = sqctx->independentSequenceValue<T>(sequenceIndex, 0);
+  value = sqctx->independentSequenceValue<T>(sequenceIndex, 0);
   return value;
 }
 
@@ -403,5 +449,7 @@ template double Sequence::approximateToNextRank<double>(int, SequenceContext*, i
 template float Sequence::approximateToNextRank<float>(int, SequenceContext*, int) const;
 template double Sequence::valueAtRank<double>(int, SequenceContext *);
 template float Sequence::valueAtRank<float>(int, SequenceContext *);
+template bool Sequence::isAffineRecurrence<double>(SequenceContext *, double *, double *);
+template bool Sequence::isAffineRecurrence<float>(SequenceContext *, float *, float *);
 
 }
@@ -62,6 +62,9 @@ public:
   bool isEmpty() override;
   /* u_(n+1) must depend on u_n only not n nor v_n nor u_(n-1) */
   bool isSimplyRecursive(Poincare::Context * context);
+  /* Return true if u_(n+1) = a*u_n+b with constant a and b, which covers
+   * arithmetic and geometric sequences, and set a and b. */
+  template<typename T> bool isAffineRecurrence(SequenceContext * sqctx, T * a, T * b);
 
   // Approximation
   Poincare::Coordinate2D<float> evaluateXYAtParameter(float x, Poincare::Context * context, int subCurveIndex = 0) const override {
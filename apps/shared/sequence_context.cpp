@@ -2,7 +2,9 @@
 #include "sequence_store.h"
 #include "sequence_cache_context.h"
 #include "../shared/poincare_helpers.h"
+#include <algorithm>
 #include <cmath>
+#include <string.h>
 
 using namespace Poincare;
 
@@ -13,7 +15,9 @@ TemplatedSequenceContext<T>::TemplatedSequenceContext() :
   m_commonRank(-1),
   m_commonRankValues{{NAN, NAN, NAN}, {NAN, NAN, NAN}, {NAN, NAN, NAN}},
   m_independentRanks{-1, -1, -1},
-  m_independentRankValues{{NAN, NAN, NAN}, {NAN, NAN, NAN}, {NAN, NAN, NAN}}
+  m_independentRankValues{{NAN, NAN, NAN}, {NAN, NAN, NAN}, {NAN, NAN, NAN}},
+  m_numberOfCheckpoints(0),
+  m_closedForms{}
 {
 }
 
@@ -29,21 +33,81 @@ void TemplatedSequenceContext<T>::resetCache() {
    * values stored in m_commomValues and m_independentRankValues are dirty
    * and do not use them. */
   m_commonRank = -1;
+  m_numberOfCheckpoints = 0;
   for (int i = 0; i < SequenceStore::k_maxNumberOfSequences; i ++) {
     m_independentRanks[i] = -1;
+    m_closedForms[i].status = ClosedFormStatus::Unknown;
   }
 }
 
 template<typename T>
 bool TemplatedSequenceContext<T>::iterateUntilRank(int n, SequenceStore * sequenceStore, SequenceContext * sqctx) {
-  if (m_commonRank > n) {
-    m_commonRank = -1;
+  if (n < 0) {
+    return false;
   }
-  if (n < 0 || n-m_commonRank > k_maxRecurrentRank) {
+  restoreCheckpointBefore(n);
+  if (n-m_commonRank > k_maxRecurrentRank) {
     return false;
   }
   while (m_commonRank < n) {
     step(sqctx);
+    /* Checkpoints are saved in order, as stepping always starts from the
+     * initial rank or from a checkpoint. */
+    if (m_numberOfCheckpoints < k_maxNumberOfCheckpoints && m_commonRank == (m_numberOfCheckpoints + 1) * k_checkpointInterval) {
+      memcpy(m_checkpointValues[m_numberOfCheckpoints], m_commonRankValues, sizeof(m_commonRankValues));
+      m_numberOfCheckpoints++;
+    }
+  }
+  return true;
+}
+
+template<typename T>
+void TemplatedSequenceContext<T>::restoreCheckpointBefore(int n) {
+  int checkpointIndex = std::min(n / k_checkpointInterval, m_numberOfCheckpoints) - 1;
+  int checkpointRank = (checkpointIndex + 1) * k_checkpointInterval;
+  if (checkpointIndex < 0) {
+    checkpointRank = -1;
+  }
+  if (m_commonRank <= n && m_commonRank >= checkpointRank) {
+    // Stepping from the current rank is shorter
+    return;
+  }
+  m_commonRank = checkpointRank;
+  if (checkpointIndex >= 0) {
+    memcpy(m_commonRankValues, m_checkpointValues[checkpointIndex], sizeof(m_commonRankValues));
+  }
+}
+
+template<typename T>
+bool TemplatedSequenceContext<T>::valueInClosedForm(int sequenceIndex, int n, SequenceContext * sqctx, T * value) {
+  ClosedForm * closedForm = m_closedForms + sequenceIndex;
+  if (closedForm->status == ClosedFormStatus::Unknown) {
+    closedForm->status = ClosedFormStatus::None;
+    SequenceStore * sequenceStore = sqctx->sequenceStore();
+    Ion::Storage::Record record = sequenceStore->recordAtNameIndex(sequenceIndex);
+    if (!record.isNull()) {
+      Sequence * u = sequenceStore->modelForRecord(record);
+      if (u->isDefined() && u->isAffineRecurrence<T>(sqctx, &closedForm->a, &closedForm->b)) {
+        closedForm->status = ClosedFormStatus::Affine;
+        closedForm->initialRank = u->initialRank();
+        closedForm->initialValue = u->approximateToNextRank<T>(closedForm->initialRank, sqctx, sequenceIndex);
+      }
+    }
+  }
+  /* Like stepping from scratch in iterateUntilRank, the closed form does not
+   * reach ranks beyond k_maxRecurrentRank. */
+  if (closedForm->status != ClosedFormStatus::Affine || n >= k_maxRecurrentRank) {
+    return false;
+  }
+  int k = n - closedForm->initialRank;
+  T a = closedForm->a, b = closedForm->b, u0 = closedForm->initialValue;
+  if (k < 0) {
+    *value = NAN;
+  } else if (a == static_cast<T>(1.)) {
+    *value = u0 + k * b;
+  } else {
+    T l = b / (static_cast<T>(1.) - a);
+    *value = std::pow(a, static_cast<T>(k)) * (u0 - l) + l;
   }
   return true;
 }
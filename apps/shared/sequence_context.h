@@ -23,8 +23,30 @@ public:
   T independentSequenceValue(int sequenceIndex, int depth) { return m_independentRankValues[sequenceIndex][depth]; }
   void setIndependentSequenceValue(T value, int sequenceIndex, int depth) { m_independentRankValues[sequenceIndex][depth] = value; }
   void step(SequenceContext * sqctx, int sequenceIndex = -1);
+  /* Return true and set value to the term of rank n if the sequence has a
+   * closed form. */
+  bool valueInClosedForm(int sequenceIndex, int n, SequenceContext * sqctx, T * value);
 private:
   constexpr static int k_maxRecurrentRank = 10000;
+  constexpr static int k_checkpointInterval = 500;
+  constexpr static int k_maxNumberOfCheckpoints = k_maxRecurrentRank / k_checkpointInterval;
+
+  enum class ClosedFormStatus : uint8_t {
+    Unknown,
+    None,
+    Affine
+  };
+
+  // u(n) = a^(n-n0)*(u(n0)-l)+l with l = b/(1-a), or u(n0)+(n-n0)*b if a = 1
+  struct ClosedForm {
+    ClosedFormStatus status;
+    int initialRank;
+    T initialValue;
+    T a;
+    T b;
+  };
+
+  void restoreCheckpointBefore(int n);
   /* Cache:
    * We use two types of cache :
    * The first one is used to to accelerate the
@@ -41,13 +63,25 @@ private:
    * values of each sequence at independent rank. This means that
    * (u(3), v(5), w(10)) can be computed at the same time.
    * This cache is therefore used for independent steps of sequences
-   */
+   *
+   * The common values are also saved every k_checkpointInterval ranks, so that
+   * going back to a lower rank, when scrolling up the values table for
+   * instance, steps from the last checkpoint instead of the initial rank.
+   *
+   * Finally, sequences defined by u(n+1) = a*u(n)+b are computed in closed
+   * form, without any iteration. */
   int m_commonRank;
   T m_commonRankValues[SequenceStore::k_maxNumberOfSequences][SequenceStore::k_maxRecurrenceDepth+1];
 
   // Used for fixed computations
   int m_independentRanks[SequenceStore::k_maxNumberOfSequences];
   T m_independentRankValues[SequenceStore::k_maxNumberOfSequences][SequenceStore::k_maxRecurrenceDepth+1];
+
+  // Checkpoint i holds the common values at rank (i+1)*k_checkpointInterval
+  int m_numberOfCheckpoints;
+  T m_checkpointValues[k_maxNumberOfCheckpoints][SequenceStore::k_maxNumberOfSequences][SequenceStore::k_maxRecurrenceDepth+1];
+
+  ClosedForm m_closedForms[SequenceStore::k_maxNumberOfSequences];
 };
 
 class SequenceContext : public Poincare::ContextWithParent {
@@ -76,6 +110,10 @@ public:
     return static_cast<TemplatedSequenceContext<T>*>(helper<T>())->iterateUntilRank(n, m_sequenceStore, this);
   }
 
+  template<typename T> bool valueInClosedForm(int sequenceIndex, int n, T * value) {
+    return static_cast<TemplatedSequenceContext<T>*>(helper<T>())->valueInClosedForm(sequenceIndex, n, this, value);
+  }
+
   template<typename T> int independentSequenceRank(int sequenceIndex) {
     return static_cast<TemplatedSequenceContext<T>*>(helper<T>())->independentSequenceRank(sequenceIndex);
   }
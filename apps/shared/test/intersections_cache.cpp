@@ -0,0 +1,72 @@
+#include <quiz.h>
+#include "../intersections_cache.h"
+
+using namespace Poincare;
+
+namespace Shared {
+
+QUIZ_CASE(shared_intersections_cache) {
+  IntersectionsCache cache;
+  Ion::Storage::Record f("f", Ion::Storage::funcExtension);
+  Ion::Storage::Record g("g", Ion::Storage::funcExtension);
+  Ion::Storage::Record h("h", Ion::Storage::funcExtension);
+  constexpr uint32_t checksum = 1;
+
+  IntersectionsCache::Pair * pair = cache.pairOfRecords(f, g, checksum);
+  quiz_assert(!pair->hasComputed(0.f, 1.f));
+  pair->startComputing(0.f, 1.f);
+  pair->append(Coordinate2D<double>(0.5, 2.));
+  pair->finishComputing(0.f, 1.f);
+
+  // Pairs are unordered
+  quiz_assert(cache.pairOfRecords(g, f, checksum) == pair);
+  quiz_assert(pair->hasComputed(0.f, 1.f) && pair->hasComputed(0.25f, 0.5f) && !pair->hasComputed(0.5f, 1.5f));
+  quiz_assert(pair->numberOfIntersections() == 1 && pair->intersectionAtIndex(0).x1() == 0.5);
+  quiz_assert(cache.pairOfRecords(f, h, checksum) != pair);
+
+  // Contiguous intervals extend the computed one
+  pair->startComputing(-1.f, 0.f);
+  pair->append(Coordinate2D<double>(-0.5, 1.));
+  pair->finishComputing(-1.f, 0.f);
+  quiz_assert(pair->hasComputed(-1.f, 1.f) && pair->numberOfIntersections() == 2);
+
+  // Interrupted computations are discarded
+  pair->startComputing(1.f, 2.f);
+  pair->append(Coordinate2D<double>(1.5, 1.));
+  pair->startComputing(1.f, 2.f);
+  pair->finishComputing(1.f, 2.f);
+  quiz_assert(pair->hasComputed(-1.f, 2.f) && pair->numberOfIntersections() == 2);
+
+  // Other intervals replace it
+  pair->startComputing(5.f, 6.f);
+  pair->finishComputing(5.f, 6.f);
+  quiz_assert(pair->hasComputed(5.f, 6.f) && !pair->hasComputed(0.f, 1.f) && pair->numberOfIntersections() == 0);
+
+  // Too many intersections are not cached
+  pair->startComputing(6.f, 7.f);
+  for (int i = 0; i <= IntersectionsCache::k_maxNumberOfIntersections; i++) {
+    pair->append(Coordinate2D<double>(6. + i * 0.1, 0.));
+  }
+  pair->finishComputing(6.f, 7.f);
+  quiz_assert(!pair->hasComputed(6.f, 7.f));
+
+  // Interrupted computations that overflowed invalidate the contiguous interval
+  pair->startComputing(7.f, 8.f);
+  pair->finishComputing(7.f, 8.f);
+  pair->startComputing(8.f, 9.f);
+  for (int i = 0; i <= IntersectionsCache::k_maxNumberOfIntersections; i++) {
+    pair->append(Coordinate2D<double>(8. + i * 0.1, 0.));
+  }
+  quiz_assert(!pair->hasComputed(7.f, 8.f));
+  pair->startComputing(7.f, 8.f);
+  pair->finishComputing(7.f, 8.f);
+  quiz_assert(pair->hasComputed(7.f, 8.f) && pair->numberOfIntersections() == 0);
+
+  // Pairs are forgotten when the storage changes
+  pair->setHasNoIntersections();
+  quiz_assert(pair->hasComputed(-1e10f, 1e10f));
+  pair = cache.pairOfRecords(f, g, checksum + 1);
+  quiz_assert(!pair->hasComputed(0.f, 1.f));
+}
+
+}
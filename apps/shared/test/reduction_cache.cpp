@@ -0,0 +1,58 @@
+#include <quiz.h>
+#include "../global_context.h"
+#include "../reduction_cache.h"
+#include "../../../poincare/test/helper.h"
+
+using namespace Poincare;
+
+namespace Shared {
+
+void assert_cached_reduction_is(ReductionCache * cache, Context * context, const char * expression, const char * result, Preferences::AngleUnit angleUnit = Radian) {
+  ReductionContext reductionContext(context, Real, angleUnit, MetricUnitFormat, SystemForApproximation);
+  Expression e = parse_expression(expression, context, false);
+  Expression expected = e.clone().cloneAndSimplify(reductionContext);
+  // The second reduction is looked up in the cache
+  for (int i = 0; i < 2; i++) {
+    Expression reduced = cache->cloneAndSimplify(e, reductionContext);
+    quiz_assert_print_if_failure(reduced.isIdenticalTo(expected), expression);
+  }
+  char buffer[100];
+  expected.serialize(buffer, sizeof(buffer), DecimalMode, PrintFloat::k_numberOfStoredSignificantDigits);
+  quiz_assert_print_if_failure(strcmp(buffer, result) == 0, expression);
+}
+
+QUIZ_CASE(shared_reduction_cache) {
+  GlobalContext context;
+  ReductionCache cache;
+  assert_reduce_and_store("2→a");
+  assert_reduce_and_store("x+a→f(x)");
+  assert_cached_reduction_is(&cache, &context, "f(3)", "5");
+  // Inputs only differing by attributes ignored by isIdenticalTo
+  assert_cached_reduction_is(&cache, &context, "f(4)", "6");
+  assert_cached_reduction_is(&cache, &context, "[[a,1]]", "[[2,1]]");
+  assert_cached_reduction_is(&cache, &context, "[[a][1]]", "[[2][1]]");
+  assert_cached_reduction_is(&cache, &context, "cos(a×π)", "1");
+  assert_cached_reduction_is(&cache, &context, "cos(a×π)", "cos(2×π)", Degree);
+  // Entries are discarded when a record they depend on changes
+  assert_reduce_and_store("4→a");
+  assert_cached_reduction_is(&cache, &context, "f(3)", "7");
+  assert_reduce_and_store("a^2→g(x)");
+  assert_reduce_and_store("g(x)-x→f(x)");
+  assert_cached_reduction_is(&cache, &context, "f(3)", "13");
+  assert_reduce_and_store("1→a");
+  assert_cached_reduction_is(&cache, &context, "f(3)", "-2");
+  // Undefined symbols depend on the absence of a record
+  assert_cached_reduction_is(&cache, &context, "b+1", "b+1");
+  assert_reduce_and_store("3→b");
+  assert_cached_reduction_is(&cache, &context, "b+1", "4");
+  // More expressions than entries
+  assert_cached_reduction_is(&cache, &context, "a+2", "3");
+  assert_cached_reduction_is(&cache, &context, "a+3", "4");
+  assert_cached_reduction_is(&cache, &context, "a+4", "5");
+  assert_cached_reduction_is(&cache, &context, "a+5", "6");
+  assert_cached_reduction_is(&cache, &context, "f(3)", "-2");
+  cache.tidyDownstreamPoolFrom();
+  Ion::Storage::FileSystem::sharedFileSystem()->destroyAllRecords();
+}
+
+}
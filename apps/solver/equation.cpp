@@ -1,4 +1,5 @@
 #include "equation.h"
+#include "solver_context.h"
 #include <apps/global_preferences.h>
 #include <apps/shared/poincare_helpers.h>
 #include <poincare/boolean.h>
@@ -33,9 +34,10 @@ Expression Equation::Model::standardForm(const Storage::Record * record, Context
   EmptyContext emptyContext;
   Context * contextToUse = replaceFunctionsButNotSymbols ? &emptyContext : context;
 
-  // Reduce the expression
+  /* Reduce the expression. Equations are always solved within a
+   * SolverContext, whose reductions can be shared with the global context. */
   Expression simplifiedInput = expressionInputWithoutFunctions;
-  PoincareHelpers::CloneAndSimplify(&simplifiedInput, contextToUse, reductionTarget);
+  PoincareHelpers::CloneAndSimplifyWithReductionCache(&simplifiedInput, replaceFunctionsButNotSymbols ? &emptyContext : static_cast<SolverContext *>(context)->reductionContext(), reductionTarget);
 
   if (simplifiedInput.type() == ExpressionNode::Type::Nonreal) {
     returnedExpression = Nonreal::Builder();
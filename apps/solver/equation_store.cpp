@@ -94,6 +94,10 @@ void EquationStore::approximateSolve(Poincare::Context * context, bool shouldRep
   double start = m_intervalApproximateSolutions[0];
   double end = m_intervalApproximateSolutions[1];
   assert(start <= end);
+  if (approximatePolynomialSolve(undevelopedExpression, start, end, context)) {
+    return;
+  }
+
   Poincare::Solver<double> solver = PoincareHelpers::Solver(start, end, m_variables[0], context);
   solver.stretch();
 
@@ -117,6 +121,39 @@ void EquationStore::approximateSolve(Poincare::Context * context, bool shouldRep
   }
 }
 
+bool EquationStore::approximatePolynomialSolve(const Expression & e, double start, double end, Context * context) {
+  /* Polynomials whose degree is too high to be solved exactly have all their
+   * roots approximated at once, instead of sweeping the interval. */
+  double coefficients[Polynomial::k_maxApproximatedDegree + 1];
+  int degree = Polynomial::ApproximateCoefficients(e, m_variables[0], coefficients, context, updatedComplexFormat(context), Preferences::sharedPreferences()->angleUnit());
+  if (degree <= Expression::k_maxPolynomialDegree) {
+    return false;
+  }
+  double roots[Polynomial::k_maxApproximatedDegree];
+  int numberOfRoots = Polynomial::ApproximateRealRoots(coefficients, degree, roots);
+  if (numberOfRoots < 0) {
+    return false;
+  }
+  for (int i = 0; i < numberOfRoots; i++) {
+    double root = roots[i];
+    // Keep the roots on the bounds which have been approximated out of them
+    if (root < start && start - root <= Poincare::Solver<double>::NullTolerance(start)) {
+      root = start;
+    } else if (root > end && root - end <= Poincare::Solver<double>::NullTolerance(end)) {
+      root = end;
+    }
+    if (root < start || root > end) {
+      continue;
+    }
+    if (m_numberOfSolutions == k_maxNumberOfApproximateSolutions) {
+      m_hasMoreThanMaxNumberOfApproximateSolution = true;
+      break;
+    }
+    m_approximateSolutions[m_numberOfSolutions++] = root;
+  }
+  return true;
+}
+
 EquationStore::Error EquationStore::exactSolve(Poincare::Context * context, bool * replaceFunctionsButNotSymbols) {
   assert(replaceFunctionsButNotSymbols != nullptr);
   // First, solve the equation using predefined variables if there are
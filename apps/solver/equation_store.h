@@ -95,6 +95,9 @@ private:
 
   Error privateExactSolve(Poincare::Context * context, bool replaceFunctionsButNotSymbols);
   Error resolveLinearSystem(Poincare::Expression solutions[k_maxNumberOfExactSolutions], Poincare::Expression solutionApproximations[k_maxNumberOfExactSolutions], Poincare::Expression coefficients[k_maxNumberOfEquations][Poincare::Expression::k_maxNumberOfVariables], Poincare::Expression constants[k_maxNumberOfEquations], Poincare::Context * context);
+  /* Approximate the roots of e in [start, end] if it is a polynomial whose
+   * degree is too high to be solved exactly. Return false otherwise. */
+  bool approximatePolynomialSolve(const Poincare::Expression & e, double start, double end, Poincare::Context * context);
   Error oneDimensionalPolynomialSolve(Poincare::Expression solutions[k_maxNumberOfExactSolutions], Poincare::Expression solutionApproximations[k_maxNumberOfExactSolutions], Poincare::Expression polynomialCoefficients[Poincare::Expression::k_maxNumberOfPolynomialCoefficients], Poincare::Context * context);
   void tidySolution(char * treePoolCursor);
   bool isExplicitlyComplex(Poincare::Context * context);
@@ -1,5 +1,6 @@
 #include "list_controller.h"
 #include "app.h"
+#include <apps/apps_container_helper.h>
 #include <poincare/circuit_breaker_checkpoint.h>
 #include <poincare/code_point_layout.h>
 #include <poincare/variable_context.h>
@@ -157,6 +158,7 @@ void ListController::resolveEquations() {
   }
   // Tidy model before checkpoint, during which older TreeNodes can't be altered
   modelStore()->tidyDownstreamPoolFrom();
+  char * treePoolCursor = Poincare::TreePool::sharedPool()->cursor();
   Poincare::CircuitBreakerCheckpoint checkpoint(Ion::CircuitBreaker::CheckpointType::Back);
   if (CircuitBreakerRun(checkpoint)) {
     bool resultWithoutUserDefinedSymbols = false;
@@ -190,6 +192,8 @@ void ListController::resolveEquations() {
     }
   } else {
     modelStore()->tidyDownstreamPoolFrom();
+    // Forget the reductions cached during the interrupted resolution
+    AppsContainerHelper::sharedAppsContainerGlobalContext()->tidyDownstreamPoolFrom(treePoolCursor);
   }
 }
 
@@ -9,6 +9,8 @@ class SolverContext : public Poincare::ContextWithParent {
 public:
   SolverContext(Context * parentContext) : Poincare::ContextWithParent(parentContext) {}
   bool canRemoveUnderscoreToUnits() const override { return false; }
+  // Reductions do not depend on how units are parsed and laid out
+  Context * reductionContext() const { return parentContext(); }
 };
 
 }
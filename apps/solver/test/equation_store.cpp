@@ -129,6 +129,14 @@ QUIZ_CASE(equation_solve) {
 
   assert_solves_to_error("(x-10)^7=0", RequireApproximateSolution);
   assert_solves_numerically_to("(x-10)^7=0", -100, 100, {10});
+
+  // Polynomials of high degree
+  assert_solves_numerically_to("x^8-36x^7+546x^6-4536x^5+22449x^4-67284x^3+118124x^2-109584x+40320=0", -10, 10, {1, 2, 3, 4, 5, 6, 7, 8});
+  assert_solves_numerically_to("x^8-36x^7+546x^6-4536x^5+22449x^4-67284x^3+118124x^2-109584x+40320=0", 2.5, 6, {3, 4, 5, 6});
+  assert_solves_numerically_to("x^8+x^2+1=0", -10, 10, {});
+  assert_solves_numerically_to("x^5=x", -10, 10, {-1, 0, 1});
+  assert_solves_numerically_to("(x^2-2)^3×(x^2+1)=0", -10, 10, {-1.414214, 1.414214});
+  assert_solves_numerically_to("x^6-1.001x^5=0", -10, 10, {0, 1.001});
 }
 
 
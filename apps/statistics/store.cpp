@@ -468,6 +468,24 @@ bool Store::updateSeries(int series, bool delayUpdate, bool updateDisplayAdditio
   return DoublePairStore::updateSeries(series, delayUpdate, updateDisplayAdditionalColumn);
 }
 
+bool Store::updateSeriesAfterReplacingValue(int series, int i, int j, bool delayUpdate) {
+  int numberOfValues = lengthOfColumn(series, 0);
+  if (delayUpdate || lengthOfColumn(series, 1) != numberOfValues) {
+    return updateSeries(series, delayUpdate);
+  }
+  m_memoizedMaxNumberOfModes = -1;
+  // The total weight is needed to update the validity of the series
+  m_datasets[series].setWeightHasBeenModified();
+  bool success = DoublePairStore::updateSeries(series);
+  if (!success || lengthOfColumn(series, 0) != numberOfValues || lengthOfColumn(series, 1) != numberOfValues) {
+    // Pairs have been deleted or the lists have been restored from the storage
+    m_datasets[series].setHasBeenModified();
+  } else if (i == 0) {
+    m_datasets[series].setValueHasBeenModified(j);
+  }
+  return success;
+}
+
 double Store::sumOfValuesBetween(int series, double x1, double x2, bool strictUpperBound) const {
   if (!seriesIsValid(series)) {
     return NAN;
@@ -126,6 +126,7 @@ public:
   }
   bool updateSeries(int series, bool delayUpdate = false, bool updateDisplayAdditionalColumn = true) override;
 private:
+  bool updateSeriesAfterReplacingValue(int series, int i, int j, bool delayUpdate) override;
   constexpr static I18n::Message k_quantilesName[k_numberOfQuantiles] = {
     I18n::Message::StatisticsBoxLowerWhisker,
     I18n::Message::FirstQuartile,
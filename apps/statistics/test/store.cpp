@@ -1038,6 +1038,62 @@ QUIZ_CASE(data_statistics_multiple_series) {
   setStoreData(&store, {}, {}, 0, 2);
 }
 
+QUIZ_CASE(data_statistics_edit_single_values) {
+  GlobalContext context;
+  UserPreferences userPreferences;
+  Store store(&context, &userPreferences);
+
+  constexpr int listLength = 40;
+  double v[listLength];
+  double n[listLength];
+  uint32_t seed = 1;
+  for (int i = 0; i < listLength; i++) {
+    seed = seed * 1103515245 + 12345;
+    v[i] = static_cast<double>((seed >> 16) % 20);
+    n[i] = static_cast<double>((seed >> 8) % 3);
+  }
+  setStoreData(&store, v, n, listLength, k_defaultSeriesIndex);
+  // Build the sorted index
+  store.median(k_defaultSeriesIndex);
+  store.firstQuartile(k_defaultSeriesIndex);
+
+  constexpr int numberOfFrequencies = 5;
+  constexpr double frequencies[numberOfFrequencies] = {0.0, 0.25, 0.5, 0.75, 1.0};
+  for (int edit = 0; edit < 60; edit++) {
+    seed = seed * 1103515245 + 12345;
+    int j = (seed >> 16) % listLength;
+    int i = edit % 3 == 0 ? 1 : 0;
+    double value = static_cast<double>((seed >> 8) % (i == 0 ? 20 : 3));
+    store.set(value, k_defaultSeriesIndex, i, j);
+    (i == 0 ? v : n)[j] = value;
+
+    // Sums of values rely on the order of the sorted index
+    for (int threshold = 0; threshold < 20; threshold++) {
+      double expectedSum = 0.0;
+      for (int k = 0; k < listLength; k++) {
+        expectedSum += v[k] < threshold ? n[k] : 0.0;
+      }
+      quiz_assert(store.sumOfValuesBetween(k_defaultSeriesIndex, -1.0, threshold) == expectedSum);
+    }
+
+    // Compare with a new dataset, selecting then sorting
+    FloatList<double> values = FloatList<double>::Builder();
+    FloatList<double> weights = FloatList<double>::Builder();
+    for (int k = 0; k < listLength; k++) {
+      values.addValueAtIndex(v[k], k);
+      weights.addValueAtIndex(n[k], k);
+    }
+    for (double frequency : frequencies) {
+      StatisticsDataset<double> dataset(&values, &weights);
+      double selected = dataset.sortedElementAtCumulatedFrequency(frequency, true);
+      quiz_assert(selected == dataset.sortedElementAtCumulatedFrequency(frequency, true));
+      if (frequency == 0.5) {
+        quiz_assert(store.median(k_defaultSeriesIndex) == selected);
+      }
+    }
+  }
+}
+
 QUIZ_CASE(data_statistics_histograms) {
   GlobalContext context;
   UserPreferences userPreferences;
@@ -2,6 +2,7 @@
 #include <ion/timing.h>
 #include <ion/display.h>
 #include "../../../poincare/include/poincare/print_int.h"
+#include "../../../poincare/include/poincare/tree_pool.h"
 #include <assert.h>
 
 namespace Ion {
@@ -61,11 +62,15 @@ Event getEvent(int * timeout) {
   static int scenarioIndex = 0;
   static int eventIndex = 0;
   static uint64_t startTime = Ion::Timing::millis();
+  static uint32_t startAllocations = Poincare::TreePool::sharedPool()->numberOfAllocations();
   static int timings[numberOfScenari];
+  static uint32_t allocations[numberOfScenari];
   if (eventIndex >= scenarios[scenarioIndex].numberOfEvents()) {
+    allocations[scenarioIndex] = Poincare::TreePool::sharedPool()->numberOfAllocations() - startAllocations;
     timings[scenarioIndex++] = Ion::Timing::millis() - startTime;
     eventIndex = 0;
     startTime = Ion::Timing::millis();
+    startAllocations = Poincare::TreePool::sharedPool()->numberOfAllocations();
   }
   if (scenarioIndex >= numberOfScenari) {
     // Display results
@@ -82,7 +87,10 @@ Event getEvent(int * timeout) {
       Poincare::PrintInt::Left(timings[i], buffer, bufferLength);
       //buffer[50-1-3] = 0; // convert from ms to s without generating _udivmoddi4 (long long division)
       ctx->drawString(scenarios[i].name(), KDPoint(0, line_y), font);
-      ctx->drawString(buffer, KDPoint(200, line_y), font);
+      ctx->drawString(buffer, KDPoint(160, line_y), font);
+      // Number of pool nodes allocated by the scenario
+      Poincare::PrintInt::Left(allocations[i], buffer, bufferLength);
+      ctx->drawString(buffer, KDPoint(220, line_y), font);
       line_y += line_height;
     }
     while (1) {
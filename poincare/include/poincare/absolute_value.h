@@ -26,8 +26,8 @@ public:
   TrinaryBoolean isNull(Context * context) const override { return childAtIndex(0)->isNull(context); }
 
   // Approximation
-  template<typename T> static Complex<T> computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
-    return Complex<T>::Builder(std::abs(c));
+  template<typename T> static std::complex<T> computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+    return std::complex<T>(std::abs(c));
   }
   Evaluation<float> approximate(SinglePrecision p, const ApproximationContext& approximationContext) const override {
     return ApproximationHelper::MapOneChild<float>(this, approximationContext, computeOnComplex<float>);
@@ -35,6 +35,12 @@ public:
   Evaluation<double> approximate(DoublePrecision p, const ApproximationContext& approximationContext) const override {
     return ApproximationHelper::MapOneChild<double>(this, approximationContext, computeOnComplex<double>);
   }
+  std::complex<float> approximateToComplex(SinglePrecision p, const ApproximationContext& approximationContext) const override {
+    return ApproximationHelper::MapOneChildToComplex<float>(this, approximationContext, computeOnComplex<float>);
+  }
+  std::complex<double> approximateToComplex(DoublePrecision p, const ApproximationContext& approximationContext) const override {
+    return ApproximationHelper::MapOneChildToComplex<double>(this, approximationContext, computeOnComplex<double>);
+  }
 
   // Layout
   Layout createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits, Context * context) const override;
@@ -29,7 +29,7 @@ public:
   int getPolynomialCoefficients(Context * context, const char * symbolName, Expression coefficients[]) const override;
 
   // Evaluation
-  template<typename T> static Complex<T> computeOnComplex(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat) { return Complex<T>::Builder(c+d); }
+  template<typename T> static std::complex<T> computeOnComplex(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat) { return c+d; }
   template<typename T> static MatrixComplex<T> computeOnMatrices(const MatrixComplex<T> m, const MatrixComplex<T> n, Preferences::ComplexFormat complexFormat) {
     return ApproximationHelper::ElementWiseOnMatrices(m, n, complexFormat, computeOnComplex<T>);
   }
@@ -75,6 +75,12 @@ private:
   Evaluation<double> approximate(DoublePrecision p, const ApproximationContext& approximationContext) const override {
     return ApproximationHelper::MapReduce<double>(this, approximationContext, Compute<double>);
   }
+  std::complex<float> approximateToComplex(SinglePrecision p, const ApproximationContext& approximationContext) const override {
+    return ApproximationHelper::MapReduceToComplex<float>(this, approximationContext, computeOnComplex<float>);
+  }
+  std::complex<double> approximateToComplex(DoublePrecision p, const ApproximationContext& approximationContext) const override {
+    return ApproximationHelper::MapReduceToComplex<double>(this, approximationContext, computeOnComplex<double>);
+  }
 
   // Properties
   bool displayImplicitAdditionBetweenUnits(Layout l) const;
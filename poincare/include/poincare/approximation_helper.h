@@ -24,13 +24,15 @@ namespace ApproximationHelper {
   template<typename T> Evaluation<T> Map(const ExpressionNode * expression, const ApproximationContext& approximationContext, ComplexesCompute<T> compute, BooleansCompute<T> booleansCompute = UndefinedOnBooleans, bool mapOnList = true, void * context = nullptr);
 
   // Map on one child
-  template <typename T> using ComplexCompute = Complex<T>(*)(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit);
+  template <typename T> using ComplexCompute = std::complex<T>(*)(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit);
   template <typename T> using BooleanCompute = Evaluation<T>(*)(const bool b);
   template <typename T> Evaluation<T> UndefinedOnBoolean(const bool b) { return Complex<T>::Undefined(); }
   template<typename T> Evaluation<T> MapOneChild(const ExpressionNode * expression, const ApproximationContext& approximationContext, ComplexCompute<T> compute, BooleanCompute<T> booleanCompute = UndefinedOnBoolean, bool mapOnList = true);
+  // Scalar counterpart of MapOneChild, see ExpressionNode::approximateToComplex
+  template<typename T> std::complex<T> MapOneChildToComplex(const ExpressionNode * expression, const ApproximationContext& approximationContext, ComplexCompute<T> compute);
 
   // Lambda computation function
-  template <typename T> using ComplexAndComplexReduction = Complex<T>(*)(const std::complex<T> c1, const std::complex<T> c2, Preferences::ComplexFormat complexFormat);
+  template <typename T> using ComplexAndComplexReduction = std::complex<T>(*)(const std::complex<T> c1, const std::complex<T> c2, Preferences::ComplexFormat complexFormat);
   template <typename T> using ComplexAndMatrixReduction = MatrixComplex<T>(*)(const std::complex<T> c, const MatrixComplex<T> m, Preferences::ComplexFormat complexFormat);
   template <typename T> using MatrixAndComplexReduction = MatrixComplex<T>(*)(const MatrixComplex<T> m, const std::complex<T> c, Preferences::ComplexFormat complexFormat);
   template <typename T> using MatrixAndMatrixReduction = MatrixComplex<T>(*)(const MatrixComplex<T> m, const MatrixComplex<T> n, Preferences::ComplexFormat complexFormat);
@@ -66,6 +68,12 @@ namespace ApproximationHelper {
       const ApproximationContext& approximationContext,
       ReductionFunction<T> reductionFunction
       );
+  // Scalar counterpart of MapReduce, see ExpressionNode::approximateToComplex
+  template<typename T> std::complex<T> MapReduceToComplex(
+      const ExpressionNode * expression,
+      const ApproximationContext& approximationContext,
+      ComplexAndComplexReduction<T> computeOnComplexes
+      );
 
   template<typename T> MatrixComplex<T> ElementWiseOnMatrixAndComplex(const MatrixComplex<T> n, std::complex<T> c, Preferences::ComplexFormat complexFormat, ComplexAndComplexReduction<T> computeOnComplexes);
   template<typename T> MatrixComplex<T> ElementWiseOnMatrices(const MatrixComplex<T> m, const MatrixComplex<T> n, Preferences::ComplexFormat complexFormat, ComplexAndComplexReduction<T> computeOnComplexes);
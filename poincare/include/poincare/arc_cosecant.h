@@ -22,7 +22,7 @@ public:
   // Properties
   Type type() const override { return Type::ArcCosecant; }
 
-  template<typename T> static Complex<T> computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit = Preferences::AngleUnit::Radian);
+  template<typename T> static std::complex<T> computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit = Preferences::AngleUnit::Radian);
 
 private:
   // Layout
@@ -39,6 +39,12 @@ private:
   Evaluation<double> approximate(DoublePrecision p, const ApproximationContext& approximationContext) const override {
     return ApproximationHelper::MapOneChild<double>(this, approximationContext, computeOnComplex<double>);
   }
+  std::complex<float> approximateToComplex(SinglePrecision p, const ApproximationContext& approximationContext) const override {
+    return ApproximationHelper::MapOneChildToComplex<float>(this, approximationContext, computeOnComplex<float>);
+  }
+  std::complex<double> approximateToComplex(DoublePrecision p, const ApproximationContext& approximationContext) const override {
+    return ApproximationHelper::MapOneChildToComplex<double>(this, approximationContext, computeOnComplex<double>);
+  }
 };
 
 class ArcCosecant final : public ExpressionOneChild<ArcCosecant, ArcCosecantNode> {
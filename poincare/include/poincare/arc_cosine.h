@@ -28,6 +28,8 @@ public:
   }
   Type type() const override { return Type::ArcCosine; }
 
+  template<typename T> static std::complex<T> computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit);
+
 private:
   // Layout
   Layout createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits, Context * context) const override;
@@ -43,13 +45,18 @@ private:
   Expression unaryFunctionDifferential(const ReductionContext& reductionContext) override;
 
   //Evaluation
-  template<typename T> static Complex<T> computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit);
   Evaluation<float> approximate(SinglePrecision p, const ApproximationContext& approximationContext) const override {
     return ApproximationHelper::MapOneChild<float>(this, approximationContext, computeOnComplex<float>);
   }
   Evaluation<double> approximate(DoublePrecision p, const ApproximationContext& approximationContext) const override {
     return ApproximationHelper::MapOneChild<double>(this, approximationContext, computeOnComplex<double>);
   }
+  std::complex<float> approximateToComplex(SinglePrecision p, const ApproximationContext& approximationContext) const override {
+    return ApproximationHelper::MapOneChildToComplex<float>(this, approximationContext, computeOnComplex<float>);
+  }
+  std::complex<double> approximateToComplex(DoublePrecision p, const ApproximationContext& approximationContext) const override {
+    return ApproximationHelper::MapOneChildToComplex<double>(this, approximationContext, computeOnComplex<double>);
+  }
 };
 
 class ArcCosine final : public ExpressionOneChild<ArcCosine, ArcCosineNode> {
@@ -19,7 +19,12 @@ public:
   template<typename T> static Evaluation<T> GCD(const ExpressionNode & expressionNode, const ApproximationContext& approximationContext);
   template<typename T> static Evaluation<T> LCM(const ExpressionNode & expressionNode, const ApproximationContext& approximationContext);
 
-  constexpr static int k_numberOfPrimeFactors = 1000;
+  /* When decomposing an integer into primes factors, we look for its prime
+   * factors among the k_numberOfPrimeFactors primes below k_biggestPrimeFactor
+   * and then split the remaining cofactor with Pollard's rho algorithm. */
+  constexpr static int k_biggestPrimeFactor = 1 << 16;
+  constexpr static int k_numberOfPrimeFactors = 6542;
+  constexpr static int k_maxNumberOfPollardRhoIterations = 1 << 20;
   constexpr static int k_maxNumberOfFactors = 32;
   constexpr static int k_maxNumberOfDivisors = 2 * k_maxNumberOfFactors;
   constexpr static int k_errorTooManyFactors = -1;
@@ -34,7 +39,7 @@ public:
 
   /* When output is negative that indicates a special case:
    *  - -1 : too many factors.
-   *  - -2 : a prime factor is too big.
+   *  - -2 : a cofactor is too big to be factorized.
    * Before calling PrimeFactorization, we instantiate an Arithmetic object.
    * Outputs are retrieved using (factor|coefficient|divisor)AtIndex(index)
    * methods. */
@@ -62,9 +67,8 @@ public:
   }
 
 private:
-  /* When decomposing an integer into primes factors, we look for its prime
-   * factors among integer from 2 to 10000. */
-  constexpr static int k_biggestPrimeFactor = 10000;
+  bool addFactor(const Integer & factor, const Integer & coefficient, int * numberOfFactors);
+  int factorizeCofactor(const Integer & m, const Integer & coefficient, int * numberOfFactors, int * remainingIterations);
   static Arithmetic * s_lock;
   /* The following methods are equivalent to a simple static array declaration
    * in the header and an initialization in the source file. However, as Integer
@@ -9,7 +9,7 @@ namespace Poincare {
 
 class BasedIntegerNode final : public NumberNode {
 public:
-  BasedIntegerNode(const native_uint_t * digits, uint8_t size, OMG::Base base);
+  BasedIntegerNode(const uint32_t * words, uint8_t size, OMG::Base base);
 
   Integer integer() const;
   OMG::Base base() const { return m_base; }
@@ -40,6 +40,8 @@ public:
   // Approximation
   Evaluation<float> approximate(SinglePrecision p, const ApproximationContext& approximationContext) const override { return Complex<float>::Builder(templatedApproximate<float>()); }
   Evaluation<double> approximate(DoublePrecision p, const ApproximationContext& approximationContext) const override { return Complex<double>::Builder(templatedApproximate<double>()); }
+  std::complex<float> approximateToComplex(SinglePrecision p, const ApproximationContext& approximationContext) const override { return ComplexNode<float>::Normalize(templatedApproximate<float>()); }
+  std::complex<double> approximateToComplex(DoublePrecision p, const ApproximationContext& approximationContext) const override { return ComplexNode<double>::Normalize(templatedApproximate<double>()); }
   template<typename T> T templatedApproximate() const;
 
 private:
@@ -47,8 +49,8 @@ private:
   Expression shallowReduce(const ReductionContext& reductionContext) override;
   LayoutShape leftLayoutShape() const override { return m_base == OMG::Base::Decimal ? LayoutShape::Integer : LayoutShape::Default; }
   OMG::Base m_base;
-  uint8_t m_numberOfDigits;
-  native_uint_t m_digits[0];
+  uint8_t m_numberOfWords;
+  uint32_t m_words[0]; // See Integer::words
 };
 
 class BasedInteger final : public Number {
@@ -32,7 +32,11 @@ class Checkpoint {
 public:
   static TreeNode * TopmostEndOfPool();
 
-  Checkpoint() : m_parent(s_topmost), m_endOfPool(TreePool::sharedPool()->last()) {
+  Checkpoint() :
+    m_parent(s_topmost),
+    m_endOfPool(TreePool::sharedPool()->last()),
+    m_reductionStepBudget(ReductionStepBudget())
+  {
     assert(!m_parent || m_endOfPool >= m_parent->m_endOfPool);
   }
   Checkpoint(const Checkpoint &) = delete;
@@ -44,15 +48,27 @@ public:
 protected:
   static Checkpoint * s_topmost;
 
-  void rollback() const { TreePool::sharedPool()->freePoolFromNode(m_endOfPool); }
+  /* Rolling back out of the reduction that owns the reduction step budget
+   * disarms it, which the jump would otherwise leave armed. Nested rollbacks
+   * keep the budget as is, so that an exhausted budget reaches its owner. */
+  void rollback() const {
+    TreePool::sharedPool()->freePoolFromNode(m_endOfPool);
+    if (m_reductionStepBudget < 0) {
+      SetReductionStepBudget(-1);
+    }
+  }
   void protectedDiscard() const;
 
   Checkpoint * const m_parent;
 
 private:
+  static int ReductionStepBudget();
+  static void SetReductionStepBudget(int budget);
+
   virtual void rollbackException();
 
   TreeNode * const m_endOfPool;
+  const int m_reductionStepBudget;
 };
 
 }
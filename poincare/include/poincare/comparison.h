@@ -38,6 +38,7 @@ public:
   static bool IsComparisonWithoutNotEqualOperator(Expression e); // Return false if one of the operator is NotEqual
 
   static TrinaryBoolean TruthValueOfOperator(OperatorType type, TrinaryBoolean chidlrenAreEqual, TrinaryBoolean leftChildIsGreater);
+  template<typename T> static TrinaryBoolean TruthValueOfComplexes(OperatorType type, std::complex<T> leftChild, std::complex<T> rightChild);
 
   //Tree
   size_t size() const override;
@@ -0,0 +1,161 @@
+#ifndef POINCARE_COMPILED_EXPRESSION_H
+#define POINCARE_COMPILED_EXPRESSION_H
+
+#include <poincare/expression.h>
+#include <complex>
+
+namespace Poincare {
+
+/* A CompiledExpression flattens reduced expressions of a single variable into
+ * a postfix program for a small stack machine. Once compiled, the program can
+ * be approximated in float or double for any value of the variable without
+ * walking the TreePool nor building a VariableContext, which makes it suited
+ * to the hot loops of curve drawing, solvers and quadratures.
+ *
+ * Subtrees which do not depend on the variable are approximated once at
+ * compilation and stored as constants. The other nodes are turned into
+ * instructions calling the same computeOnComplex methods as their
+ * approximate implementation, so that both paths return the same results.
+ * Only scalar nodes are handled: compile returns false on anything else
+ * (lists, matrices, parametered expressions of the variable, random nodes,
+ * undefined symbols...) and callers must then fall back on the tree
+ * approximation.
+ *
+ * Up to k_maxNumberOfRoutines expressions can be compiled together (for
+ * instance both coordinates of a parametric curve). They share the constants
+ * and instructions buffers and are approximated by their index.
+ *
+ * The approximation context (context, complex format and angle unit) is fixed
+ * at compilation: a CompiledExpression must be invalidated alongside the
+ * expressions it was compiled from, and recompiled if preferences change. */
+
+class CompiledExpression {
+public:
+  constexpr static int k_maxNumberOfRoutines = 2;
+  // Number of values approximated together by approximateBatch
+  constexpr static int k_batchSize = 16;
+  constexpr static int k_maxDerivativeOrder = 4;
+
+  CompiledExpression() { invalidate(); }
+
+  bool compile(const Expression * expressions, int numberOfExpressions, const char * symbol, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit);
+  bool compile(const Expression expression, const char * symbol, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+    return compile(&expression, 1, symbol, context, complexFormat, angleUnit);
+  }
+  void invalidate() { m_numberOfRoutines = k_notCompiled; }
+  bool isCompiled() const { return m_numberOfRoutines > 0; }
+  // A failed compilation is remembered to avoid retrying it on every call
+  bool needsCompilationFor(Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+    return m_numberOfRoutines == k_notCompiled || m_complexFormat != complexFormat || m_angleUnit != angleUnit;
+  }
+
+  /* Equivalent to expression.approximateWithValueForSymbol(symbol, x, ...) on
+   * the expression of index routineIndex given at compilation. */
+  template<typename T> T approximateWithValue(T x, int routineIndex = 0) const;
+  /* Equivalent to approximating the expression within a parent approximation,
+   * as ParameteredExpressionNode::approximateFirstChildWithArgument does: the
+   * encountered complex flag is not reset and the complex result is kept. */
+  template<typename T> std::complex<T> approximateWithinParent(T x, int routineIndex = 0) const;
+  /* Set ys[i] to approximateWithValue(xs[i], routineIndex) for i < n. Each
+   * instruction is run once for k_batchSize values, on contiguous arrays. */
+  template<typename T> void approximateBatch(const T * xs, T * ys, int n, int routineIndex = 0) const;
+  /* Set derivatives[k] to the k-th derivative of the routine at x for
+   * k <= order, propagating truncated Taylor series through the program
+   * (forward mode automatic differentiation). Return false if the routine is
+   * not smooth around x, such as floor(x) or piecewise(...), or if a value is
+   * undefined or not real: the tree must then be used instead. */
+  template<typename T> bool approximateDerivatives(T x, int order, T * derivatives, int routineIndex = 0) const;
+
+  template<typename T>
+  struct Enclosure {
+    T min;
+    T max;
+    /* The routine is defined and continuous on the whole interval. Otherwise
+     * the bounds are infinite, or undefined if so is the routine. */
+    bool isContinuous;
+  };
+  /* Enclose the values of the routine for x in [xMin, xMax] with interval
+   * arithmetic: each instruction maps the intervals of its operands to an
+   * interval containing all of its results. Piecewise branches are only
+   * followed if their condition has the same value on the whole interval, and
+   * integer-valued functions such as floor(x) are only continuous where they
+   * are constant. Return false if the routine cannot be enclosed, as with
+   * complex formats other than Real. Rounding errors are not accounted for,
+   * which is harmless at the scale of a pixel. */
+  template<typename T> bool approximateOnInterval(T xMin, T xMax, Enclosure<T> * enclosure, int routineIndex = 0) const;
+
+  // Solver<T>::FunctionEvaluation compatible wrapper on the first routine
+  template<typename T> static T ApproximateWithValue(T x, const void * compiledExpression) {
+    return static_cast<const CompiledExpression *>(compiledExpression)->approximateWithValue<T>(x);
+  }
+
+private:
+  constexpr static int8_t k_notCompiled = -1;
+  constexpr static int k_maxNumberOfInstructions = 40;
+  constexpr static int k_maxNumberOfConstants = 10;
+  constexpr static int k_maxStackDepth = 8;
+  constexpr static uint8_t k_noOperand = UINT8_MAX;
+
+  enum class OpCode : uint8_t {
+    // Push the value of the variable
+    Variable,
+    // Push the constant of index operand
+    Constant,
+    // Pop two values and push the result of the operation
+    Addition,
+    Multiplication,
+    Subtraction,
+    Division,
+    // Operand is the index of the (p, q) constant of a rational index, or k_noOperand
+    Power,
+    // Logarithm of the first value in the base of the second one
+    Logarithm,
+    // Pop one value and push the result of the operation
+    Opposite,
+    // Operand is the ExpressionNode::Type of the function
+    Function,
+    // Pop two values and push 1 if the ComparisonNode::OperatorType operand holds, 0 otherwise
+    Comparison,
+    Pop,
+    // Jump to the instruction of index operand
+    Jump,
+    // Pop a value and jump if it is not 1
+    JumpIfNotTrue,
+    // Replace the top value with undefined and jump if it is undefined
+    JumpIfUndefined,
+    Return,
+  };
+
+  struct Instruction {
+    OpCode opCode;
+    uint8_t operand;
+  };
+
+  class Compiler;
+
+  template<typename T> const std::complex<T> * constants() const;
+  // b is ignored by unary operations
+  template<typename T> std::complex<T> computeOperation(Instruction instruction, std::complex<T> a, std::complex<T> b = 0) const;
+  // Return false if the operation has no real fast path
+  template<typename T> static bool ComputeRealOperation(OpCode opCode, T a, T b, std::complex<T> * result);
+  template<typename T> void approximateSingleBatch(const T * xs, T * ys, int n, int routineIndex) const;
+  // Replace series a with the series of the operation, or return false
+  template<typename T> bool differentiateBinaryOperation(Instruction instruction, T * a, const T * b, int n) const;
+  template<typename T> bool differentiateFunction(ExpressionNode::Type type, T * a, int n) const;
+  /* Replace interval a with the interval of the operation, or return false.
+   * isContinuous is set to false if the operation may not be continuous. */
+  template<typename T> bool encloseBinaryOperation(Instruction instruction, T * a, const T * b, bool * isContinuous) const;
+  template<typename T> bool encloseFunction(ExpressionNode::Type type, T * a, bool * isContinuous) const;
+
+  Instruction m_instructions[k_maxNumberOfInstructions];
+  std::complex<float> m_floatConstants[k_maxNumberOfConstants];
+  std::complex<double> m_doubleConstants[k_maxNumberOfConstants];
+  uint8_t m_routineStarts[k_maxNumberOfRoutines];
+  int8_t m_numberOfRoutines;
+  Preferences::ComplexFormat m_complexFormat;
+  Preferences::AngleUnit m_angleUnit;
+};
+
+}
+
+#endif
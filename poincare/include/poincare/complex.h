@@ -12,6 +12,9 @@ template<typename T>
 class ComplexNode final : public EvaluationNode<T>, public std::complex<T> {
 public:
   static T ToScalar(const std::complex<T> c);
+  /* Replace -0 with 0 and record non-real values as building a ComplexNode
+   * does. Approximations which do not build nodes call it on each result. */
+  static std::complex<T> Normalize(std::complex<T> c);
   ComplexNode(std::complex<T> c);
 
   std::complex<T> complexAtIndex(int index) const override {
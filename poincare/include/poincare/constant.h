@@ -38,8 +38,10 @@ public:
   Layout createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits, Context * context) const override;
 
   /* Approximation */
-  Evaluation<float> approximate(SinglePrecision p, const ApproximationContext& approximationContext) const override { return templatedApproximate<float>(); }
-  Evaluation<double> approximate(DoublePrecision p, const ApproximationContext& approximationContext) const override { return templatedApproximate<double>(); }
+  Evaluation<float> approximate(SinglePrecision p, const ApproximationContext& approximationContext) const override { return Complex<float>::Builder(templatedApproximate<float>()); }
+  Evaluation<double> approximate(DoublePrecision p, const ApproximationContext& approximationContext) const override { return Complex<double>::Builder(templatedApproximate<double>()); }
+  std::complex<float> approximateToComplex(SinglePrecision p, const ApproximationContext& approximationContext) const override { return ComplexNode<float>::Normalize(templatedApproximate<float>()); }
+  std::complex<double> approximateToComplex(DoublePrecision p, const ApproximationContext& approximationContext) const override { return ComplexNode<double>::Normalize(templatedApproximate<double>()); }
 
   constexpr static const char * k_exponentialEName = "e";
   constexpr static const char * k_complexIName = "i";
@@ -99,7 +101,7 @@ public:
   bool derivate(const ReductionContext& reductionContext, Symbol symbol, Expression symbolValue) override;
 private:
   int rankOfConstant() const { return constantInfo().m_comparisonRank; }
-  template<typename T> Evaluation<T> templatedApproximate() const;
+  template<typename T> std::complex<T> templatedApproximate() const;
 
   const ConstantInfo * m_constantInfo;
 };
@@ -8,6 +8,7 @@
 namespace Poincare {
 
 class Expression;
+class ExpressionNode;
 class SymbolAbstract;
 class ContextWithParent;
 
@@ -24,6 +25,10 @@ public:
   virtual SymbolAbstractType expressionTypeForIdentifier(const char * identifier, int length) = 0;
   const Expression expressionForSymbolAbstract(const SymbolAbstract & symbol, bool clone);
   virtual bool setExpressionForSymbolAbstract(const Expression & expression, const SymbolAbstract & symbol) = 0;
+  /* Return the node of the expression defining symbol if it can be
+   * approximated where it is stored, without being copied into the pool, or
+   * nullptr. The node can only be read, and only until the context changes. */
+  virtual const ExpressionNode * approximableNodeForSymbol(const SymbolAbstract & symbol) { return nullptr; }
   virtual void tidyDownstreamPoolFrom(char * treePoolCursor = nullptr) {}
   virtual bool canRemoveUnderscoreToUnits() const { return true; }
 protected:
@@ -9,8 +9,8 @@ namespace Poincare {
 /* The decimal 0.01234 is stored as:
  *  - bool m_negative = false
  *  - int m_exponent = -2
- *  - int m_numberOfDigitsInMantissa = 1
- *  - native_uint_t m_mantissa[] = { 1234 }
+ *  - int m_numberOfWordsInMantissa = 1
+ *  - uint32_t m_mantissa[] = { 1234 }
  */
 
 class Decimal;
@@ -19,7 +19,7 @@ class DecimalNode final : public NumberNode {
   friend class Decimal;
   friend class NumberNode;
 public:
-  DecimalNode(const native_uint_t * mantissaDigits, uint8_t mantissaSize, int exponent, bool negative);
+  DecimalNode(const uint32_t * mantissaWords, uint8_t mantissaSize, int exponent, bool negative);
 
   Integer signedMantissa() const;
   Integer unsignedMantissa() const;
@@ -55,6 +55,12 @@ public:
   Evaluation<double> approximate(DoublePrecision p, const ApproximationContext& approximationContext) const override {
     return Complex<double>::Builder(templatedApproximate<double>());
   }
+  std::complex<float> approximateToComplex(SinglePrecision p, const ApproximationContext& approximationContext) const override {
+    return ComplexNode<float>::Normalize(templatedApproximate<float>());
+  }
+  std::complex<double> approximateToComplex(DoublePrecision p, const ApproximationContext& approximationContext) const override {
+    return ComplexNode<double>::Normalize(templatedApproximate<double>());
+  }
 
   // Comparison
   /* Warning: Decimal(mantissa: 1000, exponent: 3) and Decimal(mantissa: 1, exponent: 3)
@@ -80,8 +86,8 @@ private:
   template<typename T> T templatedApproximate() const;
   bool m_negative;
   int m_exponent;
-  uint8_t m_numberOfDigitsInMantissa;
-  native_uint_t m_mantissa[0];
+  uint8_t m_numberOfWordsInMantissa;
+  uint32_t m_mantissa[0]; // See Integer::words
 };
 
 class Decimal final : public Number {
@@ -29,6 +29,8 @@ public:
   // Evaluation
   Evaluation<float> approximate(SinglePrecision p, const ApproximationContext& approximationContext) const override { return templatedApproximate<float>(approximationContext); }
   Evaluation<double> approximate(DoublePrecision p, const ApproximationContext& approximationContext) const override { return templatedApproximate<double>(approximationContext); }
+  std::complex<float> approximateToComplex(SinglePrecision p, const ApproximationContext& approximationContext) const override { return templatedApproximateToComplex<float>(approximationContext); }
+  std::complex<double> approximateToComplex(DoublePrecision p, const ApproximationContext& approximationContext) const override { return templatedApproximateToComplex<double>(approximationContext); }
 
   // Simplification
   Expression shallowReduce(const ReductionContext& reductionContext) override;
@@ -36,6 +38,7 @@ public:
 
 private:
   template<typename T> Evaluation<T> templatedApproximate(const ApproximationContext& approximationContext) const;
+  template<typename T> std::complex<T> templatedApproximateToComplex(const ApproximationContext& approximationContext) const;
 };
 
 class Dependency : public Expression {
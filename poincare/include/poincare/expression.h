@@ -30,6 +30,7 @@ class Expression : public TreeHandle {
   friend class BinomialCoefficient;
   friend class Ceiling;
   friend class Comparison;
+  friend class CompiledExpression;
   friend class ComplexArgument;
   friend class ComplexCartesian;
   friend class ComplexHelper;
@@ -141,6 +142,7 @@ class Expression : public TreeHandle {
   friend class Unit;
   friend class UnitConvert;
   friend class UnitNode;
+  friend class VariableContext;
   friend class VectorCross;
   friend class VectorDot;
   friend class VectorNorm;
@@ -153,6 +155,10 @@ public:
   Expression clone() const;
   static Expression Parse(char const * string, Context * context, bool addMissingParenthesis = true, bool parseForAssignment = false);
   static Expression ExpressionFromAddress(const void * address, size_t size);
+  /* Return the node of the expression stored at address, without copying it
+   * into the pool, if it can be approximated where it is. Return nullptr
+   * otherwise. */
+  static const ExpressionNode * ApproximableNodeAtAddress(const void * address, size_t size);
 
   /* Hierarchy */
   Expression childAtIndex(int i) const;
@@ -260,11 +266,16 @@ public:
   /* Complex */
   static bool EncounteredComplex();
   static void SetEncounteredComplex(bool encounterComplex);
+  static bool EncounteredNonScalar();
+  static void SetEncounteredNonScalar(bool encounterNonScalar);
   bool hasComplexI(Context * context, SymbolicComputation replaceSymbols = SymbolicComputation::ReplaceAllDefinedSymbolsWithDefinition) const;
   // WARNING: this methods must be called on reduced expressions
   bool isReal(Context * context, bool canContainMatrices = true) const;
 
   static void SetReductionEncounteredUndistributedList(bool encounter);
+  // Negative when no reduction step budget applies
+  static int ReductionStepBudget();
+  static void SetReductionStepBudget(int budget);
 
   /* Comparison */
   /* isIdenticalTo is the "easy" equality, it returns true if both trees have
@@ -274,6 +285,14 @@ public:
   /* isIdenticalToWithoutParentheses behaves as isIdenticalTo, but without
    * taking into account parentheses: e^(0) is identical to e^0. */
   bool isIdenticalToWithoutParentheses(const Expression e) const;
+  /* isStrictlyIdenticalTo also compares the attributes that the simplification
+   * order ignores, such as the arguments of functions, the operators of
+   * comparisons or the dimensions of matrices. Nodes are compared byte by
+   * byte: it can miss identical trees whose nodes have different padding, but
+   * never mistakes different trees for identical ones. */
+  bool isStrictlyIdenticalTo(const Expression e) const;
+  // Identical expressions have the same hash
+  uint16_t hash() const { return node()->hash(); }
   bool containsSameDependency(const Expression e, const ReductionContext& reductionContext) const;
 
   static bool ExactAndApproximateExpressionsAreEqual(Expression exactExpression, Expression approximateExpression);
@@ -346,6 +365,8 @@ public:
   template<typename U> Expression approximateKeepingUnits(const ReductionContext& reductionContext) const;
   template<typename U> U approximateToScalar(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, bool withinReduce = false) const;
   template<typename U> U approximateWithValueForSymbol(const char * symbol, U x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+  // Set ys[i] to approximateWithValueForSymbol(symbol, xs[i], ...) for i < n
+  template<typename U> void approximateBatch(const char * symbol, const U * xs, U * ys, int n, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
 
   /* This class is meant to contain data about named functions (e.g. sin, tan...)
    * in one place: their name, their number of children and a pointer to a builder.
@@ -484,13 +505,13 @@ protected:
    *  was -1, it was removed from the multiplication).
    * Warning: this must be called on reduced expressions
    */
-  Expression shallowBeautify(const ReductionContext& reductionContext) { return node()->shallowBeautify(reductionContext); }
+  Expression shallowBeautify(const ReductionContext& reductionContext);
   Expression makePositiveAnyNegativeNumeralFactor(const ReductionContext& reductionContext);
   Expression denominator(const ReductionContext& reductionContext) const { return node()->denominator(reductionContext); }
   /* shallowReduce takes a copy of reductionContext and not a reference
    * because it might need to modify it during reduction, namely in
    * SimplificationHelper::undefinedOnMatrix */
-  Expression shallowReduce(ReductionContext reductionContext) { return node()->shallowReduce(reductionContext); }
+  Expression shallowReduce(ReductionContext reductionContext);
   Expression deepBeautify(const ReductionContext& reductionContext) { return node()->deepBeautify(reductionContext); }
 
   /* Derivation */
@@ -518,6 +539,11 @@ private:
    * mantissa is stored on 53 bits (2E308 can be stored exactly in IEEE754
    * representation but some smaller integers can't - like 2E308-1). */
   constexpr static double k_largestExactIEEE754Integer = 9007199254740992.0;
+  /* The reductions of cloneAndDeepReduceWithSystemCheckpoint are aborted as
+   * if the pool was full once they called shallowReduce that many times.
+   * Inputs on which the rules thrash thus deterministically fall back on their
+   * approximation, instead of waiting for the user to interrupt them. */
+  constexpr static int k_maxNumberOfReductionSteps = 10000;
   Expression deepReduce(ReductionContext reductionContext);
   void deepReduceChildren(const ReductionContext& reductionContext) {
     node()->deepReduceChildren(reductionContext);
@@ -210,6 +210,16 @@ public:
   constexpr static int k_maxNumberOfSteps = 10000;
   virtual Evaluation<float> approximate(SinglePrecision p, const ApproximationContext& approximationContext) const = 0;
   virtual Evaluation<double> approximate(DoublePrecision p, const ApproximationContext& approximationContext) const = 0;
+  /* approximateToComplex returns the value of approximate on scalars without
+   * building any Evaluation in the pool. The default implementation calls
+   * approximate and raises the EncounteredNonScalar flag on lists, matrices
+   * and booleans, whose value is then meaningless. */
+  virtual std::complex<float> approximateToComplex(SinglePrecision p, const ApproximationContext& approximationContext) const { return defaultApproximateToComplex<float>(approximationContext); }
+  virtual std::complex<double> approximateToComplex(DoublePrecision p, const ApproximationContext& approximationContext) const { return defaultApproximateToComplex<double>(approximationContext); }
+  /* Return true if the expression can be approximated without being in the
+   * pool, that is if no node of the expression is turned into a handle or
+   * reads the context during approximation. */
+  bool canBeApproximatedOutOfPool() const;
 
   /* Simplification */
   /*!*/ void deepReduceChildren(const ReductionContext& reductionContext);
@@ -257,6 +267,10 @@ public:
 #endif
 
 protected:
+  /* Expressions of same simplification order have the same hash. Nodes which
+   * reimplement the simplification order must reimplement computeHash. */
+  uint32_t computeHash() const override;
+  template<typename T> std::complex<T> defaultApproximateToComplex(const ApproximationContext& approximationContext) const;
   /* Hierarchy */
   ExpressionNode * parent() const { return static_cast<ExpressionNode *>(TreeNode::parent()); }
   Direct<ExpressionNode> children() const { return Direct<ExpressionNode>(this); }
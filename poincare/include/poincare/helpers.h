@@ -14,7 +14,6 @@ public:
   typedef bool (*Compare) (int i, int j, void * context, int numberOfElements);
 
   static size_t AlignedSize(size_t realSize, size_t alignment);
-  static size_t Gcd(size_t a, size_t b);
 
   static bool Rotate(uint32_t * dst, uint32_t * src, size_t len);
   static void Sort(Swap swap, Compare compare, void * context, int numberOfElements);
@@ -25,6 +24,10 @@ public:
   static bool ListEvaluationComparisonAtIndex(int i, int j, void * context, int numberOfElements);
   // Return true if observed and expected are approximately equal
   template <typename T> static bool RelativelyEqual(T observed, T expected, T relativeThreshold);
+  /* Return 10^exponent as std::pow(10.0, exponent), but read from a table
+   * for exponents between -22 and 22 (10^22 is the largest power of ten
+   * exactly representable in a double). */
+  static double PowerOfTen(int exponent);
 
   /* FIXME : This can be replaced by std::string_view when moving to C++17 */
   constexpr static bool StringsAreEqual(const char * s1, const char * s2) { return *s1 == *s2 && ((*s1 == '\0' && *s2 =='\0') || StringsAreEqual(s1 + 1, s2 + 1)); }
@@ -20,6 +20,8 @@ public:
 
   // Properties
   Type type() const override { return Type::HyperbolicCosine; }
+
+  template<typename T> static std::complex<T> computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit);
 private:
   // Simplification
   Expression imageOfNotableValue() const override { return Rational::Builder(1); }
@@ -30,13 +32,18 @@ private:
   bool derivate(const ReductionContext& reductionContext, Symbol symbol, Expression symbolValue) override;
   Expression unaryFunctionDifferential(const ReductionContext& reductionContext) override;
   //Evaluation
-  template<typename T> static Complex<T> computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit);
   Evaluation<float> approximate(SinglePrecision p, const ApproximationContext& approximationContext) const override {
     return ApproximationHelper::MapOneChild<float>(this, approximationContext, computeOnComplex<float>);
   }
   Evaluation<double> approximate(DoublePrecision p, const ApproximationContext& approximationContext) const override {
     return ApproximationHelper::MapOneChild<double>(this, approximationContext, computeOnComplex<double>);
   }
+  std::complex<float> approximateToComplex(SinglePrecision p, const ApproximationContext& approximationContext) const override {
+    return ApproximationHelper::MapOneChildToComplex<float>(this, approximationContext, computeOnComplex<float>);
+  }
+  std::complex<double> approximateToComplex(DoublePrecision p, const ApproximationContext& approximationContext) const override {
+    return ApproximationHelper::MapOneChildToComplex<double>(this, approximationContext, computeOnComplex<double>);
+  }
 };
 
 class HyperbolicCosine final : public ExpressionOneChild<HyperbolicCosine, HyperbolicCosineNode, HyperbolicTrigonometricFunction> {
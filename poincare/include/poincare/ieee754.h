@@ -1,6 +1,7 @@
 #ifndef POINCARE_IEEE754_H
 #define POINCARE_IEEE754_H
 
+#include <poincare/helpers.h>
 #include <assert.h>
 #include <stdint.h>
 #include <stddef.h>
@@ -68,7 +69,7 @@ public:
      * in -0.31 < x < 1, we get:
      * e2 = [e1/log(10,2)]  or e2 = [e1/log(10,2)]-1 depending on m1. */
     int exponentBase10 = std::round(exponentBase2/k_log10base2);
-    if (std::pow(static_cast<T>(10.0), exponentBase10) > std::fabs(f)) {
+    if (Helpers::PowerOfTen(exponentBase10) > std::fabs(f)) {
       exponentBase10--;
     }
     return exponentBase10;
@@ -15,15 +15,37 @@ class LayoutNode;
 class Integer;
 struct IntegerDivision;
 
+/* Integers are stored as arrays of native_uint_t digits whose products are
+ * computed on double_native_uint_t. Hosts whose compiler provides 128-bit
+ * integers use 64-bit digits, which divides by four the number of digit
+ * products of a multiplication, and other platforms such as the device use
+ * 32-bit digits. Define POINCARE_INTEGER_DIGIT_SIZE to override this choice.
+ * The signed types only build Integers from machine integers and keep the same
+ * size either way. */
+#ifndef POINCARE_INTEGER_DIGIT_SIZE
+#if defined(__SIZEOF_INT128__) && !__EMSCRIPTEN__
+#define POINCARE_INTEGER_DIGIT_SIZE 64
+#else
+#define POINCARE_INTEGER_DIGIT_SIZE 32
+#endif
+#endif
+
+#if POINCARE_INTEGER_DIGIT_SIZE == 64
+typedef uint32_t half_native_uint_t;
+typedef uint64_t native_uint_t;
+__extension__ typedef unsigned __int128 double_native_uint_t;
+#else
+static_assert(POINCARE_INTEGER_DIGIT_SIZE == 32, "Integer digits are either 32 or 64-bit wide");
 typedef uint16_t half_native_uint_t;
-typedef int32_t native_int_t;
-typedef int64_t double_native_int_t;
 typedef uint32_t native_uint_t;
 typedef uint64_t double_native_uint_t;
+#endif
+typedef int32_t native_int_t;
+typedef int64_t double_native_int_t;
 
-static_assert(sizeof(double_native_int_t) <= sizeof(double_native_uint_t), "double_native_int_t type has not the right size compared to double_native_uint_t");
-static_assert(sizeof(native_int_t) == sizeof(native_uint_t), "native_int_t type has not the right size compared to native_uint_t");
+static_assert(sizeof(native_int_t) <= sizeof(native_uint_t), "native_int_t type has not the right size compared to native_uint_t");
 static_assert(sizeof(double_native_uint_t) == 2*sizeof(native_uint_t), "double_native_uint_t should be twice the size of native_uint_t");
+static_assert(sizeof(native_uint_t) == 2*sizeof(half_native_uint_t), "native_uint_t should be twice the size of half_native_uint_t");
 static_assert(sizeof(double_native_int_t) == 2*sizeof(native_int_t), "double_native_int_t type has not the right size compared to native_int_t");
 
 /* All algorithms should be improved with:
@@ -57,6 +79,7 @@ class Integer final : public TreeHandle {
 public:
   /* Constructors & Destructors */
   static Integer BuildInteger(native_uint_t * digits, uint16_t numberOfDigits, bool negative, bool enableOverflow = false);
+  static Integer BuildIntegerFromWords(const uint32_t * words, uint8_t numberOfWords, bool negative);
   Integer(native_int_t i = 0);
   Integer(double_native_int_t i);
   Integer(const char * digits, size_t length, bool negative, OMG::Base base = OMG::Base::Decimal);
@@ -93,6 +116,10 @@ public:
     }
     return node()->numberOfDigits();
   }
+  /* Expression nodes store integers as little-endian 32-bit words, so that
+   * their size does not depend on the size of the digits. */
+  const uint32_t * words() const { return reinterpret_cast<const uint32_t *>(digits()); }
+  uint8_t numberOfWords() const;
   bool isNegative() const { return m_negative; }
   void setNegative(bool negative) { m_negative = numberOfDigits() > 0 ? negative : false; } // 0 is always positive
 
@@ -157,9 +184,13 @@ public:
   static Expression CreateEuclideanDivision(const Integer & num, const Integer & denom);
   static Expression CreateMixedFraction(const Integer & num, const Integer & denom);
 
-  constexpr static int k_maxNumberOfDigits = 32;
+  constexpr static int k_numberOfBitsInDigit = 8*sizeof(native_uint_t);
+  // Integers are limited to 1024 bits whatever the size of their digits
+  constexpr static int k_maxNumberOfDigits = 1024/k_numberOfBitsInDigit;
+  constexpr static int k_maxNumberOfWords = 1024/32;
 private:
-  constexpr static int k_maxNumberOfDigitsBase10 = 309; // 1E308 < (2^32)^k_maxNumberOfDigits < 1E309
+  constexpr static int k_numberOfBitsInHalfDigit = 8*sizeof(half_native_uint_t);
+  constexpr static int k_maxNumberOfDigitsBase10 = 309; // 1E308 < 2^1024 < 1E309
   constexpr static int k_maxNumberOfParsedDigitsBase10 = 30; // the screen is 30 digits large.
   constexpr static int k_maxExtractableInteger = INT_MAX;
 
@@ -190,7 +221,7 @@ private:
   uint16_t numberOfHalfDigits() const {
     if (numberOfDigits() == 0) { return 0; }
     native_uint_t d = digit(numberOfDigits()-1);
-    native_uint_t halfBase = 1 << (8*sizeof(half_native_uint_t));
+    native_uint_t halfBase = static_cast<native_uint_t>(1) << k_numberOfBitsInHalfDigit;
     return (d >= halfBase ? 2*numberOfDigits() : 2*numberOfDigits()-1);
   }
   half_native_uint_t halfDigit(int i) const {
@@ -3,9 +3,12 @@
 
 #include <poincare/parametered_expression.h>
 #include <poincare/symbol.h>
+#include <cmath>
 
 namespace Poincare {
 
+class CompiledExpression;
+
 class IntegralNode final : public ParameteredExpressionNode {
 public:
 
@@ -22,6 +25,13 @@ public:
   Type type() const override { return Type::Integral; }
   int polynomialDegree(Context * context, const char * symbolName) const override;
 
+  /* Approximate the integral at each of the n upper bounds, given in place of
+   * the upper bound child. When the upper bounds are sorted, each value is the
+   * previous one plus the integral between the consecutive bounds, which is
+   * much cheaper than integrating from the lower bound every time. The
+   * integral at startUpperBound is startValue if it is known. */
+  template<typename T> void approximateAtUpperBounds(const T * upperBounds, T * values, int n, const ApproximationContext& approximationContext, T startUpperBound = NAN, T startValue = NAN) const;
+
 private:
   // Layout
   Layout createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits, Context * context) const override;
@@ -34,6 +44,8 @@ private:
   Evaluation<float> approximate(SinglePrecision p, const ApproximationContext& approximationContext) const override { return templatedApproximate<float>(approximationContext); }
   Evaluation<double> approximate(DoublePrecision p, const ApproximationContext& approximationContext) const override { return templatedApproximate<double>(approximationContext); }
  template<typename T> Evaluation<T> templatedApproximate(const ApproximationContext& approximationContext) const;
+  // lowerBound and upperBound are the exact forms of a and b
+  template<typename T> T approximateBetweenBounds(T a, T b, Expression lowerBound, Expression upperBound, const CompiledExpression * compiledIntegrand, const ApproximationContext& approximationContext) const;
   template<typename T>
   struct DetailedResult
   {
@@ -60,11 +72,13 @@ private:
     Expression integrandNearB;
   };
   Expression rewriteIntegrandNear(Expression bound, const ReductionContext& reductionContext) const;
-  template<typename T> T integrand(T x, Substitution<T> substitution, const ApproximationContext& approximationContext) const;
-  template<typename T> T integrandNearBound(T x, T xc, AlternativeIntegrand alternativeIntegrand, const ApproximationContext& approximationContext) const;
-  template<typename T> DetailedResult<T> tanhSinhQuadrature(int level, AlternativeIntegrand alternativeIntegrand, const ApproximationContext& approximationContext) const;
-  template<typename T> DetailedResult<T> kronrodGaussQuadrature(T a, T b, Substitution<T> substitution, const ApproximationContext& approximationContext) const;
-  template<typename T> DetailedResult<T> adaptiveQuadrature(T a, T b, T eps, int numberOfIterations, Substitution<T> substitution, const ApproximationContext& approximationContext) const;
+  // compiledIntegrand is nullptr if the integrand could not be compiled
+  template<typename T> T integrandValue(T x, const CompiledExpression * compiledIntegrand, const ApproximationContext& approximationContext) const;
+  template<typename T> T integrand(T x, Substitution<T> substitution, const CompiledExpression * compiledIntegrand, const ApproximationContext& approximationContext) const;
+  template<typename T> T integrandNearBound(T x, T xc, AlternativeIntegrand alternativeIntegrand, const CompiledExpression * compiledIntegrand, const ApproximationContext& approximationContext) const;
+  template<typename T> DetailedResult<T> tanhSinhQuadrature(int level, AlternativeIntegrand alternativeIntegrand, const CompiledExpression * compiledIntegrand, const ApproximationContext& approximationContext) const;
+  template<typename T> DetailedResult<T> kronrodGaussQuadrature(T a, T b, Substitution<T> substitution, const CompiledExpression * compiledIntegrand, const ApproximationContext& approximationContext) const;
+  template<typename T> DetailedResult<T> adaptiveQuadrature(T a, T b, T eps, int numberOfIterations, Substitution<T> substitution, const CompiledExpression * compiledIntegrand, const ApproximationContext& approximationContext) const;
 #endif
 
 };
@@ -78,9 +92,19 @@ public:
   constexpr static Expression::FunctionHelper s_functionHelper = Expression::FunctionHelper("int", 4, &UntypedBuilder);
   constexpr static char k_defaultXNTChar = 'x';
 
+  /* Return true if the integral only depends on symbol through its upper
+   * bound, which is symbol itself: it is then an antiderivative in symbol. */
+  bool isAntiderivative(const char * symbol, Context * context) const;
+  template<typename T> void approximateAtUpperBounds(const T * upperBounds, T * values, int n, const ApproximationContext& approximationContext, T startUpperBound = NAN, T startValue = NAN) const {
+    node()->approximateAtUpperBounds(upperBounds, values, n, approximationContext, startUpperBound, startValue);
+  }
+
   // Expression
   void deepReduceChildren(const ReductionContext& reductionContext);
   Expression shallowReduce(ReductionContext reductionContext);
+
+private:
+  IntegralNode * node() const { return static_cast<IntegralNode *>(Expression::node()); }
 };
 
 }
@@ -36,17 +36,20 @@ public:
   bool derivate(const ReductionContext& reductionContext, Symbol symbol, Expression symbolValue) override;
   Expression unaryFunctionDifferential(const ReductionContext& reductionContext) override;
   // Evaluation
-  template<typename U> static Complex<U> computeOnComplex(const std::complex<U> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
+  template<typename U> static std::complex<U> computeOnComplex(const std::complex<U> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
     /* log has a branch cut on ]-inf, 0]: it is then multivalued on this cut. We
      * followed the convention chosen by the lib c++ of llvm on ]-inf+0i, 0+0i]
      * (warning: log takes the other side of the cut values on ]-inf-0i, 0-0i]).
      * We manually handle the case where the argument is null, as the lib c++
      * gives log(0) = -inf, which is only a generous shorthand for the limit. */
-    return Complex<U>::Builder(c == std::complex<U>(0) ? std::complex<U>(NAN, NAN) : std::log10(c));
+    return c == std::complex<U>(0) ? std::complex<U>(NAN, NAN) : std::log10(c);
   }
   Evaluation<float> approximate(SinglePrecision p, const ApproximationContext& approximationContext) const override { return templatedApproximate<float>(approximationContext); }
   Evaluation<double> approximate(DoublePrecision p, const ApproximationContext& approximationContext) const override { return templatedApproximate<double>(approximationContext); }
+  std::complex<float> approximateToComplex(SinglePrecision p, const ApproximationContext& approximationContext) const override { return templatedApproximateToComplex<float>(approximationContext); }
+  std::complex<double> approximateToComplex(DoublePrecision p, const ApproximationContext& approximationContext) const override { return templatedApproximateToComplex<double>(approximationContext); }
   template<typename U> Evaluation<U> templatedApproximate(const ApproximationContext& approximationContext) const;
+  template<typename U> std::complex<U> templatedApproximateToComplex(const ApproximationContext& approximationContext) const;
 };
 
 class Logarithm final : public ExpressionUpToTwoChildren<Logarithm, LogarithmNode> {
@@ -95,6 +95,10 @@ private:
   Expression computeInverseOrDeterminant(bool computeDeterminant, const ReductionContext& reductionContext, bool * couldCompute) const;
   // rowCanonize turns a matrix in its row echelon form, reduced or not.
   Matrix rowCanonize(const ReductionContext& reductionContext, Expression * determinant, bool reduced = true);
+  /* Exact rowCanonize of matrices whose children are all rationals, computed
+   * on integers instead of expressions. Return false if it could not be
+   * applied, leaving the matrix unchanged. */
+  bool rowCanonizeRationals(Expression * determinant, bool reduced);
   // Row canonize the array in place
   template<typename T> static void ArrayRowCanonize(T * array, int numberOfRows, int numberOfColumns, T * c = nullptr, bool reduced = true);
 
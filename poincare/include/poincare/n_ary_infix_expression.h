@@ -16,6 +16,8 @@ protected:
   // Order
   int simplificationOrderSameType(const ExpressionNode * e, bool ascending, bool ignoreParentheses) const override;
   int simplificationOrderGreaterType(const ExpressionNode * e, bool ascending, bool ignoreParentheses) const override;
+  // An operation with a single child is ordered as this child
+  uint32_t computeHash() const override { return numberOfChildren() == 1 ? childAtIndex(0)->hash() : ExpressionNode::computeHash(); }
 };
 
 }
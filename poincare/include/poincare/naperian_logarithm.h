@@ -22,6 +22,15 @@ public:
   // Properties
   Type type() const override { return Type::NaperianLogarithm; }
 
+  template<typename T> static std::complex<T> computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+    /* ln has a branch cut on ]-inf, 0]: it is then multivalued on this cut. We
+     * followed the convention chosen by the lib c++ of llvm on ]-inf+0i, 0+0i]
+     * (warning: ln takes the other side of the cut values on ]-inf-0i, 0-0i]).
+     * We manually handle the case where the argument is null, as the lib c++
+     * gives log(0) = -inf, which is only a generous shorthand for the limit. */
+    return c == std::complex<T>(0) ? std::complex<T>(NAN, NAN) : std::log(c);
+  }
+
 private:
   // Layout
   Layout createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits, Context * context) const override;
@@ -31,20 +40,18 @@ private:
   LayoutShape leftLayoutShape() const override { return LayoutShape::MoreLetters; };
   LayoutShape rightLayoutShape() const override { return LayoutShape::BoundaryPunctuation; }
   /* Evaluation */
-  template<typename T> static Complex<T> computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
-    /* ln has a branch cut on ]-inf, 0]: it is then multivalued on this cut. We
-     * followed the convention chosen by the lib c++ of llvm on ]-inf+0i, 0+0i]
-     * (warning: ln takes the other side of the cut values on ]-inf-0i, 0-0i]).
-     * We manually handle the case where the argument is null, as the lib c++
-     * gives log(0) = -inf, which is only a generous shorthand for the limit. */
-    return Complex<T>::Builder(c == std::complex<T>(0) ? std::complex<T>(NAN, NAN) : std::log(c));
-  }
   Evaluation<float> approximate(SinglePrecision p, const ApproximationContext& approximationContext) const override {
     return ApproximationHelper::MapOneChild<float>(this, approximationContext, computeOnComplex<float>);
   }
   Evaluation<double> approximate(DoublePrecision p, const ApproximationContext& approximationContext) const override {
     return ApproximationHelper::MapOneChild<double>(this, approximationContext, computeOnComplex<double>);
   }
+  std::complex<float> approximateToComplex(SinglePrecision p, const ApproximationContext& approximationContext) const override {
+    return ApproximationHelper::MapOneChildToComplex<float>(this, approximationContext, computeOnComplex<float>);
+  }
+  std::complex<double> approximateToComplex(DoublePrecision p, const ApproximationContext& approximationContext) const override {
+    return ApproximationHelper::MapOneChildToComplex<double>(this, approximationContext, computeOnComplex<double>);
+  }
 };
 
 class NaperianLogarithm final : public ExpressionOneChild<NaperianLogarithm, NaperianLogarithmNode> {
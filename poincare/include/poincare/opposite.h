@@ -33,7 +33,14 @@ public:
   Evaluation<double> approximate(DoublePrecision p, const ApproximationContext& approximationContext) const override {
     return templatedApproximate<double>(approximationContext);
   }
+  std::complex<float> approximateToComplex(SinglePrecision p, const ApproximationContext& approximationContext) const override {
+    return templatedApproximateToComplex<float>(approximationContext);
+  }
+  std::complex<double> approximateToComplex(DoublePrecision p, const ApproximationContext& approximationContext) const override {
+    return templatedApproximateToComplex<double>(approximationContext);
+  }
   template<typename T> Evaluation<T> templatedApproximate(const ApproximationContext& approximationContext) const;
+  template<typename T> std::complex<T> templatedApproximateToComplex(const ApproximationContext& approximationContext) const;
 
   // Layout
   Layout createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits, Context * context) const override;
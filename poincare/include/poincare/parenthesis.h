@@ -40,6 +40,8 @@ public:
   // Approximation
   Evaluation<float> approximate(SinglePrecision p, const ApproximationContext& approximationContext) const override { return templatedApproximate<float>(approximationContext); }
   Evaluation<double> approximate(DoublePrecision p, const ApproximationContext& approximationContext) const override { return templatedApproximate<double>(approximationContext); }
+  std::complex<float> approximateToComplex(SinglePrecision p, const ApproximationContext& approximationContext) const override { return childAtIndex(0)->approximateToComplex(p, approximationContext); }
+  std::complex<double> approximateToComplex(DoublePrecision p, const ApproximationContext& approximationContext) const override { return childAtIndex(0)->approximateToComplex(p, approximationContext); }
 private:
  template<typename T> Evaluation<T> templatedApproximate(const ApproximationContext& approximationContext) const;
 };
@@ -3,6 +3,7 @@
 
 #include <poincare/expression.h>
 #include <poincare/rational.h>
+#include <complex>
 
 namespace Poincare {
 
@@ -14,8 +15,32 @@ public:
 
   static int CubicPolynomialRoots(Expression a, Expression b, Expression c, Expression d, Expression * root1, Expression * root2, Expression * root3, Expression * delta, ReductionContext reductionContext, bool * approximateSolutions = nullptr, bool beautifyRoots = true);
 
+  /* Numerical resolution, for polynomials of degree up to
+   * k_maxApproximatedDegree. Coefficients are ordered by increasing degree. */
+  constexpr static int k_maxApproximatedDegree = 16;
+  /* Fill coefficients with the approximated coefficients of e, a polynomial in
+   * symbol, and return its degree. Return -1 if e is not a polynomial with real
+   * coefficients of degree up to k_maxApproximatedDegree. */
+  static int ApproximateCoefficients(const Expression & e, const char * symbol, double * coefficients, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit);
+  /* Approximate all the complex roots simultaneously with the Aberth-Ehrlich
+   * method. Return false if the iterations did not converge. */
+  static bool ApproximateRoots(const double * coefficients, int degree, std::complex<double> * roots);
+  /* Fill roots with the increasing real roots, counting multiple roots once,
+   * and return their number. Return -1 if the polynomial is null or if its
+   * roots could not be approximated. */
+  static int ApproximateRealRoots(const double * coefficients, int degree, double * roots);
+
 private:
   constexpr static int k_maxNumberOfNodesBeforeApproximatingDelta = 16;
+  constexpr static int k_maxNumberOfAberthIterations = 100;
+  constexpr static int k_maxNumberOfNewtonIterations = 20;
+  constexpr static double k_initialAngle = 0.4;
+  // Horner evaluation of p(z), p'(z) and of sum(|a_k|*|z|^k) to bound errors
+  static void EvaluateWithDerivative(const double * coefficients, int degree, std::complex<double> z, std::complex<double> * value, std::complex<double> * derivative, double * errorBound);
+  /* Polish the real root of given multiplicity approximated by root. Return
+   * false if Newton's method did not converge on the real line within extent
+   * of root to a point where the polynomial vanishes. */
+  static bool RefineRealRoot(const double * coefficients, int degree, int multiplicity, double * root, double extent);
   static Expression ReducePolynomial(const Expression * coefficients, int degree, Expression parameter, const ReductionContext& reductionContext);
   static Rational ReduceRationalPolynomial(const Rational * coefficients, int degree, Rational parameter);
   static bool IsRoot(const Expression * coefficients, int degree, Expression root, const ReductionContext& reductionContext) { return ReducePolynomial(coefficients, degree, root, reductionContext).isNull(reductionContext.context()) == TrinaryBoolean::True; }
@@ -35,8 +35,8 @@ public:
   int polynomialDegree(Context * context, const char * symbolName) const override;
   int getPolynomialCoefficients(Context * context, const char * symbolName, Expression coefficients[]) const override;
 
-  template<typename T> static Complex<T> computeNotPrincipalRealRootOfRationalPow(const std::complex<T> c, T p, T q);
-  template<typename T> static Complex<T> computeOnComplex(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat);
+  template<typename T> static std::complex<T> computeNotPrincipalRealRootOfRationalPow(const std::complex<T> c, T p, T q);
+  template<typename T> static std::complex<T> computeOnComplex(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat);
   template<typename T> static Evaluation<T> Compute(Evaluation<T> eval1, Evaluation<T> eval2, Preferences::ComplexFormat complexFormat) {
     return ApproximationHelper::Reduce<T>(
         eval1,
@@ -65,6 +65,7 @@ private:
   LayoutShape rightLayoutShape() const override { return LayoutShape::BoundaryPunctuation; }
   int simplificationOrderGreaterType(const ExpressionNode * e, bool ascending, bool ignoreParentheses) const override;
   int simplificationOrderSameType(const ExpressionNode * e, bool ascending, bool ignoreParentheses) const override;
+  uint32_t computeHash() const override;
   bool derivate(const ReductionContext& reductionContext, Symbol symbol, Expression symbolValue) override;
   // Evaluation
   template<typename T> static MatrixComplex<T> computeOnMatrixAndComplex(const MatrixComplex<T> m, const std::complex<T> d, Preferences::ComplexFormat complexFormat);
@@ -74,7 +75,16 @@ private:
   Evaluation<double> approximate(DoublePrecision p, const ApproximationContext& approximationContext) const override {
     return templatedApproximate<double>(approximationContext);
   }
+  std::complex<float> approximateToComplex(SinglePrecision p, const ApproximationContext& approximationContext) const override {
+    return templatedApproximateToComplex<float>(approximationContext);
+  }
+  std::complex<double> approximateToComplex(DoublePrecision p, const ApproximationContext& approximationContext) const override {
+    return templatedApproximateToComplex<double>(approximationContext);
+  }
+  // Set p and q if the index is p/q with p and q integers
+  template<typename T> bool isRationalIndex(T * p, T * q) const;
  template<typename T> Evaluation<T> templatedApproximate(const ApproximationContext& approximationContext) const;
+  template<typename T> std::complex<T> templatedApproximateToComplex(const ApproximationContext& approximationContext) const;
 };
 
 class Power final : public ExpressionTwoChildren<Power, PowerNode> {
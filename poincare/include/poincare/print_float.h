@@ -84,39 +84,44 @@ private:
   template <class T>
   static TextLengths ConvertFloatToTextPrivate(T f, char * buffer, int bufferSize, int availableGlyphLength, int numberOfSignificantDigits, Preferences::PrintFloatMode mode);
 
-  class Long final {
+  /* The decimal digits of a non-negative integer, as chars from the most
+   * significant one. They are extracted two at a time from a table of the 100
+   * pairs of digits, with 64-bit divisions only for the digits beyond 32 bits.
+   * Zeroes are then removed and added on the right on the chars directly. */
+  class Digits final {
   public:
-    Long(int64_t i = 0);
-    Long(uint32_t d1, uint32_t, bool negative);
-    bool isNegative() const { return m_negative; }
-    bool isZero() const { return (m_digits[0] == 0) && (m_digits[1] == 0); }
-    static void DivisionByTen(const Long & longToDivide, Long * quotient, Long * digit);
-    static void MultiplySmallLongByTen(Long & smallLong);
-
-    int serialize(char * buffer, int bufferSize) const;
-    uint32_t digit(uint8_t i) const {
-      assert(i >= 0 && i < k_numberOfDigits);
-      return m_digits[i];
+    Digits(uint64_t i);
+    // Missing digits on the left are zeroes
+    bool lastDigitIsZero() const { return m_numberOfDigits == 0 || m_digits[m_numberOfDigits - 1] == '0'; }
+    void removeLastDigit() {
+      if (m_numberOfDigits > 0) {
+        m_numberOfDigits--;
+      }
+    }
+    void addZero() {
+      assert(m_numberOfDigits < k_maxNumberOfDigits);
+      m_digits[m_numberOfDigits++] = '0';
     }
+    char digitFromRight(int i) const { return i < m_numberOfDigits ? m_digits[m_numberOfDigits - 1 - i] : '0'; }
   private:
-    constexpr static int64_t k_base = 1000000000;
-    constexpr static int k_numberOfDigits = 2;
-    constexpr static int k_maxNumberOfCharsForDigit = 9;
+    // UINT64_MAX has 20 digits
+    constexpr static int k_maxNumberOfDigits = 20;
+    constexpr static uint32_t k_base = 100000000;
 
-    bool m_negative;
-    uint32_t m_digits[k_numberOfDigits];
+    char m_digits[k_maxNumberOfDigits];
+    int m_numberOfDigits;
   };
 
-  /* This function prints the long i in the buffer with a '.' at the position
-   * specified by the decimalMarkerPosition.
+  /* This function prints the digits in the buffer with a '.' at the position
+   * specified by the decimalMarkerPosition, and a '-' first if negative.
    * It starts printing at the end of the buffer and prints from right to left.
-   * The given long should be of the right length to be written in bufferLength
-   * chars. If the long is too small, the buffer is padded on the left with '0'.
-   * If the long is too big, the printing stops when no more empty chars are
-   * available, without returning any warning.
+   * The given digits should be of the right length to be written in
+   * bufferLength chars. If they are too few, the buffer is padded on the left
+   * with '0'. If they are too many, the printing stops when no more empty
+   * chars are available, without returning any warning.
    * Warning: the buffer is not null terminated but is ensured to hold
    * bufferLength chars. */
-  static void PrintLongWithDecimalMarker(char * buffer, int bufferLength, Long & i, int decimalMarkerPosition);
+  static void PrintDigitsWithDecimalMarker(char * buffer, int bufferLength, const Digits & digits, bool negative, int decimalMarkerPosition);
 
 
 };
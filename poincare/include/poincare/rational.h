@@ -9,7 +9,7 @@ namespace Poincare {
 
 class RationalNode final : public NumberNode {
 public:
-  RationalNode(const native_uint_t * i, uint8_t numeratorSize, const native_uint_t * j, uint8_t denominatorSize, bool negative);
+  RationalNode(const uint32_t * i, uint8_t numeratorSize, const uint32_t * j, uint8_t denominatorSize, bool negative);
 
   Integer signedNumerator() const;
   Integer unsignedNumerator() const;
@@ -41,6 +41,8 @@ public:
   // Approximation
   Evaluation<float> approximate(SinglePrecision p, const ApproximationContext& approximationContext) const override { return Complex<float>::Builder(templatedApproximate<float>()); }
   Evaluation<double> approximate(DoublePrecision p, const ApproximationContext& approximationContext) const override { return Complex<double>::Builder(templatedApproximate<double>()); }
+  std::complex<float> approximateToComplex(SinglePrecision p, const ApproximationContext& approximationContext) const override { return ComplexNode<float>::Normalize(templatedApproximate<float>()); }
+  std::complex<double> approximateToComplex(DoublePrecision p, const ApproximationContext& approximationContext) const override { return ComplexNode<double>::Normalize(templatedApproximate<double>()); }
   template<typename T> T templatedApproximate() const;
 
   // Basic test
@@ -62,9 +64,10 @@ private:
   Expression shallowReduce(const ReductionContext& reductionContext) override;
   LayoutShape leftLayoutShape() const override { assert(!m_negative); return isInteger() ? LayoutShape::Integer : LayoutShape::Fraction; };
   bool m_negative;
-  uint8_t m_numberOfDigitsNumerator;
-  uint8_t m_numberOfDigitsDenominator;
-  native_uint_t m_digits[0];
+  uint8_t m_numberOfWordsNumerator;
+  uint8_t m_numberOfWordsDenominator;
+  uint32_t m_words[0]; // See Integer::words
+
 };
 
 class Rational final : public Number {
@@ -117,7 +120,7 @@ public:
   Expression shallowReduce();
 
 private:
-  static Rational Builder(const native_uint_t * i, uint8_t numeratorSize, const native_uint_t * j, uint8_t denominatorSize, bool negative);
+  static Rational Builder(const uint32_t * i, uint8_t numeratorSize, const uint32_t * j, uint8_t denominatorSize, bool negative);
 
   /* Simplification */
   Expression shallowBeautify();
@@ -0,0 +1,65 @@
+#ifndef POINCARE_REDUCTION_PROFILER_H
+#define POINCARE_REDUCTION_PROFILER_H
+
+#if POINCARE_REDUCTION_PROFILER
+
+#include <poincare/expression_node.h>
+#include <stdint.h>
+
+namespace Poincare {
+
+/* The ReductionProfiler counts the calls to shallowReduce and shallowBeautify
+ * per ExpressionNode::Type, along with the time spent in them. This time
+ * excludes the nested calls, so that a rule delegating to others is not
+ * blamed for them. It is only built on the simulator, which dumps the
+ * counters when given the --reduction-profile flag. */
+
+class ReductionProfiler {
+public:
+  enum class Operation : uint8_t {
+    ShallowReduce = 0,
+    ShallowBeautify,
+    NumberOfOperations
+  };
+
+  class Measure {
+  public:
+    Measure(const ExpressionNode * node, Operation operation);
+    ~Measure();
+  private:
+    uint64_t m_start;
+    uint64_t m_nestedTimeOfParent;
+    ExpressionNode::Type m_type;
+    Operation m_operation;
+  };
+
+  static void Start();
+  static bool IsRunning() { return s_isRunning; }
+  static void ReductionStepBudgetWasExhausted();
+  static void Log();
+
+private:
+  constexpr static int k_numberOfTypes = static_cast<int>(ExpressionNode::Type::EmptyExpression) + 1;
+  constexpr static int k_numberOfOperations = static_cast<int>(Operation::NumberOfOperations);
+  constexpr static int k_maxNameLength = 32;
+
+  struct Counter {
+    uint32_t numberOfCalls;
+    uint64_t time;
+  };
+
+  static uint64_t Now();
+
+  static bool s_isRunning;
+  // Time spent in the nested calls of the current measure
+  static uint64_t s_nestedTime;
+  static uint32_t s_numberOfExhaustedBudgets;
+  static Counter s_counters[k_numberOfOperations][k_numberOfTypes];
+  static char s_typeNames[k_numberOfTypes][k_maxNameLength];
+};
+
+}
+
+#endif
+
+#endif
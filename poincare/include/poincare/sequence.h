@@ -20,6 +20,7 @@ public:
   Type type() const override { return Type::Sequence; }
   Expression replaceSymbolWithExpression(const SymbolAbstract & symbol, const Expression & expression) override;
   int simplificationOrderSameType(const ExpressionNode * e, bool ascending, bool ignoreParentheses) const override;
+  uint32_t computeHash() const override { return CombineHash(SymbolAbstractNode::computeHash(), childAtIndex(0)->hash()); }
 
 private:
   char m_name[0];
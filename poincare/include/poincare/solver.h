@@ -7,6 +7,8 @@
 
 namespace Poincare {
 
+class CompiledExpression;
+
 template<typename T>
 class Solver {
 public:
@@ -28,6 +30,7 @@ public:
   typedef Interest (*BracketTest)(Coordinate2D<T>, Coordinate2D<T>, Coordinate2D<T>, const void *);
   typedef Coordinate2D<T> (*HoneResult)(FunctionEvaluation, const void *, T, T, Interest, T);
   typedef bool (*DiscontinuityEvaluation)(T, T, const void *);
+  typedef void (*SolutionVisitor)(Coordinate2D<T>, Interest, void *);
 
   constexpr static T k_relativePrecision = Float<T>::Epsilon();
   constexpr static T k_minimalAbsoluteStep = 2. * Helpers::SquareRoot(2. * k_relativePrecision);
@@ -64,6 +67,16 @@ public:
    * between the two expressions, in case the method needs to be called several
    * times in a row. */
   Coordinate2D<T> nextIntersection(const Expression & e1, const Expression & e2, Expression * memoizedDifference = nullptr);
+  /* Call visitor on each root (if searchRoots) and each local extremum (if
+   * searchExtrema) in ]xStart,xEnd[. Instead of one sweep per kind of
+   * solution, the interval is swept once: each triplet of points is tested
+   * for all the kinds, and only the brackets that fire are honed. This does
+   * not move xStart. The roots are those nextRoot finds when canVisitRoots. */
+  void visitRootsAndExtrema(const Expression & e, bool searchRoots, bool searchExtrema, SolutionVisitor visitor, void * visitorAux);
+  void visitRootsAndExtrema(FunctionEvaluation f, const void * aux, bool searchRoots, bool searchExtrema, SolutionVisitor visitor, void * visitorAux, DiscontinuityEvaluation discontinuityTest = nullptr);
+  /* Return false if nextRoot looks for some roots of e in its children, which
+   * a sweep of e cannot find. */
+  bool canVisitRoots(const Expression & e) const;
   /* Stretch the interval to include the previous bounds. This allows finding
    * solutions in [xStart,xEnd], as otherwise all resolution is done on an open
    * interval. */
@@ -77,6 +90,8 @@ private:
     Expression expression;
     Preferences::ComplexFormat complexFormat;
     Preferences::AngleUnit angleUnit;
+    // nullptr if the expression could not be compiled
+    const CompiledExpression * compiledExpression;
   };
 
   constexpr static T k_NAN = static_cast<T>(NAN);
@@ -87,6 +102,11 @@ private:
   constexpr static T k_minimalPracticalStep = std::max(static_cast<T>(1e-6), k_minimalAbsoluteStep);
   constexpr static T k_absolutePrecision = k_relativePrecision * k_minimalAbsoluteStep;
 
+  static T EvaluateExpression(T x, const void * aux);
+  static bool PiecewiseConditionChanges(T x1, T x2, const void * aux);
+  static bool IsFractionalPower(const Expression e, Context * context, void * aux);
+  static bool HasFractionalPowerTerm(const Expression e, Context * context, void * aux);
+
   static Coordinate2D<T> SafeBrentMinimum(FunctionEvaluation f, const void * aux, T xMin, T xMax, Interest interest, T precision);
   static Coordinate2D<T> SafeBrentMaximum(FunctionEvaluation f, const void * aux, T xMin, T xMax, Interest interest, T precision);
   static Coordinate2D<T> CompositeBrentForRoot(FunctionEvaluation f, const void * aux, T xMin, T xMax, Interest interest, T precision);
@@ -97,6 +117,7 @@ private:
   T maximalStep() const { return m_maximalXStep; }
   T minimalStep(T x, T slope = static_cast<T>(1.)) const;
   bool validSolution(T x) const;
+  bool isAfter(T x, T reference) const;
   T nextX(T x, T direction, T slope) const;
   Coordinate2D<T> nextPossibleRootInChild(const Expression & e, int childIndex) const;
   Coordinate2D<T> nextRootInChildren(const Expression & e, Expression::ExpressionTestAuxiliary test, void * aux) const;
@@ -28,9 +28,14 @@
  * other method that needs sortedIndex) multiple times with the same datas,
  * you should memoize your dataset.
  * Indeed, the object memoizes m_sortedIndex and recomputes it only if you
- * ask it to.
+ * ask it to. If a single value has been modified, setValueHasBeenModified
+ * moves it within m_sortedIndex instead.
  * (for example, that's what we do in Apps::Statistics::Store)
  *
+ * The first sortedElementAtCumulatedWeight following a modification does not
+ * build m_sortedIndex if it can select the element in linear time instead.
+ * This is the case when the weights are integers and the values are defined.
+ *
  * === ENHANCEMENTS ===
  * More statistics method could be implemented here if factorization is needed.
  * */
@@ -42,13 +47,16 @@ class StatisticsDataset {
 public:
   static StatisticsDataset<T> BuildFromChildren(const ExpressionNode * e, const ApproximationContext& approximationContext, ListComplex<T> evaluationArray[]);
 
-  StatisticsDataset(const DatasetColumn<T> * values, const DatasetColumn<T> * weights) : m_values(values), m_weights(weights), m_sortedIndex(FloatList<float>::Builder()), m_recomputeSortedIndex(true), m_memoizedTotalWeight(NAN), m_lnOfValues(false) {}
+  StatisticsDataset(const DatasetColumn<T> * values, const DatasetColumn<T> * weights) : m_values(values), m_weights(weights), m_sortedIndex(FloatList<float>::Builder()), m_recomputeSortedIndex(true), m_hasSelectedElement(false), m_memoizedTotalWeight(NAN), m_lnOfValues(false) {}
   StatisticsDataset(const DatasetColumn<T> * values) : StatisticsDataset(values, nullptr) {}
   StatisticsDataset() : StatisticsDataset(nullptr, nullptr) {}
 
   bool isUndefined() { return m_values == nullptr; }
 
-  void setHasBeenModified() { m_recomputeSortedIndex = true; m_memoizedTotalWeight = NAN; }
+  void setHasBeenModified() { m_recomputeSortedIndex = true; m_hasSelectedElement = false; m_memoizedTotalWeight = NAN; }
+  // The value at index has changed, but the length of the dataset has not
+  void setValueHasBeenModified(int index);
+  void setWeightHasBeenModified() { m_memoizedTotalWeight = NAN; }
   int indexAtSortedIndex(int i) const;
 
   void setLnOfValues(bool b) { m_lnOfValues = b; }
@@ -87,6 +95,9 @@ private:
   T weightAtIndex(int index) const;
   T privateTotalWeight() const;
   void buildSortedIndex() const;
+  // Sorting order of the values, undefined values being the greatest
+  bool valueIsGreaterThan(int i, int j) const;
+  bool selectIndexAtCumulatedWeight(T weight, int * lowerIndex, int * upperIndex) const;
 
   const DatasetColumn<T> * m_values;
   const DatasetColumn<T> * m_weights;
@@ -94,6 +105,7 @@ private:
    * containing numbers in the pool.*/
   mutable FloatList<float> m_sortedIndex;
   mutable bool m_recomputeSortedIndex;
+  mutable bool m_hasSelectedElement;
   mutable double m_memoizedTotalWeight;
   bool m_lnOfValues;
 };
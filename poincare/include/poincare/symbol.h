@@ -45,6 +45,8 @@ public:
   /* Approximation */
   Evaluation<float> approximate(SinglePrecision p, const ApproximationContext& approximationContext) const override { return templatedApproximate<float>(approximationContext); }
   Evaluation<double> approximate(DoublePrecision p, const ApproximationContext& approximationContext) const override { return templatedApproximate<double>(approximationContext); }
+  std::complex<float> approximateToComplex(SinglePrecision p, const ApproximationContext& approximationContext) const override { return templatedApproximateToComplex<float>(approximationContext); }
+  std::complex<double> approximateToComplex(DoublePrecision p, const ApproximationContext& approximationContext) const override { return templatedApproximateToComplex<double>(approximationContext); }
 
   bool isUnknown() const;
 private:
@@ -52,6 +54,7 @@ private:
 
   size_t nodeSize() const override { return sizeof(SymbolNode); }
   template<typename T> Evaluation<T> templatedApproximate(const ApproximationContext& approximationContext) const;
+  template<typename T> std::complex<T> templatedApproximateToComplex(const ApproximationContext& approximationContext) const;
 };
 
 class Symbol final : public SymbolAbstract {
@@ -30,6 +30,8 @@ public:
 
   // ExpressionNode
   int simplificationOrderSameType(const ExpressionNode * e, bool ascending, bool ignoreParentheses) const override;
+  // Only the name is compared
+  uint32_t computeHash() const override;
 
   // Property
   TrinaryBoolean isPositive(Context * context) const override;
@@ -81,14 +81,14 @@ public:
   bool hasAncestor(TreeHandle t, bool includeSelf) const { return node()->hasAncestor(t.node(), includeSelf); }
   TreeHandle commonAncestorWith(TreeHandle t, bool includeTheseNodes = true) const;
   int numberOfChildren() const { return node()->numberOfChildren(); }
-  void setNumberOfChildren(int numberOfChildren) { node()->setNumberOfChildren(numberOfChildren); }
+  void setNumberOfChildren(int numberOfChildren) { node()->setNumberOfChildren(numberOfChildren); node()->invalidateHash(); }
   int indexOfChild(TreeHandle t) const;
   TreeHandle parent() const;
   TreeHandle childAtIndex(int i) const;
   void setParentIdentifier(uint16_t id) { node()->setParentIdentifier(id); }
   void deleteParentIdentifier() { node()->deleteParentIdentifier(); }
   void deleteParentIdentifierInChildren() { node()->deleteParentIdentifierInChildren(); }
-  void incrementNumberOfChildren(int increment = 1) { node()->incrementNumberOfChildren(increment); }
+  void incrementNumberOfChildren(int increment = 1) { node()->incrementNumberOfChildren(increment); node()->invalidateHash(); }
   int numberOfDescendants(bool includeSelf) const { return node()->numberOfDescendants(includeSelf); }
 
   /* Hierarchy operations */
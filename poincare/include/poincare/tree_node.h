@@ -17,6 +17,7 @@
  *  - an identifier
  *  - a parent identifier
  *  - a reference counter
+ *  - a memoized structural hash
  */
 
 /* CAUTION: To make node operations faster, the pool needs all adresses and
@@ -55,6 +56,14 @@ public:
   int retainCount() const { return m_referenceCounter; }
   size_t deepSize(int realNumberOfChildren) const;
 
+  /* Structural hash of the tree, computed on demand and memoized. Trees with
+   * different hashes cannot be identical, which makes most comparisons of
+   * distinct trees constant time. */
+  uint16_t hash() const;
+  /* The hash must be forgotten by a node and its ancestors whenever its
+   * children change. TreeHandle hierarchy operations take care of it. */
+  void invalidateHash();
+
   // Ghost
 #if ASSERTIONS
   virtual bool isGhost() const { return false; }
@@ -186,17 +195,31 @@ protected:
   TreeNode() :
     m_identifier(NoNodeIdentifier),
     m_parentIdentifier(NoNodeIdentifier),
-    m_referenceCounter(0)
+    m_referenceCounter(0),
+    m_hash(k_noHash)
   {}
 
+  static uint32_t CombineHash(uint32_t hash, uint32_t value) {
+    // FNV-1a step
+    return (hash ^ value) * 16777619u;
+  }
+  /* Trees that are identical must have the same hash. By default, the hash
+   * depends on the size and the hashes of the children of the node. It must
+   * not depend on data that can be modified in place, such as the sign of a
+   * number. */
+  virtual uint32_t computeHash() const;
+
 private:
   void updateParentIdentifierInChildren() const {
     changeParentIdentifierInChildren(m_identifier);
   }
   void changeParentIdentifierInChildren(uint16_t id) const;
+  constexpr static uint16_t k_noHash = 0;
   uint16_t m_identifier;
   uint16_t m_parentIdentifier;
   int8_t m_referenceCounter;
+  // Fits in the padding of the previous members
+  mutable uint16_t m_hash;
 };
 
 template<typename T>
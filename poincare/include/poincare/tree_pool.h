@@ -6,7 +6,8 @@
 #include <stddef.h>
 #include <string.h>
 #include <new>
-#if POINCARE_TREE_LOG
+#include <type_traits>
+#if POINCARE_TREE_LOG || POINCARE_TREE_POOL_STATISTICS
 #include <iostream>
 #endif
 
@@ -32,14 +33,20 @@ public:
 #endif
  }
 
-  TreePool() : m_cursor(buffer()) {}
+  TreePool() :
+    m_cursor(buffer()),
+    m_numberOfAllocations(0)
+#if POINCARE_TREE_POOL_STATISTICS
+    , m_statistics({0, 0, 0})
+#endif
+  {}
 
   char * cursor() const { return m_cursor; }
 
   // Node
   TreeNode * node(uint16_t identifier) const {
     assert(TreeNode::IsValidIdentifier(identifier) && identifier < MaxNumberOfNodes);
-    if (m_nodeForIdentifierOffset[identifier] != UINT16_MAX) {
+    if (m_nodeForIdentifierOffset[identifier] != k_noNodeOffset) {
       return const_cast<TreeNode *>(reinterpret_cast<const TreeNode *>(m_alignedBuffer + m_nodeForIdentifierOffset[identifier]));
     }
     return nullptr;
@@ -47,6 +54,8 @@ public:
 
   // Pool memory
   void * alloc(size_t size);
+  // Number of nodes allocated since the pool was built, for benchmarks
+  uint32_t numberOfAllocations() const { return m_numberOfAllocations; }
   void move(TreeNode * destination, TreeNode * source, int realNumberOfSourceChildren);
   void moveChildren(TreeNode * destination, TreeNode * sourceParent);
   void removeChildren(TreeNode * node, int nodeNumberOfChildren);
@@ -63,10 +72,36 @@ public:
 #endif
   int numberOfNodes() const;
 
+#if POINCARE_TREE_POOL_STATISTICS
+  /* Counters of the pool pressure, dumped by the simulator when given the
+   * --pool-statistics flag. */
+  struct Statistics {
+    // Highest number of bytes used at once
+    size_t peakOccupancy;
+    // Allocations which did not fit in the pool
+    uint32_t numberOfOverflows;
+    // Checkpoints rolling the pool back after an exception or an interruption
+    uint32_t numberOfRollbacks;
+  };
+  const Statistics & statistics() const { return m_statistics; }
+  void logStatistics() const;
+#endif
+
 private:
+  /* The pool size can be raised on the simulator with POINCARE_TREE_POOL_SIZE
+   * to run workloads which do not fit in the device memory. Identifiers stay
+   * 16 bits long so that nodes and handles keep their size, which caps the
+   * number of nodes, whereas node offsets are widened if needed. */
+#ifdef POINCARE_TREE_POOL_SIZE
+  constexpr static int BufferSize = POINCARE_TREE_POOL_SIZE;
+#else
   constexpr static int BufferSize = 32768;
-  constexpr static int MaxNumberOfNodes = BufferSize/sizeof(TreeNode);
+#endif
+  static_assert(BufferSize % ByteAlignment == 0, "The tree pool size must be a multiple of the node alignment");
+  constexpr static int MaxNumberOfNodes = BufferSize/sizeof(TreeNode) < INT16_MAX ? BufferSize/sizeof(TreeNode) : INT16_MAX - 1;
   constexpr static int k_maxNodeOffset = BufferSize/ByteAlignment;
+  typedef std::conditional<k_maxNodeOffset < UINT16_MAX, uint16_t, uint32_t>::type NodeOffset;
+  constexpr static NodeOffset k_noNodeOffset = static_cast<NodeOffset>(-1);
 
   static TreePool * SharedStaticPool;
 #if ASSERTIONS
@@ -79,7 +114,9 @@ private:
   void unregisterNode(TreeNode * node) {
     freeIdentifier(node->identifier());
   }
-  void updateNodeForIdentifierFromNode(TreeNode * node);
+  void updateNodeForIdentifierFromNode(TreeNode * node) { updateNodeForIdentifierInRange(node, last()); }
+  // Register the nodes from start up to, but excluding, end
+  void updateNodeForIdentifierInRange(TreeNode * start, TreeNode * end);
   void renameNode(TreeNode * node, bool unregisterPreviousIdentifier = true) {
     assert(IsAfterTopmostCheckpoint(node));
     node->rename(generateIdentifier(), unregisterPreviousIdentifier);
@@ -131,7 +168,7 @@ private:
   void moveNodes(TreeNode * destination, TreeNode * source, size_t moveLength);
 
   // Identifiers
-  uint16_t generateIdentifier() { return m_identifiers.pop(); }
+  uint16_t generateIdentifier();
   void freeIdentifier(uint16_t identifier);
 
   class IdentifierStack final {
@@ -140,8 +177,9 @@ private:
     void reset();
     void push(uint16_t i);
     uint16_t pop();
+    bool isEmpty() const { return m_currentIndex == 0; }
     void remove(uint16_t j);
-    void resetNodeForIdentifierOffsets(uint16_t * nodeForIdentifierOffset) const;
+    void resetNodeForIdentifierOffsets(NodeOffset * nodeForIdentifierOffset) const;
   private:
     uint16_t m_currentIndex;
     uint16_t m_availableIdentifiers[MaxNumberOfNodes];
@@ -154,10 +192,14 @@ private:
   const char * constBuffer() const { return reinterpret_cast<const char *>(m_alignedBuffer); }
   AlignedNodeBuffer m_alignedBuffer[BufferSize/ByteAlignment];
   char * m_cursor;
+  uint32_t m_numberOfAllocations;
   IdentifierStack m_identifiers;
-  uint16_t m_nodeForIdentifierOffset[MaxNumberOfNodes];
-  static_assert(k_maxNodeOffset < UINT16_MAX && sizeof(m_nodeForIdentifierOffset[0]) == sizeof(uint16_t),
-        "The tree pool node offsets in m_nodeForIdentifierOffset cannot be written with the chosen data size (uint16_t)");
+  NodeOffset m_nodeForIdentifierOffset[MaxNumberOfNodes];
+  static_assert(k_maxNodeOffset < k_noNodeOffset,
+        "The tree pool node offsets in m_nodeForIdentifierOffset cannot be written with the chosen data size");
+#if POINCARE_TREE_POOL_STATISTICS
+  Statistics m_statistics;
+#endif
 };
 
 }
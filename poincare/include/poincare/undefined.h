@@ -31,6 +31,12 @@ public:
   Evaluation<double> approximate(DoublePrecision p, const ApproximationContext& approximationContext) const override {
     return templatedApproximate<double>();
   }
+  std::complex<float> approximateToComplex(SinglePrecision p, const ApproximationContext& approximationContext) const override {
+    return std::complex<float>(NAN, NAN);
+  }
+  std::complex<double> approximateToComplex(DoublePrecision p, const ApproximationContext& approximationContext) const override {
+    return std::complex<double>(NAN, NAN);
+  }
 
   /* Derivation
    * Unlike Numbers that derivate to 0, Undefined derivates to Undefined. */
@@ -42,7 +42,7 @@ public:
     constexpr static int k_numberOfPrefixes = 13;
     static const Prefix * Prefixes();
     static const Prefix * EmptyPrefix();
-    const char * symbol() const { return m_symbol; }
+    constexpr const char * symbol() const { return m_symbol; }
     int8_t exponent() const { return m_exponent; }
     int serialize(char * buffer, int bufferSize) const;
   private:
@@ -122,12 +122,11 @@ public:
     virtual bool hasSpecialAdditionalExpressions(double value, Preferences::UnitFormat unitFormat) const { return false; }
     virtual int setAdditionalExpressions(double value, Expression * dest, int availableLength, const ReductionContext& reductionContext) const { return 0; }
 
-    AliasesList rootSymbols() const { return m_rootSymbols; }
+    constexpr AliasesList rootSymbols() const { return m_rootSymbols; }
     double ratio() const { return m_ratio; }
     bool isInputPrefixable() const { return m_inputPrefixable != Prefixable::None; }
     bool isOutputPrefixable() const { return m_outputPrefixable != Prefixable::None; }
     int serialize(char * buffer, int bufferSize, const Prefix * prefix) const;
-    bool canParseWithEquivalents(const char * symbol, size_t length, const Representative * * representative, const Prefix * * prefix) const;
     bool canParse(const char * symbol, size_t length, const Prefix * * prefix) const;
     Expression toBaseUnits(const ReductionContext& reductionContext) const;
     bool canPrefix(const Prefix * prefix, bool input) const;
@@ -19,6 +19,7 @@ public:
   // Context
   SymbolAbstractType expressionTypeForIdentifier(const char * identifier, int length) override;
   bool setExpressionForSymbolAbstract(const Expression & expression, const SymbolAbstract & symbol) override;
+  const ExpressionNode * approximableNodeForSymbol(const SymbolAbstract & symbol) override;
 protected:
   const Expression protectedExpressionForSymbolAbstract(const SymbolAbstract & symbol, bool clone, ContextWithParent * lastDescendantContext) override;
 private:
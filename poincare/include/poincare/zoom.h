@@ -1,13 +1,14 @@
 #ifndef POINCARE_ZOOM_H
 #define POINCARE_ZOOM_H
 
+#include <poincare/compiled_expression.h>
 #include <poincare/piecewise_operator.h>
 #include <poincare/range.h>
 #include <poincare/solver.h>
 #include <ion/display.h>
 
 /* The unit tests need to be able to read the working values of
- * m_interestingRange and m_magnitudeYRange, but we do not want to make public
+ * m_interestingRange and m_magnitudeRange, but we do not want to make public
  * getters for those as it would weaken the Zoom API. */
 class ZoomTest;
 
@@ -21,6 +22,8 @@ public:
   constexpr static float k_largeUnitMantissa = 5.f;
 
   template<typename T> using Function2DWithContext = Coordinate2D<T> (*)(T, const void *, Context *);
+  // Set the n values of the function's ordinate at the given abscissae
+  template<typename T> using ValuesBatchWithContext = void (*)(const T * abscissae, T * ordinates, int n, const void * model, Context * context);
 
   /* Sanitize will turn any random range into a range fit for display (see
    * comment on range() method below), that includes the original range. */
@@ -47,8 +50,9 @@ public:
   void fitPointsOfInterest(Function2DWithContext<float> f, const void * model, bool vertical = false, Function2DWithContext<double> fDouble = nullptr);
   void fitIntersections(Function2DWithContext<float> f1, const void * model1, Function2DWithContext<float> f2, const void * model2, bool vertical = false);
   void fitConditions(PiecewiseOperator p, Function2DWithContext<float> fullFunction, const void * model, const char * symbol, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, bool vertical = false);
-  /* This function will only touch the Y axis. */
-  void fitMagnitude(Function2DWithContext<float> f, const void * model, bool vertical = false);
+  /* This function will only touch the Y axis. If provided, fBatch is used to
+   * approximate several samples at once. */
+  void fitMagnitude(Function2DWithContext<float> f, const void * model, bool vertical = false, ValuesBatchWithContext<float> fBatch = nullptr);
   void fitBounds(Function2DWithContext<float> f, const void * model, bool vertical = false);
 
 private:
@@ -93,6 +97,14 @@ private:
     double (Coordinate2D<double>::*ordinateDouble)() const;
   };
 
+  /* Set the n points of the curve at the given parameters. It is called with
+   * at most k_batchSize parameters. */
+  typedef void (*SamplesEvaluation)(const float * parameters, Coordinate2D<float> * points, int n, const void * aux);
+  /* Called on each sample by increasing parameter, with the length of the
+   * parameter range the sample accounts for. */
+  typedef void (*SampleVisitor)(Coordinate2D<float> point, float weight, void * aux);
+  class AdaptiveSampler;
+
   struct IntersectionParameters {
     Function2DWithContext<float> f1;
     Function2DWithContext<float> f2;
@@ -101,8 +113,18 @@ private:
     Context * context;
   };
 
+  /* Curves are first sampled on k_numberOfCoarseIntervals intervals, which are
+   * then bisected at most k_maxRefinementDepth times, which gives the
+   * resolution of k_sampleSize samples. */
   constexpr static size_t k_sampleSize = Ion::Display::Width / 2;
-
+  constexpr static size_t k_batchSize = CompiledExpression::k_batchSize;
+  constexpr static int k_numberOfCoarseIntervals = 20;
+  constexpr static int k_maxRefinementDepth = 3;
+  static_assert(static_cast<size_t>(k_numberOfCoarseIntervals << k_maxRefinementDepth) == k_sampleSize, "The refined sampling does not have the resolution of k_sampleSize samples");
+
+  /* Sample the curve on tRange, only refining the intervals where it bends,
+   * changes sign or becomes undefined. */
+  static void SampleAdaptively(Range1D tRange, SamplesEvaluation evaluation, const void * evaluationAux, SampleVisitor visitor, void * visitorAux);
   static Solver<float>::Interest PointIsInteresting(Coordinate2D<float> a, Coordinate2D<float> b, Coordinate2D<float> c, const void * aux);
   static Coordinate2D<float> HonePoint(Solver<float>::FunctionEvaluation f, const void * aux, float a, float b, Solver<float>::Interest, float precision);
   static Coordinate2D<float> HoneIntersection(Solver<float>::FunctionEvaluation f, const void * aux, float a, float b, Solver<float>::Interest, float precision);
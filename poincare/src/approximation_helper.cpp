@@ -93,9 +93,9 @@ template<typename T> ListComplex<T> ElementWiseOnListAndComplex(const ListComple
     std::complex<T> complexAtIndex = l.complexAtIndex(i);
     Evaluation<T> computedNewComplex;
     if (complexFirst) {
-      computedNewComplex = computeOnComplexes(c, complexAtIndex, complexFormat);
+      computedNewComplex = Complex<T>::Builder(computeOnComplexes(c, complexAtIndex, complexFormat));
     } else {
-      computedNewComplex = computeOnComplexes(complexAtIndex, c, complexFormat);
+      computedNewComplex = Complex<T>::Builder(computeOnComplexes(complexAtIndex, c, complexFormat));
     }
     result.addChildAtIndexInPlace(computedNewComplex, i, i);
   }
@@ -109,7 +109,7 @@ template<typename T> ListComplex<T> ElementWiseOnLists(const ListComplex<T> l1,
   ListComplex<T> result = ListComplex<T>::Builder();
   int nChildren = l1.numberOfChildren();
   for (int i = 0; i < nChildren; i++) {
-    result.addChildAtIndexInPlace(computeOnComplexes(l1.complexAtIndex(i), l2.complexAtIndex(i), complexFormat), i, i);
+    result.addChildAtIndexInPlace(Complex<T>::Builder(computeOnComplexes(l1.complexAtIndex(i), l2.complexAtIndex(i), complexFormat)), i, i);
   }
   return result;
 }
@@ -203,7 +203,7 @@ template<typename T> Evaluation<T> ApproximationHelper::MapOneChild(const Expres
       [] (const std::complex<T> * c, int numberOfComplexes, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, void * context) {
         assert(numberOfComplexes == 1);
         void * * listOfContext = reinterpret_cast<void * *>(context);
-        return reinterpret_cast<ComplexCompute<T>>(listOfContext[0])(c[0], complexFormat, angleUnit);
+        return Complex<T>::Builder(reinterpret_cast<ComplexCompute<T>>(listOfContext[0])(c[0], complexFormat, angleUnit));
       },
       [] (const bool * b, int numberOfBooleans, void * context) {
         assert(numberOfBooleans == 1);
@@ -214,6 +214,12 @@ template<typename T> Evaluation<T> ApproximationHelper::MapOneChild(const Expres
       reinterpret_cast<void *>(context));
 }
 
+template<typename T> std::complex<T> ApproximationHelper::MapOneChildToComplex(const ExpressionNode * expression, const ApproximationContext& approximationContext, ComplexCompute<T> compute) {
+  assert(expression->numberOfChildren() == 1);
+  std::complex<T> c = expression->childAtIndex(0)->approximateToComplex(T(), approximationContext);
+  return ComplexNode<T>::Normalize(compute(c, approximationContext.complexFormat(), approximationContext.angleUnit()));
+}
+
 template<typename T> Evaluation<T> ApproximationHelper::Reduce(
     Evaluation<T> eval1,
     Evaluation<T> eval2,
@@ -230,7 +236,7 @@ template<typename T> Evaluation<T> ApproximationHelper::Reduce(
   // If element is complex
   if (eval1.type() == EvaluationNode<T>::Type::Complex) {
     if (eval2.type() == EvaluationNode<T>::Type::Complex) {
-       return computeOnComplexes(eval1.complexAtIndex(0), eval2.complexAtIndex(0), complexFormat);
+       return Complex<T>::Builder(computeOnComplexes(eval1.complexAtIndex(0), eval2.complexAtIndex(0), complexFormat));
     } else if (eval2.type() == EvaluationNode<T>::Type::ListComplex) {
       if (!mapOnList) {
         return Complex<T>::Undefined();
@@ -287,11 +293,29 @@ template<typename T> Evaluation<T> ApproximationHelper::MapReduce(
   return result;
 }
 
+template<typename T> std::complex<T> ApproximationHelper::MapReduceToComplex(
+    const ExpressionNode * expression,
+    const ApproximationContext& approximationContext,
+    ComplexAndComplexReduction<T> computeOnComplexes
+    ) {
+  assert(expression->numberOfChildren() > 0);
+  std::complex<T> result = expression->childAtIndex(0)->approximateToComplex(T(), approximationContext);
+  int childrenNumber = expression->numberOfChildren();
+  for (int i = 1; i < childrenNumber; i++) {
+    std::complex<T> nextOperand = expression->childAtIndex(i)->approximateToComplex(T(), approximationContext);
+    result = ComplexNode<T>::Normalize(computeOnComplexes(result, nextOperand, approximationContext.complexFormat()));
+    if (std::isnan(result.real()) || std::isnan(result.imag())) {
+      return std::complex<T>(NAN, NAN);
+    }
+  }
+  return result;
+}
+
 template<typename T> MatrixComplex<T> ApproximationHelper::ElementWiseOnMatrixAndComplex(const MatrixComplex<T> m, const std::complex<T> c, Poincare::Preferences::ComplexFormat complexFormat, ComplexAndComplexReduction<T> computeOnComplexes) {
   MatrixComplex<T> matrix = MatrixComplex<T>::Builder();
   int childrenNumber = m.numberOfChildren();
   for (int i = 0; i < childrenNumber; i++) {
-    matrix.addChildAtIndexInPlace(computeOnComplexes(m.complexAtIndex(i), c, complexFormat), i, i);
+    matrix.addChildAtIndexInPlace(Complex<T>::Builder(computeOnComplexes(m.complexAtIndex(i), c, complexFormat)), i, i);
   }
   matrix.setDimensions(m.numberOfRows(), m.numberOfColumns());
   return matrix;
@@ -304,7 +328,7 @@ template<typename T> MatrixComplex<T> ApproximationHelper::ElementWiseOnMatrices
   MatrixComplex<T> matrix = MatrixComplex<T>::Builder();
   int childrenNumber = m.numberOfChildren();
   for (int i = 0; i < childrenNumber; i++) {
-    matrix.addChildAtIndexInPlace(computeOnComplexes(m.complexAtIndex(i), n.complexAtIndex(i), complexFormat), i, i);
+    matrix.addChildAtIndexInPlace(Complex<T>::Builder(computeOnComplexes(m.complexAtIndex(i), n.complexAtIndex(i), complexFormat)), i, i);
   }
   matrix.setDimensions(m.numberOfRows(), m.numberOfColumns());
   return matrix;
@@ -327,14 +351,20 @@ template Poincare::Evaluation<double> Poincare::ApproximationHelper::Map(const P
 template Poincare::Evaluation<float> Poincare::ApproximationHelper::MapOneChild(const Poincare::ExpressionNode * expression, const ApproximationContext&, Poincare::ApproximationHelper::ComplexCompute<float> compute,  Poincare::ApproximationHelper::BooleanCompute<float> booleanCompute, bool mapOnList);
 template Poincare::Evaluation<double> Poincare::ApproximationHelper::MapOneChild(const Poincare::ExpressionNode * expression, const ApproximationContext&, Poincare::ApproximationHelper::ComplexCompute<double> compute, Poincare::ApproximationHelper::BooleanCompute<double> booleanCompute, bool mapOnList);
 
+template std::complex<float> Poincare::ApproximationHelper::MapOneChildToComplex(const Poincare::ExpressionNode * expression, const ApproximationContext&, Poincare::ApproximationHelper::ComplexCompute<float> compute);
+template std::complex<double> Poincare::ApproximationHelper::MapOneChildToComplex(const Poincare::ExpressionNode * expression, const ApproximationContext&, Poincare::ApproximationHelper::ComplexCompute<double> compute);
+
+template std::complex<float> Poincare::ApproximationHelper::MapReduceToComplex<float>(const Poincare::ExpressionNode * expression, const ApproximationContext& approximationContext, Poincare::ApproximationHelper::ComplexAndComplexReduction<float> computeOnComplexes);
+template std::complex<double> Poincare::ApproximationHelper::MapReduceToComplex<double>(const Poincare::ExpressionNode * expression, const ApproximationContext& approximationContext, Poincare::ApproximationHelper::ComplexAndComplexReduction<double> computeOnComplexes);
+
 template Poincare::Evaluation<float> Poincare::ApproximationHelper::MapReduce<float>(const Poincare::ExpressionNode * expression, const ApproximationContext& approximationContext, Poincare::ApproximationHelper::ReductionFunction<float> reductionFunction);
 template Poincare::Evaluation<double> Poincare::ApproximationHelper::MapReduce<double>(const Poincare::ExpressionNode * expression, const ApproximationContext& approximationContext, Poincare::ApproximationHelper::ReductionFunction<double> reductionFunction);
 
-template Poincare::MatrixComplex<float> Poincare::ApproximationHelper::ElementWiseOnMatrixAndComplex<float>(const Poincare::MatrixComplex<float>, const std::complex<float>, Poincare::Preferences::ComplexFormat, Poincare::Complex<float> (*)(std::complex<float>, std::complex<float>, Poincare::Preferences::ComplexFormat));
-template Poincare::MatrixComplex<double> Poincare::ApproximationHelper::ElementWiseOnMatrixAndComplex<double>(const Poincare::MatrixComplex<double>, std::complex<double> const, Poincare::Preferences::ComplexFormat, Poincare::Complex<double> (*)(std::complex<double>, std::complex<double>, Poincare::Preferences::ComplexFormat));
+template Poincare::MatrixComplex<float> Poincare::ApproximationHelper::ElementWiseOnMatrixAndComplex<float>(const Poincare::MatrixComplex<float>, const std::complex<float>, Poincare::Preferences::ComplexFormat, std::complex<float> (*)(std::complex<float>, std::complex<float>, Poincare::Preferences::ComplexFormat));
+template Poincare::MatrixComplex<double> Poincare::ApproximationHelper::ElementWiseOnMatrixAndComplex<double>(const Poincare::MatrixComplex<double>, std::complex<double> const, Poincare::Preferences::ComplexFormat, std::complex<double> (*)(std::complex<double>, std::complex<double>, Poincare::Preferences::ComplexFormat));
 
-template Poincare::MatrixComplex<float> Poincare::ApproximationHelper::ElementWiseOnMatrices<float>(const Poincare::MatrixComplex<float>, const Poincare::MatrixComplex<float>, Poincare::Preferences::ComplexFormat, Poincare::Complex<float> (*)(std::complex<float>, std::complex<float>, Poincare::Preferences::ComplexFormat));
-template Poincare::MatrixComplex<double> Poincare::ApproximationHelper::ElementWiseOnMatrices<double>(const Poincare::MatrixComplex<double>, const Poincare::MatrixComplex<double>, Poincare::Preferences::ComplexFormat, Poincare::Complex<double> (*)(std::complex<double>, std::complex<double>, Poincare::Preferences::ComplexFormat));
+template Poincare::MatrixComplex<float> Poincare::ApproximationHelper::ElementWiseOnMatrices<float>(const Poincare::MatrixComplex<float>, const Poincare::MatrixComplex<float>, Poincare::Preferences::ComplexFormat, std::complex<float> (*)(std::complex<float>, std::complex<float>, Poincare::Preferences::ComplexFormat));
+template Poincare::MatrixComplex<double> Poincare::ApproximationHelper::ElementWiseOnMatrices<double>(const Poincare::MatrixComplex<double>, const Poincare::MatrixComplex<double>, Poincare::Preferences::ComplexFormat, std::complex<double> (*)(std::complex<double>, std::complex<double>, Poincare::Preferences::ComplexFormat));
 
 template Poincare::Evaluation<float> Poincare::ApproximationHelper::Reduce(Poincare::Evaluation<float> eval1, Poincare::Evaluation<float> eval2, Poincare::Preferences::ComplexFormat complexFormat, Poincare::ApproximationHelper::ComplexAndComplexReduction<float> computeOnComplexes, Poincare::ApproximationHelper::ComplexAndMatrixReduction<float> computeOnComplexAndMatrix, Poincare::ApproximationHelper::MatrixAndComplexReduction<float> computeOnMatrixAndComplex, Poincare::ApproximationHelper::MatrixAndMatrixReduction<float> computeOnMatrices, bool mapOnList);
 template Poincare::Evaluation<double> Poincare::ApproximationHelper::Reduce(Poincare::Evaluation<double> eval1, Poincare::Evaluation<double> eval2, Poincare::Preferences::ComplexFormat complexFormat, Poincare::ApproximationHelper::ComplexAndComplexReduction<double> computeOnComplexes, Poincare::ApproximationHelper::ComplexAndMatrixReduction<double> computeOnComplexAndMatrix, Poincare::ApproximationHelper::MatrixAndComplexReduction<double> computeOnMatrixAndComplex, Poincare::ApproximationHelper::MatrixAndMatrixReduction<double> computeOnMatrices, bool mapOnList);
@@ -13,9 +13,9 @@ namespace Poincare {
 int ArcCosecantNode::numberOfChildren() const { return ArcCosecant::s_functionHelper.numberOfChildren(); }
 
 template<typename T>
-Complex<T> ArcCosecantNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+std::complex<T> ArcCosecantNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
   if (c == static_cast<T>(0.0)) {
-    return Complex<T>::Undefined();
+    return std::complex<T>(NAN, NAN);
   }
   return ArcSineNode::computeOnComplex<T>(std::complex<T>(1) / c, complexFormat, angleUnit);
 }
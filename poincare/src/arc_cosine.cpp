@@ -38,7 +38,7 @@ Expression ArcCosineNode::unaryFunctionDifferential(const ReductionContext& redu
 }
 
 template<typename T>
-Complex<T> ArcCosineNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
+std::complex<T> ArcCosineNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
   std::complex<T> result;
   if (c.imag() == 0 && std::fabs(c.real()) <= static_cast<T>(1.0)) {
     /* acos: [-1;1] -> R
@@ -59,7 +59,7 @@ Complex<T> ArcCosineNode::computeOnComplex(const std::complex<T> c, Preferences:
     }
   }
   result = ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(result, c);
-  return Complex<T>::Builder(Trigonometry::ConvertRadianToAngleUnit(result, angleUnit));
+  return std::complex<T>(Trigonometry::ConvertRadianToAngleUnit(result, angleUnit));
 }
 
 bool ArcCosine::derivate(const ReductionContext& reductionContext, Symbol symbol, Expression symbolValue) {
@@ -15,9 +15,9 @@ namespace Poincare {
 int ArcCotangentNode::numberOfChildren() const { return ArcCotangent::s_functionHelper.numberOfChildren(); }
 
 template<typename T>
-Complex<T> ArcCotangentNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+std::complex<T> ArcCotangentNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
   if (c == static_cast<T>(0.0)) {
-    return Complex<T>::Builder(Trigonometry::ConvertRadianToAngleUnit(std::complex<T>(M_PI_2), angleUnit));
+    return std::complex<T>(Trigonometry::ConvertRadianToAngleUnit(std::complex<T>(M_PI_2), angleUnit));
   }
   return ArcTangentNode::computeOnComplex<T>(std::complex<T>(1) / c, complexFormat, angleUnit);
 }
@@ -13,9 +13,9 @@ namespace Poincare {
 int ArcSecantNode::numberOfChildren() const { return ArcSecant::s_functionHelper.numberOfChildren(); }
 
 template<typename T>
-Complex<T> ArcSecantNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+std::complex<T> ArcSecantNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
   if (c == static_cast<T>(0.0)) {
-    return Complex<T>::Undefined();
+    return std::complex<T>(NAN, NAN);
   }
   return ArcCosineNode::computeOnComplex<T>(std::complex<T>(1) / c, complexFormat, angleUnit);
 }
@@ -37,7 +37,7 @@ Expression ArcSineNode::unaryFunctionDifferential(const ReductionContext& reduct
 }
 
 template<typename T>
-Complex<T> ArcSineNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
+std::complex<T> ArcSineNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
   std::complex<T> result;
   if (c.imag() == 0 && std::fabs(c.real()) <= static_cast<T>(1.0)) {
     /* asin: [-1;1] -> R
@@ -58,7 +58,7 @@ Complex<T> ArcSineNode::computeOnComplex(const std::complex<T> c, Preferences::C
     }
   }
   result = ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(result, c);
-  return Complex<T>::Builder(Trigonometry::ConvertRadianToAngleUnit(result, angleUnit));
+  return std::complex<T>(Trigonometry::ConvertRadianToAngleUnit(result, angleUnit));
 }
 
 bool ArcSine::derivate(const ReductionContext& reductionContext, Symbol symbol, Expression symbolValue) {
@@ -1,15 +1,111 @@
 #include <poincare/arithmetic.h>
+#include <algorithm>
 #include <utility>
 #include <poincare/expression.h>
 #include <poincare/rational.h>
 
+#include <assert.h>
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 namespace Poincare {
 
 Arithmetic * Arithmetic::s_lock = nullptr;
 
+/* Binary GCD (Stein's algorithm) on the digits of the integers. It only
+ * relies on shifts and subtractions, which are much cheaper than the
+ * divisions of Euclid's algorithm. */
+
+static int CountTrailingZeros(native_uint_t d) {
+  assert(d != 0);
+  return __builtin_ctzll(d);
+}
+
+static native_uint_t NativeGCD(native_uint_t u, native_uint_t v) {
+  assert(u != 0 && v != 0);
+  int shift = CountTrailingZeros(u | v);
+  u >>= CountTrailingZeros(u);
+  do {
+    v >>= CountTrailingZeros(v);
+    if (u > v) {
+      std::swap(u, v);
+    }
+    v -= u;
+  } while (v != 0);
+  return u << shift;
+}
+
+static int TrailingZeros(const native_uint_t * digits) {
+  int i = 0;
+  while (digits[i] == 0) {
+    i++;
+  }
+  return i*Integer::k_numberOfBitsInDigit + CountTrailingZeros(digits[i]);
+}
+
+static uint8_t ShiftRight(native_uint_t * digits, uint8_t numberOfDigits, int shift) {
+  // Return the new number of digits of digits >> shift
+  int digitShift = shift / Integer::k_numberOfBitsInDigit;
+  int bitShift = shift % Integer::k_numberOfBitsInDigit;
+  int newNumberOfDigits = numberOfDigits - digitShift;
+  for (int i = 0; i < newNumberOfDigits; i++) {
+    native_uint_t high = i + digitShift + 1 < numberOfDigits ? digits[i + digitShift + 1] : 0;
+    digits[i] = bitShift == 0 ? digits[i + digitShift] : (digits[i + digitShift] >> bitShift) | (high << (Integer::k_numberOfBitsInDigit - bitShift));
+  }
+  while (newNumberOfDigits > 0 && digits[newNumberOfDigits - 1] == 0) {
+    newNumberOfDigits--;
+  }
+  return newNumberOfDigits;
+}
+
+static uint8_t ShiftLeft(native_uint_t * digits, uint8_t numberOfDigits, int shift) {
+  // Return the new number of digits of digits << shift, which has to fit
+  int digitShift = shift / Integer::k_numberOfBitsInDigit;
+  int bitShift = shift % Integer::k_numberOfBitsInDigit;
+  int newNumberOfDigits = numberOfDigits + digitShift + 1;
+  assert(newNumberOfDigits <= Integer::k_maxNumberOfDigits + 1);
+  for (int i = newNumberOfDigits - 1; i >= 0; i--) {
+    int j = i - digitShift;
+    native_uint_t high = j >= 0 && j < numberOfDigits ? digits[j] : 0;
+    native_uint_t low = j >= 1 && j - 1 < numberOfDigits ? digits[j - 1] : 0;
+    digits[i] = bitShift == 0 ? high : (high << bitShift) | (low >> (Integer::k_numberOfBitsInDigit - bitShift));
+  }
+  while (newNumberOfDigits > 0 && digits[newNumberOfDigits - 1] == 0) {
+    newNumberOfDigits--;
+  }
+  return newNumberOfDigits;
+}
+
+static int Compare(const native_uint_t * u, uint8_t uNumberOfDigits, const native_uint_t * v, uint8_t vNumberOfDigits) {
+  if (uNumberOfDigits != vNumberOfDigits) {
+    return uNumberOfDigits < vNumberOfDigits ? -1 : 1;
+  }
+  for (int i = uNumberOfDigits - 1; i >= 0; i--) {
+    if (u[i] != v[i]) {
+      return u[i] < v[i] ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+static uint8_t Subtract(native_uint_t * v, uint8_t vNumberOfDigits, const native_uint_t * u, uint8_t uNumberOfDigits) {
+  // v -= u knowing that v >= u, return the new number of digits of v
+  native_uint_t borrow = 0;
+  for (int i = 0; i < vNumberOfDigits; i++) {
+    native_uint_t ui = i < uNumberOfDigits ? u[i] : 0;
+    native_uint_t difference = v[i] - ui;
+    native_uint_t newBorrow = v[i] < ui;
+    v[i] = difference - borrow;
+    borrow = newBorrow | (difference < borrow);
+  }
+  assert(borrow == 0);
+  while (vNumberOfDigits > 0 && v[vNumberOfDigits - 1] == 0) {
+    vNumberOfDigits--;
+  }
+  return vNumberOfDigits;
+}
+
 Integer Arithmetic::GCD(const Integer & a, const Integer & b) {
   if (a.isOverflow() || b.isOverflow()) {
     return Integer::Overflow(false);
@@ -18,22 +114,54 @@ Integer Arithmetic::GCD(const Integer & a, const Integer & b) {
   Integer j = b;
   i.setNegative(false);
   j.setNegative(false);
-  if (i.isEqualTo(j)) {
+  if (i.isZero()) {
+    return j;
+  }
+  if (j.isZero()) {
     return i;
   }
-  do {
-    if (i.isZero()) {
-      return j;
-    }
-    if (j.isZero()) {
-      return i;
+  /* When the sizes of the integers differ, a first Euclidean step brings the
+   * greatest one below the smallest one, which binary steps would take many
+   * iterations to do. */
+  if (i.numberOfDigits() > j.numberOfDigits()) {
+    i = Integer::Division(i, j).remainder;
+  } else if (j.numberOfDigits() > i.numberOfDigits()) {
+    j = Integer::Division(j, i).remainder;
+  }
+  if (i.isZero()) {
+    return j;
+  }
+  if (j.isZero()) {
+    return i;
+  }
+  // Static to save memory on stack
+  static native_uint_t s_u[Integer::k_maxNumberOfDigits + 1];
+  static native_uint_t s_v[Integer::k_maxNumberOfDigits + 1];
+  native_uint_t * u = s_u;
+  native_uint_t * v = s_v;
+  uint8_t uNumberOfDigits = i.numberOfDigits();
+  uint8_t vNumberOfDigits = j.numberOfDigits();
+  memcpy(u, i.digits(), uNumberOfDigits*sizeof(native_uint_t));
+  memcpy(v, j.digits(), vNumberOfDigits*sizeof(native_uint_t));
+  int uShift = TrailingZeros(u);
+  int vShift = TrailingZeros(v);
+  int shift = std::min(uShift, vShift);
+  uNumberOfDigits = ShiftRight(u, uNumberOfDigits, uShift);
+  // u is odd, make v odd and subtract the smallest from the greatest
+  while (vNumberOfDigits > 0) {
+    if (uNumberOfDigits == 1 && vNumberOfDigits == 1) {
+      u[0] = NativeGCD(u[0], v[0]);
+      break;
     }
-    if (Integer::NaturalOrder(i, j) > 0) {
-      i = Integer::Division(i, j).remainder;
-    } else {
-      j = Integer::Division(j, i).remainder;
+    vNumberOfDigits = ShiftRight(v, vNumberOfDigits, TrailingZeros(v));
+    if (Compare(u, uNumberOfDigits, v, vNumberOfDigits) > 0) {
+      std::swap(u, v);
+      std::swap(uNumberOfDigits, vNumberOfDigits);
     }
-  } while(true);
+    vNumberOfDigits = Subtract(v, vNumberOfDigits, u, uNumberOfDigits);
+  }
+  uNumberOfDigits = ShiftLeft(u, uNumberOfDigits, shift);
+  return Integer::BuildInteger(u, uNumberOfDigits, false);
 }
 
 Integer Arithmetic::LCM(const Integer & a, const Integer & b) {
@@ -156,10 +284,498 @@ Evaluation<T> Arithmetic::LCM(const ExpressionNode & expressionNode, const Appro
   return applyAssociativeFunctionOnChildren<T>(expressionNode, Arithmetic::LCM, approximationContext);
 }
 
-const short primeFactors[Arithmetic::k_numberOfPrimeFactors] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131, 137, 139, 149, 151, 157, 163, 167, 173, 179, 181, 191, 193, 197, 199, 211, 223, 227, 229, 233, 239, 241, 251, 257, 263, 269, 271, 277, 281, 283, 293, 307, 311, 313, 317, 331, 337, 347, 349, 353, 359, 367, 373, 379, 383, 389, 397, 401, 409, 419, 421, 431, 433, 439, 443, 449, 457, 461, 463, 467, 479, 487, 491, 499, 503, 509, 521, 523, 541, 547, 557, 563, 569, 571, 577, 587, 593, 599, 601, 607, 613, 617, 619, 631, 641, 643, 647, 653, 659, 661, 673, 677, 683, 691, 701, 709, 719, 727, 733, 739, 743, 751, 757, 761, 769, 773, 787, 797, 809, 811, 821, 823, 827, 829, 839, 853, 857, 859, 863, 877, 881, 883, 887, 907, 911, 919, 929, 937, 941, 947, 953, 967, 971, 977, 983, 991, 997, 1009, 1013, 1019, 1021, 1031, 1033, 1039, 1049, 1051, 1061, 1063, 1069, 1087, 1091, 1093, 1097, 1103, 1109, 1117, 1123, 1129, 1151, 1153, 1163, 1171, 1181, 1187, 1193, 1201, 1213, 1217, 1223, 1229, 1231, 1237, 1249, 1259, 1277, 1279, 1283, 1289, 1291, 1297, 1301, 1303, 1307, 1319, 1321, 1327, 1361, 1367, 1373, 1381, 1399, 1409, 1423, 1427, 1429, 1433, 1439, 1447, 1451, 1453, 1459, 1471, 1481, 1483, 1487, 1489, 1493, 1499, 1511, 1523, 1531, 1543, 1549, 1553, 1559, 1567, 1571, 1579, 1583, 1597, 1601, 1607, 1609, 1613, 1619, 1621, 1627, 1637, 1657, 1663, 1667, 1669, 1693, 1697, 1699, 1709, 1721, 1723, 1733, 1741, 1747, 1753, 1759, 1777, 1783, 1787, 1789, 1801, 1811, 1823, 1831, 1847, 1861, 1867, 1871, 1873, 1877, 1879, 1889, 1901, 1907, 1913, 1931, 1933, 1949, 1951, 1973, 1979, 1987, 1993, 1997, 1999, 2003, 2011, 2017, 2027, 2029, 2039, 2053, 2063, 2069, 2081, 2083, 2087, 2089, 2099, 2111, 2113, 2129, 2131, 2137, 2141, 2143, 2153, 2161, 2179, 2203, 2207, 2213, 2221, 2237, 2239, 2243, 2251, 2267, 2269, 2273, 2281, 2287, 2293, 2297, 2309, 2311, 2333, 2339, 2341, 2347, 2351, 2357, 2371, 2377, 2381, 2383, 2389, 2393, 2399, 2411, 2417, 2423, 2437, 2441, 2447, 2459, 2467, 2473, 2477, 2503, 2521, 2531, 2539, 2543, 2549, 2551, 2557, 2579, 2591, 2593, 2609, 2617, 2621, 2633, 2647, 2657, 2659, 2663, 2671, 2677, 2683, 2687, 2689, 2693, 2699, 2707, 2711, 2713, 2719, 2729, 2731, 2741, 2749, 2753, 2767, 2777, 2789, 2791, 2797, 2801, 2803, 2819, 2833, 2837, 2843, 2851, 2857, 2861, 2879, 2887, 2897, 2903, 2909, 2917, 2927, 2939, 2953, 2957, 2963, 2969, 2971, 2999, 3001, 3011, 3019, 3023, 3037, 3041, 3049, 3061, 3067, 3079, 3083, 3089, 3109, 3119, 3121, 3137, 3163, 3167, 3169, 3181, 3187, 3191, 3203, 3209, 3217, 3221, 3229, 3251, 3253, 3257, 3259, 3271, 3299, 3301, 3307, 3313, 3319, 3323, 3329, 3331, 3343, 3347, 3359, 3361, 3371, 3373, 3389, 3391, 3407, 3413, 3433, 3449, 3457, 3461, 3463, 3467, 3469, 3491, 3499, 3511, 3517, 3527, 3529, 3533, 3539, 3541, 3547, 3557, 3559, 3571, 3581, 3583, 3593, 3607, 3613, 3617, 3623, 3631, 3637, 3643,
-  3659, 3671, 3673, 3677, 3691, 3697, 3701, 3709, 3719, 3727, 3733, 3739, 3761, 3767, 3769, 3779, 3793, 3797, 3803, 3821, 3823, 3833, 3847, 3851, 3853, 3863, 3877, 3881, 3889, 3907, 3911, 3917, 3919, 3923, 3929, 3931, 3943, 3947, 3967, 3989, 4001, 4003, 4007, 4013, 4019, 4021, 4027, 4049, 4051, 4057, 4073, 4079, 4091, 4093, 4099, 4111, 4127, 4129, 4133, 4139, 4153, 4157, 4159, 4177, 4201, 4211, 4217, 4219, 4229, 4231, 4241, 4243, 4253, 4259, 4261, 4271, 4273, 4283, 4289, 4297, 4327, 4337, 4339, 4349, 4357, 4363, 4373, 4391, 4397, 4409, 4421, 4423, 4441, 4447, 4451, 4457, 4463, 4481, 4483, 4493, 4507, 4513, 4517, 4519, 4523, 4547, 4549, 4561, 4567, 4583, 4591, 4597, 4603, 4621, 4637, 4639, 4643, 4649, 4651, 4657, 4663, 4673, 4679, 4691, 4703, 4721, 4723, 4729, 4733, 4751, 4759, 4783, 4787, 4789, 4793, 4799, 4801, 4813, 4817, 4831, 4861, 4871, 4877, 4889, 4903, 4909, 4919, 4931, 4933, 4937, 4943, 4951, 4957, 4967, 4969, 4973, 4987, 4993, 4999, 5003, 5009, 5011, 5021, 5023, 5039, 5051, 5059, 5077, 5081, 5087, 5099, 5101, 5107, 5113, 5119, 5147, 5153, 5167, 5171, 5179, 5189, 5197, 5209, 5227, 5231, 5233, 5237, 5261, 5273, 5279, 5281, 5297, 5303, 5309, 5323, 5333, 5347, 5351, 5381, 5387, 5393, 5399, 5407, 5413, 5417, 5419, 5431, 5437, 5441, 5443, 5449, 5471, 5477, 5479, 5483, 5501, 5503, 5507, 5519, 5521, 5527, 5531, 5557, 5563, 5569, 5573, 5581, 5591, 5623, 5639, 5641, 5647, 5651, 5653, 5657, 5659, 5669, 5683, 5689, 5693, 5701, 5711, 5717, 5737, 5741, 5743, 5749, 5779, 5783, 5791, 5801, 5807, 5813, 5821, 5827, 5839, 5843, 5849, 5851, 5857, 5861, 5867, 5869, 5879, 5881, 5897, 5903, 5923, 5927, 5939, 5953, 5981, 5987, 6007, 6011, 6029, 6037, 6043, 6047, 6053, 6067, 6073, 6079, 6089, 6091, 6101, 6113, 6121, 6131, 6133, 6143, 6151, 6163, 6173, 6197, 6199, 6203, 6211, 6217, 6221, 6229, 6247, 6257, 6263, 6269, 6271, 6277, 6287, 6299, 6301, 6311, 6317, 6323, 6329, 6337, 6343, 6353, 6359, 6361, 6367, 6373, 6379, 6389, 6397, 6421, 6427, 6449, 6451, 6469, 6473, 6481, 6491, 6521, 6529, 6547, 6551, 6553, 6563, 6569, 6571, 6577, 6581, 6599, 6607, 6619, 6637, 6653, 6659, 6661, 6673, 6679, 6689, 6691, 6701, 6703, 6709, 6719, 6733, 6737, 6761, 6763, 6779, 6781, 6791, 6793, 6803, 6823, 6827, 6829, 6833, 6841, 6857, 6863, 6869, 6871, 6883, 6899, 6907, 6911, 6917, 6947, 6949, 6959, 6961, 6967, 6971, 6977, 6983, 6991, 6997, 7001, 7013, 7019, 7027, 7039, 7043, 7057, 7069, 7079, 7103, 7109, 7121, 7127, 7129, 7151, 7159, 7177, 7187, 7193, 7207, 7211, 7213, 7219, 7229, 7237, 7243, 7247, 7253, 7283, 7297, 7307, 7309, 7321, 7331, 7333, 7349, 7351, 7369, 7393, 7411, 7417, 7433, 7451, 7457, 7459, 7477, 7481, 7487, 7489, 7499, 7507, 7517, 7523, 7529, 7537, 7541, 7547, 7549, 7559, 7561, 7573, 7577, 7583, 7589, 7591, 7603, 7607, 7621, 7639, 7643, 7649, 7669, 7673, 7681, 7687, 7691, 7699, 7703, 7717, 7723, 7727, 7741, 7753, 7757, 7759, 7789, 7793, 7817, 7823, 7829, 7841, 7853, 7867, 7873, 7877, 7879, 7883, 7901, 7907, 7919};
+/* Primes below k_biggestPrimeFactor are tabulated with a wheel sieve: numbers
+ * are grouped by 30 and each byte of the table tells which of the 8 numbers of
+ * its group that are coprime with 30 are prime. The table is computed at
+ * compile time so that it lives in flash. */
+
+constexpr static int k_wheelSize = 30;
+constexpr static int k_numberOfWheelResidues = 8;
+constexpr static uint8_t k_wheelResidues[k_numberOfWheelResidues] = {1, 7, 11, 13, 17, 19, 23, 29};
+
+constexpr static int WheelIndex(int residue) {
+  for (int i = 0; i < k_numberOfWheelResidues; i++) {
+    if (k_wheelResidues[i] == residue) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+class PrimeTable {
+public:
+  constexpr static int k_bound = 1 << 16;
+  constexpr static int k_size = (k_bound + k_wheelSize - 1) / k_wheelSize;
+  constexpr PrimeTable() : m_bits() {
+    for (int i = 0; i < k_size; i++) {
+      m_bits[i] = 0xFF;
+    }
+    // 1 is not a prime
+    m_bits[0] &= ~1;
+    for (int p = 7; p * p < k_bound; p += 2) {
+      if (!isPrime(p)) {
+        continue;
+      }
+      for (int multiple = p * p; multiple < k_bound; multiple += 2 * p) {
+        int index = WheelIndex(multiple % k_wheelSize);
+        if (index >= 0) {
+          m_bits[multiple / k_wheelSize] &= ~(1 << index);
+        }
+      }
+    }
+  }
+  constexpr bool isPrime(int n) const {
+    assert(n >= 0 && n < k_bound);
+    if (n < 7) {
+      return n == 2 || n == 3 || n == 5;
+    }
+    int index = WheelIndex(n % k_wheelSize);
+    return index >= 0 && (m_bits[n / k_wheelSize] >> index) & 1;
+  }
+  constexpr int numberOfPrimes() const {
+    int result = 3; // 2, 3 and 5
+    for (int i = 0; i < k_size; i++) {
+      for (int j = 0; j < k_numberOfWheelResidues; j++) {
+        result += k_wheelSize * i + k_wheelResidues[j] < k_bound && (m_bits[i] >> j) & 1;
+      }
+    }
+    return result;
+  }
+  // Return the smallest prime above p, or 0 beyond the table
+  int nextPrime(int p) const {
+    if (p < 5) {
+      return p < 2 ? 2 : p + 1 + (p == 3);
+    }
+    int i = p / k_wheelSize;
+    int j = WheelIndex(p % k_wheelSize) + 1;
+    while (i < k_size) {
+      for (; j < k_numberOfWheelResidues; j++) {
+        if ((m_bits[i] >> j) & 1) {
+          int next = k_wheelSize * i + k_wheelResidues[j];
+          return next < k_bound ? next : 0;
+        }
+      }
+      i++;
+      j = 0;
+    }
+    return 0;
+  }
+private:
+  uint8_t m_bits[k_size];
+};
+
+constexpr static PrimeTable k_primeTable;
+static_assert(PrimeTable::k_bound == Arithmetic::k_biggestPrimeFactor, "The prime table should cover the prime factors tested by trial division");
+static_assert(k_primeTable.numberOfPrimes() == Arithmetic::k_numberOfPrimeFactors, "The number of tabulated primes is wrong");
+
+/* Beyond the table, the cofactor is tested with Miller-Rabin and split with
+ * Pollard-Brent rho. Both only compute modular products, which are done in
+ * Montgomery form on the digits to avoid building Integers in the loops. */
+
+class MontgomeryModulus {
+public:
+  constexpr static int k_maxNumberOfDigits = Integer::k_maxNumberOfDigits / 2;
+  struct Residue {
+    native_uint_t digits[k_maxNumberOfDigits];
+  };
+
+  MontgomeryModulus(const Integer & n) : m_numberOfDigits(n.numberOfDigits()) {
+    assert(!n.isEven() && m_numberOfDigits <= k_maxNumberOfDigits);
+    memcpy(m_modulus.digits, n.digits(), m_numberOfDigits * sizeof(native_uint_t));
+    // Newton's iteration doubles the number of correct bits of n^-1 each time
+    native_uint_t inverse = m_modulus.digits[0];
+    for (int i = 0; i < 6; i++) {
+      inverse *= 2 - m_modulus.digits[0] * inverse;
+    }
+    m_inverse = -inverse;
+    // R = 2^(k_numberOfBitsInDigit*m_numberOfDigits)
+    native_uint_t powerOfTwo[k_maxNumberOfDigits + 1] = {};
+    powerOfTwo[m_numberOfDigits] = 1;
+    Integer r = Integer::Division(Integer::BuildInteger(powerOfTwo, m_numberOfDigits + 1, false), n).remainder;
+    set(&m_one, r);
+    set(&m_rSquare, Integer::Division(Integer::Multiplication(r, r), n).remainder);
+  }
+
+  void convert(Residue * result, native_uint_t value) const {
+    Residue r = {};
+    r.digits[0] = value;
+    multiply(result, r, m_rSquare);
+  }
+  void convert(Residue * result, const Integer & value) const {
+    Residue r;
+    set(&r, value);
+    multiply(result, r, m_rSquare);
+  }
+  const Residue & one() const { return m_one; }
+  // -1 in Montgomery form is n-R
+  void minusOne(Residue * result) const { subtract(result, m_modulus, m_one); }
+  bool isEqual(const Residue & a, const Residue & b) const { return memcmp(a.digits, b.digits, m_numberOfDigits * sizeof(native_uint_t)) == 0; }
+  // The gcd of a Montgomery residue with n is the gcd of the residue itself
+  Integer toInteger(const Residue & a) const {
+    Residue copy = a;
+    int numberOfDigits = m_numberOfDigits;
+    while (numberOfDigits > 0 && copy.digits[numberOfDigits - 1] == 0) {
+      numberOfDigits--;
+    }
+    return Integer::BuildInteger(copy.digits, numberOfDigits, false);
+  }
+
+  void multiply(Residue * result, const Residue & a, const Residue & b) const {
+    // Coarsely Integrated Operand Scanning
+    native_uint_t t[k_maxNumberOfDigits + 2] = {};
+    int n = m_numberOfDigits;
+    for (int i = 0; i < n; i++) {
+      double_native_uint_t carry = 0;
+      for (int j = 0; j < n; j++) {
+        carry += static_cast<double_native_uint_t>(a.digits[j]) * b.digits[i] + t[j];
+        t[j] = static_cast<native_uint_t>(carry);
+        carry >>= Integer::k_numberOfBitsInDigit;
+      }
+      carry += t[n];
+      t[n] = static_cast<native_uint_t>(carry);
+      t[n + 1] = static_cast<native_uint_t>(carry >> Integer::k_numberOfBitsInDigit);
+      native_uint_t m = t[0] * m_inverse;
+      carry = (static_cast<double_native_uint_t>(m) * m_modulus.digits[0] + t[0]) >> Integer::k_numberOfBitsInDigit;
+      for (int j = 1; j < n; j++) {
+        carry += static_cast<double_native_uint_t>(m) * m_modulus.digits[j] + t[j];
+        t[j - 1] = static_cast<native_uint_t>(carry);
+        carry >>= Integer::k_numberOfBitsInDigit;
+      }
+      carry += t[n];
+      t[n - 1] = static_cast<native_uint_t>(carry);
+      t[n] = t[n + 1] + static_cast<native_uint_t>(carry >> Integer::k_numberOfBitsInDigit);
+    }
+    memcpy(result->digits, t, n * sizeof(native_uint_t));
+    if (t[n] != 0 || !isSmallerThanModulus(*result)) {
+      rawSubtract(result, *result, m_modulus);
+    }
+  }
+  void add(Residue * result, const Residue & a, const Residue & b) const {
+    native_uint_t carry = 0;
+    for (int i = 0; i < m_numberOfDigits; i++) {
+      native_uint_t sum = a.digits[i] + carry;
+      carry = sum < carry;
+      result->digits[i] = sum + b.digits[i];
+      carry += result->digits[i] < sum;
+    }
+    if (carry != 0 || !isSmallerThanModulus(*result)) {
+      rawSubtract(result, *result, m_modulus);
+    }
+  }
+  // Return a-b, plus n if b > a
+  void subtract(Residue * result, const Residue & a, const Residue & b) const {
+    if (rawSubtract(result, a, b)) {
+      Residue difference = *result;
+      native_uint_t carry = 0;
+      for (int i = 0; i < m_numberOfDigits; i++) {
+        native_uint_t sum = difference.digits[i] + carry;
+        carry = sum < carry;
+        result->digits[i] = sum + m_modulus.digits[i];
+        carry += result->digits[i] < sum;
+      }
+    }
+  }
+
+private:
+  void set(Residue * result, const Integer & value) const {
+    assert(value.numberOfDigits() <= m_numberOfDigits);
+    memset(result->digits, 0, sizeof(result->digits));
+    memcpy(result->digits, value.digits(), value.numberOfDigits() * sizeof(native_uint_t));
+  }
+  bool isSmallerThanModulus(const Residue & a) const {
+    for (int i = m_numberOfDigits - 1; i >= 0; i--) {
+      if (a.digits[i] != m_modulus.digits[i]) {
+        return a.digits[i] < m_modulus.digits[i];
+      }
+    }
+    return false;
+  }
+  // Return the borrow of a-b
+  bool rawSubtract(Residue * result, const Residue & a, const Residue & b) const {
+    native_uint_t borrow = 0;
+    for (int i = 0; i < m_numberOfDigits; i++) {
+      native_uint_t difference = a.digits[i] - borrow;
+      borrow = difference > a.digits[i];
+      result->digits[i] = difference - b.digits[i];
+      borrow += result->digits[i] > difference;
+    }
+    return borrow != 0;
+  }
+
+  Residue m_modulus;
+  Residue m_one;
+  Residue m_rSquare;
+  native_uint_t m_inverse;
+  int m_numberOfDigits;
+};
+
+static bool IsSquare(const Integer & n) {
+  // Newton's iteration decreases towards floor(sqrt(n)) from above
+  Integer x = Integer::Power(Integer(2), Integer((n.numberOfDigits() * Integer::k_numberOfBitsInDigit + 1) / 2));
+  while (true) {
+    Integer y = Integer::Division(Integer::Addition(x, Integer::Division(n, x).quotient), Integer(2)).quotient;
+    if (Integer::NaturalOrder(y, x) >= 0) {
+      break;
+    }
+    x = y;
+  }
+  return Integer::Multiplication(x, x).isEqualTo(n);
+}
+
+static int JacobiSymbol(int a, int m) {
+  // m is odd and positive, a is non negative
+  assert(m > 0 && m % 2 == 1 && a >= 0);
+  int result = 1;
+  a %= m;
+  while (a != 0) {
+    while (a % 2 == 0) {
+      a /= 2;
+      if (m % 8 == 3 || m % 8 == 5) {
+        result = -result;
+      }
+    }
+    std::swap(a, m);
+    if (a % 4 == 3 && m % 4 == 3) {
+      result = -result;
+    }
+    a %= m;
+  }
+  return m == 1 ? result : 0;
+}
+
+static void ConvertSigned(const MontgomeryModulus & modulus, MontgomeryModulus::Residue * result, int value) {
+  modulus.convert(result, static_cast<native_uint_t>(value < 0 ? -value : value));
+  if (value < 0) {
+    MontgomeryModulus::Residue zero = {};
+    modulus.subtract(result, zero, *result);
+  }
+}
+
+static bool IsStrongProbablePrimeToBaseTwo(const Integer & n, const MontgomeryModulus & modulus) {
+  // n-1 = d*2^s with d odd
+  Integer d = Integer::Subtraction(n, Integer(1));
+  int s = 0;
+  while (d.isEven()) {
+    d = Integer::Division(d, Integer(2)).quotient;
+    s++;
+  }
+  MontgomeryModulus::Residue minusOne;
+  modulus.minusOne(&minusOne);
+  // x = 2^d
+  MontgomeryModulus::Residue b;
+  modulus.convert(&b, 2);
+  MontgomeryModulus::Residue x = modulus.one();
+  const native_uint_t * digits = d.digits();
+  for (int i = d.numberOfDigits() * Integer::k_numberOfBitsInDigit - 1; i >= 0; i--) {
+    modulus.multiply(&x, x, x);
+    if ((digits[i / Integer::k_numberOfBitsInDigit] >> (i % Integer::k_numberOfBitsInDigit)) & 1) {
+      modulus.multiply(&x, x, b);
+    }
+  }
+  if (modulus.isEqual(x, modulus.one()) || modulus.isEqual(x, minusOne)) {
+    return true;
+  }
+  for (int r = 1; r < s; r++) {
+    modulus.multiply(&x, x, x);
+    if (modulus.isEqual(x, minusOne)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool IsStrongLucasProbablePrime(const Integer & n, const MontgomeryModulus & modulus) {
+  /* Selfridge's parameters: D is the first of 5, -7, 9, -11... such that
+   * (D/n) = -1, P = 1 and Q = (1-D)/4. No such D exists if n is a square. */
+  int nModulo4 = n.digits()[0] & 3;
+  int D = 5;
+  for (int i = 0; ; i++) {
+    int absD = D < 0 ? -D : D;
+    int jacobi = JacobiSymbol(Integer::Division(n, Integer(absD)).remainder.extractedInt(), absD);
+    // Quadratic reciprocity, with (-1/n) = -1 if n = 3 mod 4
+    if (absD % 4 == 3 && nModulo4 == 3) {
+      jacobi = -jacobi;
+    }
+    if (D < 0 && nModulo4 == 3) {
+      jacobi = -jacobi;
+    }
+    if (jacobi == -1) {
+      break;
+    }
+    if (jacobi == 0) {
+      // |D| < n divides n
+      return false;
+    }
+    if (i == 8 && IsSquare(n)) {
+      return false;
+    }
+    D = D < 0 ? 2 - D : -2 - D;
+  }
+  MontgomeryModulus::Residue d, q, half;
+  ConvertSigned(modulus, &d, D);
+  ConvertSigned(modulus, &q, (1 - D) / 4);
+  // 1/2 = (n+1)/2 mod n
+  Integer nPlusOne = Integer::Addition(n, Integer(1));
+  modulus.convert(&half, Integer::Division(nPlusOne, Integer(2)).quotient);
+  // n+1 = k*2^s with k odd
+  Integer k = nPlusOne;
+  int s = 0;
+  while (k.isEven()) {
+    k = Integer::Division(k, Integer(2)).quotient;
+    s++;
+  }
+  /* Compute U_k, V_k and Q^k from the most significant bit of k, with
+   * U_2j = U_j*V_j, V_2j = V_j^2-2*Q^j,
+   * U_(j+1) = (P*U_j+V_j)/2 and V_(j+1) = (D*U_j+P*V_j)/2. */
+  MontgomeryModulus::Residue u = modulus.one(), v = modulus.one(), qk = q, t;
+  const native_uint_t * digits = k.digits();
+  int i = k.numberOfDigits() * Integer::k_numberOfBitsInDigit - 1;
+  while (!((digits[i / Integer::k_numberOfBitsInDigit] >> (i % Integer::k_numberOfBitsInDigit)) & 1)) {
+    i--;
+  }
+  for (i--; i >= 0; i--) {
+    modulus.multiply(&u, u, v);
+    modulus.multiply(&v, v, v);
+    modulus.subtract(&v, v, qk);
+    modulus.subtract(&v, v, qk);
+    modulus.multiply(&qk, qk, qk);
+    if ((digits[i / Integer::k_numberOfBitsInDigit] >> (i % Integer::k_numberOfBitsInDigit)) & 1) {
+      modulus.multiply(&t, d, u);
+      modulus.add(&u, u, v);
+      modulus.multiply(&u, u, half);
+      modulus.add(&v, v, t);
+      modulus.multiply(&v, v, half);
+      modulus.multiply(&qk, qk, q);
+    }
+  }
+  MontgomeryModulus::Residue zero = {};
+  if (modulus.isEqual(u, zero) || modulus.isEqual(v, zero)) {
+    return true;
+  }
+  for (int r = 1; r < s; r++) {
+    modulus.multiply(&v, v, v);
+    modulus.subtract(&v, v, qk);
+    modulus.subtract(&v, v, qk);
+    modulus.multiply(&qk, qk, qk);
+    if (modulus.isEqual(v, zero)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool IsProbablePrime(const Integer & n) {
+  // n is odd and has no prime factor in the table
+  assert(!n.isEven());
+  if (Integer::NaturalOrder(n, Integer::Multiplication(Integer(k_primeTable.k_bound), Integer(k_primeTable.k_bound))) < 0) {
+    return true;
+  }
+  /* Baillie-PSW test: no composite is known to pass both a strong probable
+   * prime test to base 2 and a strong Lucas probable prime test, and none
+   * exists below 2^64. Fixed sets of Miller-Rabin bases are only deterministic
+   * far below the factorized integers. */
+  MontgomeryModulus modulus(n);
+  return IsStrongProbablePrimeToBaseTwo(n, modulus) && IsStrongLucasProbablePrime(n, modulus);
+}
+
+static Integer PollardBrentFactor(const Integer & n, int c, int * remainingIterations) {
+  /* Return a non trivial factor of the composite n by looking for a cycle in
+   * the sequence y -> y^2+c mod n, or 1 if none was found. The differences are
+   * accumulated in q to compute a gcd only every batchSize iterations. */
+  constexpr int batchSize = 64;
+  MontgomeryModulus modulus(n);
+  MontgomeryModulus::Residue constant, x, y, ys, q, difference;
+  modulus.convert(&constant, c);
+  modulus.convert(&y, 2);
+  q = modulus.one();
+  Integer g(1);
+  for (int r = 1; g.isOne(); r *= 2) {
+    if (*remainingIterations <= 0) {
+      return Integer(1);
+    }
+    x = y;
+    for (int i = 0; i < r; i++) {
+      modulus.multiply(&y, y, y);
+      modulus.add(&y, y, constant);
+    }
+    *remainingIterations -= r;
+    for (int k = 0; k < r && g.isOne(); k += batchSize) {
+      ys = y;
+      int batch = std::min(batchSize, r - k);
+      for (int i = 0; i < batch; i++) {
+        modulus.multiply(&y, y, y);
+        modulus.add(&y, y, constant);
+        modulus.subtract(&difference, x, y);
+        modulus.multiply(&q, q, difference);
+      }
+      *remainingIterations -= batch;
+      g = Arithmetic::GCD(modulus.toInteger(q), n);
+    }
+  }
+  if (g.isEqualTo(n)) {
+    // The batch overshot the cycle, retry its iterations one by one
+    do {
+      modulus.multiply(&ys, ys, ys);
+      modulus.add(&ys, ys, constant);
+      modulus.subtract(&difference, x, ys);
+      g = Arithmetic::GCD(modulus.toInteger(difference), n);
+    } while (g.isOne());
+  }
+  return g.isEqualTo(n) ? Integer(1) : g;
+}
+
+bool Arithmetic::addFactor(const Integer & factor, const Integer & coefficient, int * numberOfFactors) {
+  // Keep the factors sorted
+  int index = 0;
+  while (index < *numberOfFactors && Integer::NaturalOrder(*factorAtIndex(index), factor) < 0) {
+    index++;
+  }
+  if (index < *numberOfFactors && factorAtIndex(index)->isEqualTo(factor)) {
+    *coefficientAtIndex(index) = Integer::Addition(*coefficientAtIndex(index), coefficient);
+    return true;
+  }
+  if (*numberOfFactors == k_maxNumberOfFactors) {
+    return false;
+  }
+  for (int i = *numberOfFactors; i > index; i--) {
+    *factorAtIndex(i) = *factorAtIndex(i - 1);
+    *coefficientAtIndex(i) = *coefficientAtIndex(i - 1);
+  }
+  *factorAtIndex(index) = factor;
+  *coefficientAtIndex(index) = coefficient;
+  (*numberOfFactors)++;
+  return true;
+}
+
+int Arithmetic::factorizeCofactor(const Integer & m, const Integer & coefficient, int * numberOfFactors, int * remainingIterations) {
+  // m has no prime factor in the table
+  if (IsProbablePrime(m)) {
+    return addFactor(m, coefficient, numberOfFactors) ? 0 : k_errorTooManyFactors;
+  }
+  for (int c = 1; *remainingIterations > 0; c++) {
+    Integer d = PollardBrentFactor(m, c, remainingIterations);
+    if (d.isOne()) {
+      continue;
+    }
+    /* Split m into d^k*e with e coprime with d, since finding d again in e
+     * would cost another search. */
+    Integer e = Integer::Division(m, d).quotient;
+    Integer k(1);
+    IntegerDivision division = Integer::Division(e, d);
+    while (division.remainder.isZero()) {
+      e = division.quotient;
+      k = Integer::Addition(k, Integer(1));
+      division = Integer::Division(e, d);
+    }
+    int error = factorizeCofactor(d, Integer::Multiplication(k, coefficient), numberOfFactors, remainingIterations);
+    if (error == 0 && !e.isOne()) {
+      error = factorizeCofactor(e, coefficient, numberOfFactors, remainingIterations);
+    }
+    return error;
+  }
+  return k_errorFactorTooLarge;
+}
 
-// we can go to 7907*7907 = 62 520 649
 int Arithmetic::PrimeFactorization(const Integer & n) {
   assert(!n.isOverflow());
   // Reset static arrays if they were used by another instance of Arithmetic
@@ -185,42 +801,44 @@ int Arithmetic::PrimeFactorization(const Integer & n) {
     return k_errorTooManyFactors;
   }
 
+  // Trial division by the tabulated primes
   int t = 0; // n prime factor index
-  int k = 0; // prime factor index
-  Integer testedPrimeFactor((int)primeFactors[k]); // prime factor
-  *factorAtIndex(t) = testedPrimeFactor;
-  IntegerDivision d = {.quotient = 0, .remainder = 0};
-  bool stopCondition;
-  do {
-    stopCondition = Integer::NaturalOrder(Integer::Power(testedPrimeFactor, Integer(2)), m) < 0;
-    d = Integer::Division(m, testedPrimeFactor);
-    if (d.remainder.isZero()) {
-      *coefficientAtIndex(t) = Integer::Addition(*coefficientAtIndex(t), Integer(1));
-      m = d.quotient;
-      if (m.isOne()) {
-        return t+1;
-      }
-      continue;
+  bool cofactorIsPrime = false;
+  for (int p = 2; p != 0; p = k_primeTable.nextPrime(p)) {
+    Integer testedPrimeFactor(p);
+    if (Integer::NaturalOrder(Integer::Multiplication(testedPrimeFactor, testedPrimeFactor), m) > 0) {
+      cofactorIsPrime = true;
+      break;
     }
-    if (!coefficientAtIndex(t)->isZero()) {
-      t++;
+    IntegerDivision d = Integer::Division(m, testedPrimeFactor);
+    if (!d.remainder.isZero()) {
+      continue;
     }
-    k++;
-    /* First we look for prime divisors in the table primeFactors (to speed up
-     * the prime factorization for low numbers). When k_numberOfPrimeFactors is
-     * overflow, try every odd number as divisor. */
-    testedPrimeFactor = k < k_numberOfPrimeFactors ? Integer((int)primeFactors[k]) : Integer::Addition(testedPrimeFactor, Integer(2));
     *factorAtIndex(t) = testedPrimeFactor;
-  } while (stopCondition && Integer::NaturalOrder(testedPrimeFactor,Integer(k_biggestPrimeFactor)) < 0);
-  if (Integer::NaturalOrder(Integer::Power(Integer(k_biggestPrimeFactor), Integer(2)), m) < 0) {
-    /* Special case 2: We do not want to break i in prime factor because it
-     * take too much time: the prime factor that should be tested is above
-     * k_biggestPrimeFactor. -2 is returned to indicate a special case. */
+    *coefficientAtIndex(t) = Integer(0);
+    while (d.remainder.isZero()) {
+      *coefficientAtIndex(t) = Integer::Addition(*coefficientAtIndex(t), Integer(1));
+      m = d.quotient;
+      d = Integer::Division(m, testedPrimeFactor);
+    }
+    t++;
+  }
+  if (m.isOne()) {
+    return t;
+  }
+  if (cofactorIsPrime) {
+    *factorAtIndex(t) = m;
+    *coefficientAtIndex(t) = Integer(1);
+    return t + 1;
+  }
+  if (m.numberOfDigits() > Integer::k_maxNumberOfDigits / 2) {
+    /* Special case 2: The cofactor is too large for its modular products to be
+     * computed. -2 is returned to indicate a special case. */
     return k_errorFactorTooLarge;
   }
-  *factorAtIndex(t) = m;
-  *coefficientAtIndex(t) = Integer::Addition(*coefficientAtIndex(t), Integer(1));
-  return t+1;
+  int remainingIterations = k_maxNumberOfPollardRhoIterations;
+  int error = factorizeCofactor(m, Integer(1), &t, &remainingIterations);
+  return error < 0 ? error : t;
 }
 
 int Arithmetic::PositiveDivisors(const Integer & i) {
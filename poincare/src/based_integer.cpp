@@ -13,29 +13,29 @@ namespace Poincare {
 
 /* Based integer Node */
 
-BasedIntegerNode::BasedIntegerNode(const native_uint_t * digits, uint8_t size, OMG::Base base) :
+BasedIntegerNode::BasedIntegerNode(const uint32_t * words, uint8_t size, OMG::Base base) :
   NumberNode(),
   m_base(base),
-  m_numberOfDigits(size)
+  m_numberOfWords(size)
 {
-  if (digits) {
-    memcpy(m_digits, digits, size*sizeof(native_uint_t));
+  if (words) {
+    memcpy(m_words, words, size*sizeof(uint32_t));
   }
 }
 
 Integer BasedIntegerNode::integer() const {
-  return Integer::BuildInteger((native_uint_t *)m_digits, m_numberOfDigits, false);
+  return Integer::BuildIntegerFromWords(m_words, m_numberOfWords, false);
 }
 
 // Tree Node
 
-static size_t BasedIntegerSize(uint8_t numberOfDigits) {
-  uint8_t realDigitsSize = numberOfDigits > Integer::k_maxNumberOfDigits ? 0 : numberOfDigits;
-  return sizeof(BasedIntegerNode) + sizeof(native_uint_t)*realDigitsSize;
+static size_t BasedIntegerSize(uint8_t numberOfWords) {
+  uint8_t realWordsSize = numberOfWords > Integer::k_maxNumberOfWords ? 0 : numberOfWords;
+  return sizeof(BasedIntegerNode) + sizeof(uint32_t)*realWordsSize;
 }
 
 size_t BasedIntegerNode::size() const {
-  return BasedIntegerSize(m_numberOfDigits);
+  return BasedIntegerSize(m_numberOfWords);
 }
 
 // Serialization Node
@@ -90,8 +90,8 @@ BasedInteger BasedInteger::Builder(const char * digits, size_t length, OMG::Base
 }
 
 BasedInteger BasedInteger::Builder(const Integer & m, OMG::Base base) {
-  void * bufferNode = TreePool::sharedPool()->alloc(BasedIntegerSize(m.numberOfDigits()));
-  BasedIntegerNode * node = new (bufferNode) BasedIntegerNode(m.digits(), m.numberOfDigits(), base);
+  void * bufferNode = TreePool::sharedPool()->alloc(BasedIntegerSize(m.numberOfWords()));
+  BasedIntegerNode * node = new (bufferNode) BasedIntegerNode(m.words(), m.numberOfWords(), base);
   TreeHandle h = TreeHandle::BuildWithGhostChildren(node);
   return static_cast<BasedInteger &>(h);
 }
@@ -1,4 +1,5 @@
 #include <poincare/checkpoint.h>
+#include <poincare/expression.h>
 
 namespace Poincare {
 
@@ -8,6 +9,14 @@ TreeNode * Checkpoint::TopmostEndOfPool() {
   return s_topmost ? s_topmost->m_endOfPool : nullptr;
 }
 
+int Checkpoint::ReductionStepBudget() {
+  return Expression::ReductionStepBudget();
+}
+
+void Checkpoint::SetReductionStepBudget(int budget) {
+  Expression::SetReductionStepBudget(budget);
+}
+
 void Checkpoint::protectedDiscard() const {
   if (s_topmost == this) {
     s_topmost = m_parent;
@@ -7,6 +7,13 @@ TreeNode * Checkpoint::TopmostEndOfPool() {
   return nullptr;
 }
 
+int Checkpoint::ReductionStepBudget() {
+  return -1;
+}
+
+void Checkpoint::SetReductionStepBudget(int budget) {
+}
+
 bool ExceptionCheckpoint::setActive(bool interruption) {
   return false;
 }
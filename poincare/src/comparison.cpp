@@ -182,6 +182,25 @@ int ComparisonNode::serialize(char * buffer, int bufferSize, Preferences::PrintF
   return numberOfChar;
 }
 
+template<typename T>
+TrinaryBoolean ComparisonNode::TruthValueOfComplexes(OperatorType type, std::complex<T> leftChild, std::complex<T> rightChild) {
+  T scalarDifference = ComplexNode<T>::ToScalar(leftChild - rightChild);
+  T epsilon = std::max(std::fabs(ComplexNode<T>::ToScalar(leftChild)), std::fabs(ComplexNode<T>::ToScalar(rightChild))) * Float<T>::Epsilon();
+  TrinaryBoolean chidlrenAreEqual;
+  TrinaryBoolean leftChildIsGreater;
+  if (std::isnan(scalarDifference)) {
+    bool childIsUndefined = std::isnan(leftChild.real()) || std::isnan(leftChild.imag()) || std::isnan(rightChild.real()) || std::isnan(rightChild.imag());
+    leftChildIsGreater = TrinaryBoolean::Unknown;
+    chidlrenAreEqual = childIsUndefined ? TrinaryBoolean::Unknown : TrinaryBoolean::False;
+  } else {
+    /* leftChildIsGreater is always used in combination with childrenAreEqual
+     * so the fact that it's strictly greater or not is not important. */
+    leftChildIsGreater = BinaryToTrinaryBool(scalarDifference > 0.0);
+    chidlrenAreEqual = BinaryToTrinaryBool(std::fabs(scalarDifference) <= epsilon);
+  }
+  return TruthValueOfOperator(type, chidlrenAreEqual, leftChildIsGreater);
+}
+
 Evaluation<float> ComparisonNode::approximate(SinglePrecision p, const ApproximationContext& approximationContext) const {
   return templatedApproximate<float>(approximationContext);
 }
@@ -200,21 +219,7 @@ Evaluation<T> ComparisonNode::templatedApproximate(const ApproximationContext& a
     if (firstChildApprox.type() != EvaluationNode<T>::Type::Complex || secondChildApprox.type() != EvaluationNode<T>::Type::Complex) {
       return Complex<T>::Undefined();
     }
-    std::complex<T> difference = firstChildApprox.complexAtIndex(0) - secondChildApprox.complexAtIndex(0);
-    T scalarDifference = ComplexNode<T>::ToScalar(difference);
-    T epsilon = std::max(std::fabs(firstChildApprox.toScalar()), std::fabs(secondChildApprox.toScalar())) * Float<T>::Epsilon();
-    TrinaryBoolean chidlrenAreEqual;
-    TrinaryBoolean leftChildIsGreater;
-    if (std::isnan(scalarDifference)) {
-      leftChildIsGreater = TrinaryBoolean::Unknown;
-      chidlrenAreEqual = (firstChildApprox.isUndefined() || secondChildApprox.isUndefined()) ? TrinaryBoolean::Unknown : TrinaryBoolean::False;
-    } else {
-      /* leftChildIsGreater is always used in combination with childrenAreEqual
-       * so the fact that it's strictly greater or not is not important. */
-      leftChildIsGreater = BinaryToTrinaryBool(scalarDifference > 0.0);
-      chidlrenAreEqual = BinaryToTrinaryBool(std::fabs(scalarDifference) <= epsilon);
-    }
-    TrinaryBoolean truthValue = TruthValueOfOperator(m_operatorsList[i - 1], chidlrenAreEqual, leftChildIsGreater);
+    TrinaryBoolean truthValue = TruthValueOfComplexes(m_operatorsList[i - 1], firstChildApprox.complexAtIndex(0), secondChildApprox.complexAtIndex(0));
     switch (truthValue) {
     case TrinaryBoolean::False:
       return BooleanEvaluation<T>::Builder(false);
@@ -293,4 +298,7 @@ Expression Comparison::shallowReduce(ReductionContext reductionContext) {
   return result;
 }
 
+template TrinaryBoolean ComparisonNode::TruthValueOfComplexes<float>(OperatorType, std::complex<float>, std::complex<float>);
+template TrinaryBoolean ComparisonNode::TruthValueOfComplexes<double>(OperatorType, std::complex<double>, std::complex<double>);
+
 }
\ No newline at end of file
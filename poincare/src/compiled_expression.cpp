@@ -0,0 +1,1686 @@
+#include <poincare/compiled_expression.h>
+#include <poincare/absolute_value.h>
+#include <poincare/addition.h>
+#include <poincare/arc_cosecant.h>
+#include <poincare/arc_cosine.h>
+#include <poincare/arc_cotangent.h>
+#include <poincare/arc_secant.h>
+#include <poincare/arc_sine.h>
+#include <poincare/arc_tangent.h>
+#include <poincare/boolean.h>
+#include <poincare/ceiling.h>
+#include <poincare/comparison.h>
+#include <poincare/complex.h>
+#include <poincare/complex_argument.h>
+#include <poincare/conjugate.h>
+#include <poincare/cosecant.h>
+#include <poincare/cosine.h>
+#include <poincare/cotangent.h>
+#include <poincare/dependency.h>
+#include <poincare/division.h>
+#include <poincare/factorial.h>
+#include <poincare/floor.h>
+#include <poincare/frac_part.h>
+#include <poincare/hyperbolic_arc_cosine.h>
+#include <poincare/hyperbolic_arc_sine.h>
+#include <poincare/hyperbolic_arc_tangent.h>
+#include <poincare/hyperbolic_cosine.h>
+#include <poincare/hyperbolic_sine.h>
+#include <poincare/hyperbolic_tangent.h>
+#include <poincare/imaginary_part.h>
+#include <poincare/logarithm.h>
+#include <poincare/multiplication.h>
+#include <poincare/naperian_logarithm.h>
+#include <poincare/parametered_expression.h>
+#include <poincare/power.h>
+#include <poincare/rational.h>
+#include <poincare/real_part.h>
+#include <poincare/secant.h>
+#include <poincare/sign_function.h>
+#include <poincare/sine.h>
+#include <poincare/square_root.h>
+#include <poincare/subtraction.h>
+#include <poincare/symbol.h>
+#include <poincare/tangent.h>
+#include <poincare/trigonometry.h>
+#include <string.h>
+
+namespace Poincare {
+
+template<typename T>
+static bool IsUndefined(std::complex<T> c) {
+  return std::isnan(c.real()) || std::isnan(c.imag());
+}
+
+template<typename T>
+static std::complex<T> UndefinedIfNaN(std::complex<T> c) {
+  // Mimic ApproximationHelper::MapReduce which turns undefined results into Complex<T>::Undefined()
+  c = ComplexNode<T>::Normalize(c);
+  return IsUndefined(c) ? std::complex<T>(NAN, NAN) : c;
+}
+
+template<typename T>
+static std::complex<T> ComputeFunction(ExpressionNode::Type type, std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+  switch (type) {
+  case ExpressionNode::Type::AbsoluteValue:
+    return ComplexNode<T>::Normalize(AbsoluteValueNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::ArcCosecant:
+    return ComplexNode<T>::Normalize(ArcCosecantNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::ArcCosine:
+    return ComplexNode<T>::Normalize(ArcCosineNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::ArcCotangent:
+    return ComplexNode<T>::Normalize(ArcCotangentNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::ArcSecant:
+    return ComplexNode<T>::Normalize(ArcSecantNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::ArcSine:
+    return ComplexNode<T>::Normalize(ArcSineNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::ArcTangent:
+    return ComplexNode<T>::Normalize(ArcTangentNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::Ceiling:
+    return ComplexNode<T>::Normalize(CeilingNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::ComplexArgument:
+    return ComplexNode<T>::Normalize(ComplexArgumentNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::Conjugate:
+    return ComplexNode<T>::Normalize(ConjugateNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::Cosecant:
+    return ComplexNode<T>::Normalize(CosecantNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::Cosine:
+    return ComplexNode<T>::Normalize(CosineNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::Cotangent:
+    return ComplexNode<T>::Normalize(CotangentNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::Factorial:
+    return ComplexNode<T>::Normalize(FactorialNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::Floor:
+    return ComplexNode<T>::Normalize(FloorNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::FracPart:
+    return ComplexNode<T>::Normalize(FracPartNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::HyperbolicArcCosine:
+    return ComplexNode<T>::Normalize(HyperbolicArcCosineNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::HyperbolicArcSine:
+    return ComplexNode<T>::Normalize(HyperbolicArcSineNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::HyperbolicArcTangent:
+    return ComplexNode<T>::Normalize(HyperbolicArcTangentNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::HyperbolicCosine:
+    return ComplexNode<T>::Normalize(HyperbolicCosineNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::HyperbolicSine:
+    return ComplexNode<T>::Normalize(HyperbolicSineNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::HyperbolicTangent:
+    return ComplexNode<T>::Normalize(HyperbolicTangentNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::ImaginaryPart:
+    return ComplexNode<T>::Normalize(ImaginaryPartNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::Logarithm:
+    return ComplexNode<T>::Normalize(LogarithmNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::NaperianLogarithm:
+    return ComplexNode<T>::Normalize(NaperianLogarithmNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::RealPart:
+    return ComplexNode<T>::Normalize(RealPartNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::Secant:
+    return ComplexNode<T>::Normalize(SecantNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::SignFunction:
+    return ComplexNode<T>::Normalize(SignFunctionNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::Sine:
+    return ComplexNode<T>::Normalize(SineNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  case ExpressionNode::Type::SquareRoot:
+    return ComplexNode<T>::Normalize(SquareRootNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  default:
+    assert(type == ExpressionNode::Type::Tangent);
+    return ComplexNode<T>::Normalize(TangentNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  }
+}
+
+static bool IsCompiledFunction(ExpressionNode::Type type) {
+  switch (type) {
+  case ExpressionNode::Type::AbsoluteValue:
+  case ExpressionNode::Type::ArcCosecant:
+  case ExpressionNode::Type::ArcCosine:
+  case ExpressionNode::Type::ArcCotangent:
+  case ExpressionNode::Type::ArcSecant:
+  case ExpressionNode::Type::ArcSine:
+  case ExpressionNode::Type::ArcTangent:
+  case ExpressionNode::Type::Ceiling:
+  case ExpressionNode::Type::ComplexArgument:
+  case ExpressionNode::Type::Conjugate:
+  case ExpressionNode::Type::Cosecant:
+  case ExpressionNode::Type::Cosine:
+  case ExpressionNode::Type::Cotangent:
+  case ExpressionNode::Type::Factorial:
+  case ExpressionNode::Type::Floor:
+  case ExpressionNode::Type::FracPart:
+  case ExpressionNode::Type::HyperbolicArcCosine:
+  case ExpressionNode::Type::HyperbolicArcSine:
+  case ExpressionNode::Type::HyperbolicArcTangent:
+  case ExpressionNode::Type::HyperbolicCosine:
+  case ExpressionNode::Type::HyperbolicSine:
+  case ExpressionNode::Type::HyperbolicTangent:
+  case ExpressionNode::Type::ImaginaryPart:
+  case ExpressionNode::Type::NaperianLogarithm:
+  case ExpressionNode::Type::RealPart:
+  case ExpressionNode::Type::Secant:
+  case ExpressionNode::Type::SignFunction:
+  case ExpressionNode::Type::Sine:
+  case ExpressionNode::Type::SquareRoot:
+  case ExpressionNode::Type::Tangent:
+    return true;
+  default:
+    return false;
+  }
+}
+
+/* Truncated Taylor series, used for forward mode automatic differentiation.
+ * The coefficient k of a series is the k-th derivative divided by k!. */
+
+constexpr static int k_maxNumberOfCoefficients = CompiledExpression::k_maxDerivativeOrder + 1;
+
+template<typename T>
+static void SeriesCopy(const T * a, T * c, int n) {
+  for (int k = 0; k < n; k++) {
+    c[k] = a[k];
+  }
+}
+
+template<typename T>
+static void SeriesConstant(T value, T * c, int n) {
+  c[0] = value;
+  for (int k = 1; k < n; k++) {
+    c[k] = static_cast<T>(0.0);
+  }
+}
+
+// c can be a or b
+template<typename T>
+static void SeriesProduct(const T * a, const T * b, T * c, int n) {
+  T result[k_maxNumberOfCoefficients];
+  for (int k = 0; k < n; k++) {
+    result[k] = static_cast<T>(0.0);
+    for (int j = 0; j <= k; j++) {
+      result[k] += a[j] * b[k - j];
+    }
+  }
+  SeriesCopy(result, c, n);
+}
+
+// b[0] must not be null, and c can be a or b
+template<typename T>
+static void SeriesQuotient(const T * a, const T * b, T * c, int n) {
+  assert(b[0] != static_cast<T>(0.0));
+  T result[k_maxNumberOfCoefficients];
+  for (int k = 0; k < n; k++) {
+    result[k] = a[k];
+    for (int j = 1; j <= k; j++) {
+      result[k] -= b[j] * result[k - j];
+    }
+    result[k] /= b[0];
+  }
+  SeriesCopy(result, c, n);
+}
+
+/* Set the coefficients of c but the first one so that c' = g * a'. g can be c
+ * since the coefficient k of c only depends on the previous ones of g, but c
+ * cannot be a. */
+template<typename T>
+static void SeriesPrimitive(const T * a, const T * g, T * c, int n) {
+  assert(a != c);
+  for (int k = 1; k < n; k++) {
+    T sum = static_cast<T>(0.0);
+    for (int j = 1; j <= k; j++) {
+      sum += j * a[j] * g[k - j];
+    }
+    c[k] = sum / k;
+  }
+}
+
+/* Set the coefficients of c but the first one, c[0] being a[0]^p with a[0] not
+ * null. It relies on a * c' = p * a' * c. */
+template<typename T>
+static void SeriesPower(const T * a, T p, T * c, int n) {
+  assert(a != c && a[0] != static_cast<T>(0.0));
+  for (int k = 1; k < n; k++) {
+    T sum = static_cast<T>(0.0);
+    for (int j = 1; j <= k; j++) {
+      sum += (p * j - (k - j)) * a[j] * c[k - j];
+    }
+    c[k] = sum / (k * a[0]);
+  }
+}
+
+// a[0] must be strictly positive
+template<typename T>
+static void SeriesLogarithm(const T * a, T * c, int n) {
+  assert(a != c && a[0] > static_cast<T>(0.0));
+  T one[k_maxNumberOfCoefficients];
+  T inverse[k_maxNumberOfCoefficients];
+  SeriesConstant(static_cast<T>(1.0), one, n);
+  SeriesQuotient(one, a, inverse, n);
+  c[0] = std::log(a[0]);
+  SeriesPrimitive(a, inverse, c, n);
+}
+
+/* Set s and c to the sine and cosine of a, or to its hyperbolic sine and
+ * cosine. Their first coefficients must already be set. */
+template<typename T>
+static void SeriesSineAndCosine(const T * a, T * s, T * c, int n, bool hyperbolic) {
+  for (int k = 1; k < n; k++) {
+    T sSum = static_cast<T>(0.0);
+    T cSum = static_cast<T>(0.0);
+    for (int j = 1; j <= k; j++) {
+      sSum += j * a[j] * c[k - j];
+      cSum += j * a[j] * s[k - j];
+    }
+    s[k] = sSum / k;
+    c[k] = (hyperbolic ? cSum : -cSum) / k;
+  }
+}
+
+// Set c to 1 + sign * a^2
+template<typename T>
+static void SeriesOneAndSquare(const T * a, T sign, T * c, int n) {
+  SeriesProduct(a, a, c, n);
+  for (int k = 0; k < n; k++) {
+    c[k] *= sign;
+  }
+  c[0] += static_cast<T>(1.0);
+}
+
+template<typename T>
+static bool SeriesAreFinite(const T * a, int n) {
+  for (int k = 0; k < n; k++) {
+    if (!std::isfinite(a[k])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* Intervals {min, max}, used to enclose the values of a routine. The bounds of
+ * an interval on which a value is undefined are NaN. */
+
+// Set a to the interval between u and v, in any order
+template<typename T>
+static void IntervalSet(T * a, T u, T v) {
+  a[0] = std::min(u, v);
+  a[1] = std::max(u, v);
+}
+
+template<typename T>
+static void IntervalSetUndefined(T * a) {
+  a[0] = a[1] = NAN;
+}
+
+template<typename T>
+static bool IntervalIsUndefined(const T * a) {
+  return std::isnan(a[0]) && std::isnan(a[1]);
+}
+
+template<typename T>
+static bool IntervalContains(const T * a, T x) {
+  return a[0] <= x && x <= a[1];
+}
+
+/* Handle an operation which is undefined on some values of a: the result is
+ * undefined if a is a single value, and not continuous otherwise. */
+template<typename T>
+static void IntervalSetPartiallyUndefined(T * a, bool * isContinuous) {
+  if (a[0] == a[1]) {
+    IntervalSetUndefined(a);
+  } else {
+    *isContinuous = false;
+  }
+}
+
+// c can be a or b
+template<typename T>
+static void IntervalProduct(const T * a, const T * b, T * c) {
+  T p00 = a[0] * b[0];
+  T p01 = a[0] * b[1];
+  T p10 = a[1] * b[0];
+  T p11 = a[1] * b[1];
+  c[0] = std::min(std::min(p00, p01), std::min(p10, p11));
+  c[1] = std::max(std::max(p00, p01), std::max(p10, p11));
+}
+
+// a must not contain 0
+template<typename T>
+static void IntervalInverse(T * a) {
+  assert(!IntervalContains(a, static_cast<T>(0.0)));
+  IntervalSet(a, static_cast<T>(1.0) / a[0], static_cast<T>(1.0) / a[1]);
+}
+
+template<typename T>
+static void IntervalAbsoluteValue(T * a) {
+  T max = std::max(std::fabs(a[0]), std::fabs(a[1]));
+  a[0] = IntervalContains(a, static_cast<T>(0.0)) ? static_cast<T>(0.0) : std::min(std::fabs(a[0]), std::fabs(a[1]));
+  a[1] = max;
+}
+
+// Enclose the cosine of an interval of radians
+template<typename T>
+static void IntervalCosine(T * a) {
+  constexpr T pi = static_cast<T>(M_PI);
+  if (a[1] - a[0] >= 2 * pi) {
+    IntervalSet(a, static_cast<T>(-1.0), static_cast<T>(1.0));
+    return;
+  }
+  T k = std::ceil(a[0] / pi);
+  T min = std::min(std::cos(a[0]), std::cos(a[1]));
+  T max = std::max(std::cos(a[0]), std::cos(a[1]));
+  // The extrema are reached on the multiples of π, at most two of them in a
+  for (int i = 0; i < 2 && (k + i) * pi <= a[1]; i++) {
+    if (std::fmod(k + i, static_cast<T>(2.0)) == static_cast<T>(0.0)) {
+      max = static_cast<T>(1.0);
+    } else {
+      min = static_cast<T>(-1.0);
+    }
+  }
+  a[0] = min;
+  a[1] = max;
+}
+
+/* Set a to {1, 1} if the comparison holds on the whole intervals, to {0, 0} if
+ * it never holds and to {0, 1} otherwise. */
+template<typename T>
+static void IntervalComparison(ComparisonNode::OperatorType operatorType, T * a, const T * b) {
+  if (IntervalIsUndefined(a) || IntervalIsUndefined(b)) {
+    // Piecewise conditions are only taken into account when they are true
+    IntervalSet(a, static_cast<T>(0.0), static_cast<T>(0.0));
+    return;
+  }
+  // Enclose a - b
+  T min = a[0] - b[1];
+  T max = a[1] - b[0];
+  bool isAlwaysTrue;
+  bool isNeverTrue;
+  switch (operatorType) {
+  case ComparisonNode::OperatorType::Equal:
+  case ComparisonNode::OperatorType::NotEqual:
+    isAlwaysTrue = min == static_cast<T>(0.0) && max == static_cast<T>(0.0);
+    isNeverTrue = min > static_cast<T>(0.0) || max < static_cast<T>(0.0);
+    if (operatorType == ComparisonNode::OperatorType::NotEqual) {
+      std::swap(isAlwaysTrue, isNeverTrue);
+    }
+    break;
+  case ComparisonNode::OperatorType::Superior:
+    isAlwaysTrue = min > static_cast<T>(0.0);
+    isNeverTrue = max <= static_cast<T>(0.0);
+    break;
+  case ComparisonNode::OperatorType::SuperiorEqual:
+    isAlwaysTrue = min >= static_cast<T>(0.0);
+    isNeverTrue = max < static_cast<T>(0.0);
+    break;
+  case ComparisonNode::OperatorType::Inferior:
+    isAlwaysTrue = max < static_cast<T>(0.0);
+    isNeverTrue = min >= static_cast<T>(0.0);
+    break;
+  default:
+    assert(operatorType == ComparisonNode::OperatorType::InferiorEqual);
+    isAlwaysTrue = max <= static_cast<T>(0.0);
+    isNeverTrue = min > static_cast<T>(0.0);
+  }
+  a[0] = isAlwaysTrue ? static_cast<T>(1.0) : static_cast<T>(0.0);
+  a[1] = isNeverTrue ? static_cast<T>(0.0) : static_cast<T>(1.0);
+}
+
+/* Compiler */
+
+class CompiledExpression::Compiler {
+public:
+  Compiler(CompiledExpression * program, const char * symbol, const ApproximationContext& approximationContext) :
+    m_program(program),
+    m_symbol(symbol),
+    m_approximationContext(approximationContext),
+    m_numberOfInstructions(0),
+    m_numberOfConstants(0),
+    m_stackDepth(0)
+  {}
+  bool compileRoutine(const Expression e, int routineIndex);
+
+private:
+  /* Symbols bound by the parametered expressions enclosing a subtree, such as
+   * t in int(cos(t),t,0,1). */
+  struct BoundSymbol {
+    const char * name;
+    const BoundSymbol * next;
+  };
+  static bool IsConstant(const Expression e, const BoundSymbol * boundSymbols);
+
+  bool compileValue(const Expression e);
+  bool compileCondition(const Expression e);
+  bool compileConstant(const Expression e, bool isCondition);
+  bool compileBinaryOperation(const Expression e, OpCode opCode);
+  bool compilePower(const Expression e);
+  bool compileDependency(const Expression e);
+  bool compilePiecewise(const Expression e);
+
+  bool pushInstruction(OpCode opCode, uint8_t operand, int stackVariation);
+  // Return the index of the new constant, or -1 if there is no room left
+  int addConstant(std::complex<float> floatValue, std::complex<double> doubleValue);
+  bool pushConstant(std::complex<float> floatValue, std::complex<double> doubleValue);
+  bool pushUndefined() { return pushConstant(std::complex<float>(NAN, NAN), std::complex<double>(NAN, NAN)); }
+  /* Jumps to a location that is not compiled yet are chained through their
+   * operand, and resolved once the location is known. */
+  bool pushChainedJump(OpCode opCode, uint8_t * chain, int stackVariation);
+  void resolveJumps(uint8_t chain);
+
+  CompiledExpression * m_program;
+  const char * m_symbol;
+  ApproximationContext m_approximationContext;
+  int m_numberOfInstructions;
+  int m_numberOfConstants;
+  int m_stackDepth;
+};
+
+bool CompiledExpression::Compiler::IsConstant(const Expression e, const BoundSymbol * boundSymbols) {
+  ExpressionNode::Type type = e.type();
+  if (e.isRandom() || type == ExpressionNode::Type::Function || type == ExpressionNode::Type::Sequence) {
+    // Their approximation depends on the context or changes at each call
+    return false;
+  }
+  if (type == ExpressionNode::Type::Symbol) {
+    const char * name = static_cast<const Symbol &>(e).name();
+    for (const BoundSymbol * s = boundSymbols; s != nullptr; s = s->next) {
+      if (strcmp(name, s->name) == 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+  int n = e.numberOfChildren();
+  if (e.isParameteredExpression()) {
+    Expression parameter = e.childAtIndex(ParameteredExpression::ParameterChildIndex());
+    assert(parameter.type() == ExpressionNode::Type::Symbol);
+    BoundSymbol boundParameter = {static_cast<const Symbol &>(parameter).name(), boundSymbols};
+    for (int i = 0; i < n; i++) {
+      if (i != ParameteredExpression::ParameterChildIndex() && !IsConstant(e.childAtIndex(i), i == ParameteredExpression::ParameteredChildIndex() ? &boundParameter : boundSymbols)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  for (int i = 0; i < n; i++) {
+    if (!IsConstant(e.childAtIndex(i), boundSymbols)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool CompiledExpression::Compiler::compileRoutine(const Expression e, int routineIndex) {
+  assert(m_stackDepth == 0);
+  m_program->m_routineStarts[routineIndex] = m_numberOfInstructions;
+  return compileValue(e) && pushInstruction(OpCode::Return, k_noOperand, -1);
+}
+
+bool CompiledExpression::Compiler::compileValue(const Expression e) {
+  if (IsConstant(e, nullptr)) {
+    return compileConstant(e, false);
+  }
+  ExpressionNode::Type type = e.type();
+  switch (type) {
+  case ExpressionNode::Type::Symbol:
+    // Other symbols would require the context at each approximation
+    return strcmp(static_cast<const Symbol &>(e).name(), m_symbol) == 0 && pushInstruction(OpCode::Variable, k_noOperand, 1);
+  case ExpressionNode::Type::Parenthesis:
+    return compileValue(e.childAtIndex(0));
+  case ExpressionNode::Type::Addition:
+    return compileBinaryOperation(e, OpCode::Addition);
+  case ExpressionNode::Type::Multiplication:
+    return compileBinaryOperation(e, OpCode::Multiplication);
+  case ExpressionNode::Type::Subtraction:
+    return compileBinaryOperation(e, OpCode::Subtraction);
+  case ExpressionNode::Type::Division:
+    return compileBinaryOperation(e, OpCode::Division);
+  case ExpressionNode::Type::Power:
+    return compilePower(e);
+  case ExpressionNode::Type::Opposite:
+    return compileValue(e.childAtIndex(0)) && pushInstruction(OpCode::Opposite, k_noOperand, 0);
+  case ExpressionNode::Type::Logarithm:
+    if (e.numberOfChildren() == 1) {
+      return compileValue(e.childAtIndex(0)) && pushInstruction(OpCode::Function, static_cast<uint8_t>(type), 0);
+    }
+    // Leave the exam mode check of the base to the tree approximation
+    return !Preferences::sharedPreferences()->basedLogarithmIsForbidden()
+      && compileValue(e.childAtIndex(0))
+      && compileValue(e.childAtIndex(1))
+      && pushInstruction(OpCode::Logarithm, k_noOperand, -1);
+  case ExpressionNode::Type::Dependency:
+    return compileDependency(e);
+  case ExpressionNode::Type::PiecewiseOperator:
+    return compilePiecewise(e);
+  default:
+    return IsCompiledFunction(type) && compileValue(e.childAtIndex(0)) && pushInstruction(OpCode::Function, static_cast<uint8_t>(type), 0);
+  }
+}
+
+bool CompiledExpression::Compiler::compileCondition(const Expression e) {
+  if (IsConstant(e, nullptr)) {
+    return compileConstant(e, true);
+  }
+  ComparisonNode::OperatorType operatorType;
+  return ComparisonNode::IsBinaryComparison(e, &operatorType)
+    && compileValue(e.childAtIndex(0))
+    && compileValue(e.childAtIndex(1))
+    && pushInstruction(OpCode::Comparison, static_cast<uint8_t>(operatorType), -1);
+}
+
+bool CompiledExpression::Compiler::compileConstant(const Expression e, bool isCondition) {
+  /* The constant is approximated as it would be within the whole expression,
+   * but the encountered complex flag of an ongoing approximation must not be
+   * altered. */
+  bool encounteredComplex = Expression::EncounteredComplex();
+  Expression::SetEncounteredComplex(false);
+  Evaluation<float> floatEvaluation = e.node()->approximate(float(), m_approximationContext);
+  Evaluation<double> doubleEvaluation = e.node()->approximate(double(), m_approximationContext);
+  bool constantEncounteredComplex = Expression::EncounteredComplex();
+  Expression::SetEncounteredComplex(encounteredComplex);
+  if (constantEncounteredComplex && m_approximationContext.complexFormat() == Preferences::ComplexFormat::Real) {
+    /* The approximation of the whole expression would be undefined, unless
+     * the constant lies in a branch that is not taken. */
+    return false;
+  }
+  if (isCondition) {
+    // PiecewiseOperator only takes true boolean evaluations into account
+    bool floatIsTrue = floatEvaluation.type() == EvaluationNode<float>::Type::BooleanEvaluation && static_cast<BooleanEvaluation<float> &>(floatEvaluation).value();
+    bool doubleIsTrue = doubleEvaluation.type() == EvaluationNode<double>::Type::BooleanEvaluation && static_cast<BooleanEvaluation<double> &>(doubleEvaluation).value();
+    return pushConstant(std::complex<float>(floatIsTrue), std::complex<double>(doubleIsTrue));
+  }
+  if (floatEvaluation.type() != EvaluationNode<float>::Type::Complex || doubleEvaluation.type() != EvaluationNode<double>::Type::Complex) {
+    return false;
+  }
+  return pushConstant(floatEvaluation.complexAtIndex(0), doubleEvaluation.complexAtIndex(0));
+}
+
+bool CompiledExpression::Compiler::compileBinaryOperation(const Expression e, OpCode opCode) {
+  /* Children are folded from left to right. As in ApproximationHelper::MapReduce,
+   * the remaining children are skipped as soon as the result is undefined. */
+  int n = e.numberOfChildren();
+  assert(n >= 2);
+  uint8_t undefinedJumps = k_noOperand;
+  if (!compileValue(e.childAtIndex(0))) {
+    return false;
+  }
+  for (int i = 1; i < n; i++) {
+    if (!compileValue(e.childAtIndex(i))
+     || !pushInstruction(opCode, k_noOperand, -1)
+     || (i < n - 1 && !pushChainedJump(OpCode::JumpIfUndefined, &undefinedJumps, 0))) {
+      return false;
+    }
+  }
+  resolveJumps(undefinedJumps);
+  return true;
+}
+
+bool CompiledExpression::Compiler::compilePower(const Expression e) {
+  if (!compileValue(e.childAtIndex(0)) || !compileValue(e.childAtIndex(1))) {
+    return false;
+  }
+  /* Mimic PowerNode::templatedApproximate, which looks for a real root of
+   * c^(p/q) when the index is a rational or the division of two integers. */
+  uint8_t rationalIndex = k_noOperand;
+  if (m_approximationContext.complexFormat() == Preferences::ComplexFormat::Real) {
+    Expression index = e.childAtIndex(1);
+    Integer p;
+    Integer q;
+    bool isRationalIndex = false;
+    if (index.type() == ExpressionNode::Type::Rational) {
+      p = static_cast<const Rational &>(index).signedIntegerNumerator();
+      q = static_cast<const Rational &>(index).integerDenominator();
+      isRationalIndex = true;
+    } else if (index.type() == ExpressionNode::Type::Division && index.childAtIndex(0).type() == ExpressionNode::Type::Rational && index.childAtIndex(1).type() == ExpressionNode::Type::Rational) {
+      const Rational pRational = index.childAtIndex(0).convert<Rational>();
+      const Rational qRational = index.childAtIndex(1).convert<Rational>();
+      if (pRational.isInteger() && qRational.isInteger()) {
+        p = pRational.signedIntegerNumerator();
+        q = qRational.signedIntegerNumerator();
+        isRationalIndex = true;
+      }
+    }
+    if (isRationalIndex) {
+      // The (p, q) constant is only read by the instruction
+      int constantIndex = addConstant(std::complex<float>(p.approximate<float>(), q.approximate<float>()), std::complex<double>(p.approximate<double>(), q.approximate<double>()));
+      if (constantIndex < 0) {
+        return false;
+      }
+      rationalIndex = constantIndex;
+    }
+  }
+  return pushInstruction(OpCode::Power, rationalIndex, -1);
+}
+
+bool CompiledExpression::Compiler::compileDependency(const Expression e) {
+  Expression dependencies = e.childAtIndex(Dependency::k_indexOfDependenciesList);
+  if (dependencies.type() == ExpressionNode::Type::Undefined || dependencies.type() == ExpressionNode::Type::Nonreal) {
+    return pushUndefined();
+  }
+  assert(dependencies.type() == ExpressionNode::Type::List);
+  uint8_t undefinedJumps = k_noOperand;
+  int n = dependencies.numberOfChildren();
+  for (int i = 0; i < n; i++) {
+    if (!compileValue(dependencies.childAtIndex(i))
+     || !pushChainedJump(OpCode::JumpIfUndefined, &undefinedJumps, 0)
+     || !pushInstruction(OpCode::Pop, k_noOperand, -1)) {
+      return false;
+    }
+  }
+  if (!compileValue(e.childAtIndex(0))) {
+    return false;
+  }
+  resolveJumps(undefinedJumps);
+  return true;
+}
+
+bool CompiledExpression::Compiler::compilePiecewise(const Expression e) {
+  // Mimic PiecewiseOperatorNode::indexOfFirstTrueCondition
+  int n = e.numberOfChildren();
+  uint8_t endJumps = k_noOperand;
+  int i = 0;
+  while (i + 1 < n) {
+    uint8_t nextConditionJump = k_noOperand;
+    if (!compileCondition(e.childAtIndex(i + 1))
+     || !pushChainedJump(OpCode::JumpIfNotTrue, &nextConditionJump, -1)
+     || !compileValue(e.childAtIndex(i))
+     || !pushChainedJump(OpCode::Jump, &endJumps, 0)) {
+      return false;
+    }
+    // The next condition is reached without the value of this branch
+    m_stackDepth--;
+    resolveJumps(nextConditionJump);
+    i += 2;
+  }
+  if (!(i < n ? compileValue(e.childAtIndex(i)) : pushUndefined())) {
+    return false;
+  }
+  resolveJumps(endJumps);
+  return true;
+}
+
+bool CompiledExpression::Compiler::pushInstruction(OpCode opCode, uint8_t operand, int stackVariation) {
+  m_stackDepth += stackVariation;
+  if (m_numberOfInstructions >= k_maxNumberOfInstructions || m_stackDepth > k_maxStackDepth) {
+    return false;
+  }
+  assert(m_stackDepth >= 0);
+  m_program->m_instructions[m_numberOfInstructions++] = {opCode, operand};
+  return true;
+}
+
+int CompiledExpression::Compiler::addConstant(std::complex<float> floatValue, std::complex<double> doubleValue) {
+  if (m_numberOfConstants >= k_maxNumberOfConstants) {
+    return -1;
+  }
+  m_program->m_floatConstants[m_numberOfConstants] = floatValue;
+  m_program->m_doubleConstants[m_numberOfConstants] = doubleValue;
+  return m_numberOfConstants++;
+}
+
+bool CompiledExpression::Compiler::pushConstant(std::complex<float> floatValue, std::complex<double> doubleValue) {
+  int constantIndex = addConstant(floatValue, doubleValue);
+  return constantIndex >= 0 && pushInstruction(OpCode::Constant, constantIndex, 1);
+}
+
+bool CompiledExpression::Compiler::pushChainedJump(OpCode opCode, uint8_t * chain, int stackVariation) {
+  uint8_t jumpIndex = m_numberOfInstructions;
+  if (!pushInstruction(opCode, *chain, stackVariation)) {
+    return false;
+  }
+  *chain = jumpIndex;
+  return true;
+}
+
+void CompiledExpression::Compiler::resolveJumps(uint8_t chain) {
+  while (chain != k_noOperand) {
+    Instruction * jump = m_program->m_instructions + chain;
+    chain = jump->operand;
+    jump->operand = m_numberOfInstructions;
+  }
+}
+
+/* CompiledExpression */
+
+bool CompiledExpression::compile(const Expression * expressions, int numberOfExpressions, const char * symbol, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+  assert(numberOfExpressions >= 0);
+  m_complexFormat = complexFormat;
+  m_angleUnit = angleUnit;
+  m_numberOfRoutines = 0;
+  if (numberOfExpressions > k_maxNumberOfRoutines) {
+    return false;
+  }
+  Compiler compiler(this, symbol, ApproximationContext(context, complexFormat, angleUnit));
+  for (int i = 0; i < numberOfExpressions; i++) {
+    if (expressions[i].isUninitialized() || !compiler.compileRoutine(expressions[i], i)) {
+      return false;
+    }
+  }
+  m_numberOfRoutines = numberOfExpressions;
+  return isCompiled();
+}
+
+template<>
+const std::complex<float> * CompiledExpression::constants<float>() const {
+  return m_floatConstants;
+}
+
+template<>
+const std::complex<double> * CompiledExpression::constants<double>() const {
+  return m_doubleConstants;
+}
+
+template<typename T>
+std::complex<T> CompiledExpression::computeOperation(Instruction instruction, std::complex<T> a, std::complex<T> b) const {
+  switch (instruction.opCode) {
+  case OpCode::Addition:
+    return UndefinedIfNaN(AdditionNode::computeOnComplex<T>(a, b, m_complexFormat));
+  case OpCode::Multiplication:
+    return UndefinedIfNaN(MultiplicationNode::computeOnComplex<T>(a, b, m_complexFormat));
+  case OpCode::Subtraction:
+    return UndefinedIfNaN(SubtractionNode::computeOnComplex<T>(a, b, m_complexFormat));
+  case OpCode::Division:
+    return UndefinedIfNaN(DivisionNode::computeOnComplex<T>(a, b, m_complexFormat));
+  case OpCode::Power:
+  {
+    if (instruction.operand != k_noOperand) {
+      std::complex<T> rationalIndex = constants<T>()[instruction.operand];
+      std::complex<T> root = PowerNode::computeNotPrincipalRealRootOfRationalPow<T>(a, rationalIndex.real(), rationalIndex.imag());
+      if (!IsUndefined(root)) {
+        return root;
+      }
+    }
+    return UndefinedIfNaN(PowerNode::computeOnComplex<T>(a, b, m_complexFormat));
+  }
+  case OpCode::Logarithm:
+    // Mimic LogarithmNode::templatedApproximate
+    return ComplexNode<T>::Normalize(DivisionNode::computeOnComplex<T>(
+        ComplexNode<T>::Normalize(LogarithmNode::computeOnComplex<T>(a, m_complexFormat, m_angleUnit)),
+        ComplexNode<T>::Normalize(LogarithmNode::computeOnComplex<T>(b, m_complexFormat, m_angleUnit)),
+        m_complexFormat));
+  case OpCode::Opposite:
+    // Mimic OppositeNode::templatedApproximate
+    return ComplexNode<T>::Normalize(MultiplicationNode::computeOnComplex<T>(std::complex<T>(-1), a, m_complexFormat));
+  case OpCode::Function:
+    return ComputeFunction<T>(static_cast<ExpressionNode::Type>(instruction.operand), a, m_complexFormat, m_angleUnit);
+  default:
+    assert(instruction.opCode == OpCode::Comparison);
+    return ComparisonNode::TruthValueOfComplexes<T>(static_cast<ComparisonNode::OperatorType>(instruction.operand), a, b) == TrinaryBoolean::True ? static_cast<T>(1.0) : static_cast<T>(0.0);
+  }
+}
+
+template<typename T>
+bool CompiledExpression::ComputeRealOperation(OpCode opCode, T a, T b, std::complex<T> * result) {
+  /* On real operands, these operations are exactly computed by their
+   * computeOnComplex methods, which never raise the encountered complex flag.
+   * The result is normalized the same way. */
+  T value;
+  switch (opCode) {
+  case OpCode::Addition:
+    value = a + b;
+    break;
+  case OpCode::Multiplication:
+    value = a * b;
+    break;
+  case OpCode::Subtraction:
+    value = a - b;
+    break;
+  case OpCode::Opposite:
+    value = static_cast<T>(-1.0) * a;
+    break;
+  default:
+    return false;
+  }
+  // Replace -0 with 0 like Complex<T>::Builder
+  *result = std::isnan(value) ? std::complex<T>(NAN, NAN) : std::complex<T>(value == static_cast<T>(0.0) ? static_cast<T>(0.0) : value);
+  return true;
+}
+
+template<typename T>
+std::complex<T> CompiledExpression::approximateWithinParent(T x, int routineIndex) const {
+  assert(isCompiled() && routineIndex < m_numberOfRoutines);
+  const std::complex<T> * constants = this->constants<T>();
+  std::complex<T> stack[k_maxStackDepth];
+  int stackDepth = 0;
+  int instructionIndex = m_routineStarts[routineIndex];
+  while (true) {
+    const Instruction instruction = m_instructions[instructionIndex++];
+    switch (instruction.opCode) {
+    case OpCode::Variable:
+      // Like Complex<T>::Builder, replace -0 with 0
+      stack[stackDepth++] = std::complex<T>(x == static_cast<T>(0.0) ? static_cast<T>(0.0) : x);
+      break;
+    case OpCode::Constant:
+      stack[stackDepth++] = constants[instruction.operand];
+      break;
+    case OpCode::Addition:
+    case OpCode::Multiplication:
+    case OpCode::Subtraction:
+    case OpCode::Division:
+    case OpCode::Power:
+    case OpCode::Logarithm:
+    case OpCode::Comparison:
+      stackDepth--;
+      stack[stackDepth - 1] = computeOperation<T>(instruction, stack[stackDepth - 1], stack[stackDepth]);
+      break;
+    case OpCode::Opposite:
+    case OpCode::Function:
+      stack[stackDepth - 1] = computeOperation<T>(instruction, stack[stackDepth - 1]);
+      break;
+    case OpCode::Pop:
+      stackDepth--;
+      break;
+    case OpCode::Jump:
+      instructionIndex = instruction.operand;
+      break;
+    case OpCode::JumpIfNotTrue:
+      stackDepth--;
+      if (stack[stackDepth] != std::complex<T>(1.0)) {
+        instructionIndex = instruction.operand;
+      }
+      break;
+    case OpCode::JumpIfUndefined:
+      if (IsUndefined(stack[stackDepth - 1])) {
+        stack[stackDepth - 1] = std::complex<T>(NAN, NAN);
+        instructionIndex = instruction.operand;
+      }
+      break;
+    default:
+      assert(instruction.opCode == OpCode::Return && stackDepth == 1);
+      return stack[0];
+    }
+    assert(stackDepth >= 0 && stackDepth <= k_maxStackDepth);
+  }
+}
+
+template<typename T>
+T CompiledExpression::approximateWithValue(T x, int routineIndex) const {
+  // Mimic Expression::approximateToEvaluation
+  Expression::SetEncounteredComplex(false);
+  std::complex<T> result = approximateWithinParent<T>(x, routineIndex);
+  if (m_complexFormat == Preferences::ComplexFormat::Real && Expression::EncounteredComplex()) {
+    return NAN;
+  }
+  return ComplexNode<T>::ToScalar(result);
+}
+
+template<typename T>
+void CompiledExpression::approximateBatch(const T * xs, T * ys, int n, int routineIndex) const {
+  for (int i = 0; i < n; i += k_batchSize) {
+    approximateSingleBatch<T>(xs + i, ys + i, std::min(n - i, k_batchSize), routineIndex);
+  }
+}
+
+template<typename T>
+void CompiledExpression::approximateSingleBatch(const T * xs, T * ys, int n, int routineIndex) const {
+  assert(isCompiled() && routineIndex < m_numberOfRoutines);
+  assert(0 < n && n <= k_batchSize);
+  const std::complex<T> * constants = this->constants<T>();
+  std::complex<T> stack[k_maxStackDepth][k_batchSize];
+  /* Each value follows its own path through the program. Since jumps only go
+   * forward, a value which jumped is left aside until the instruction it
+   * jumped to is reached. The stack depth at an instruction does not depend on
+   * the path leading to it. */
+  uint8_t resumeIndex[k_batchSize];
+  // Approximations of the tree are tracked value by value
+  bool encounteredComplex[k_batchSize];
+  int instructionIndex = m_routineStarts[routineIndex];
+  for (int i = 0; i < n; i++) {
+    resumeIndex[i] = instructionIndex;
+    encounteredComplex[i] = false;
+  }
+  int stackDepth = 0;
+  while (true) {
+    const Instruction instruction = m_instructions[instructionIndex];
+    bool isActive[k_batchSize];
+    for (int i = 0; i < n; i++) {
+      isActive[i] = resumeIndex[i] <= instructionIndex;
+    }
+    switch (instruction.opCode) {
+    case OpCode::Variable:
+      for (int i = 0; i < n; i++) {
+        if (isActive[i]) {
+          // Like Complex<T>::Builder, replace -0 with 0
+          stack[stackDepth][i] = std::complex<T>(xs[i] == static_cast<T>(0.0) ? static_cast<T>(0.0) : xs[i]);
+        }
+      }
+      stackDepth++;
+      break;
+    case OpCode::Constant:
+      for (int i = 0; i < n; i++) {
+        if (isActive[i]) {
+          stack[stackDepth][i] = constants[instruction.operand];
+        }
+      }
+      stackDepth++;
+      break;
+    case OpCode::Addition:
+    case OpCode::Multiplication:
+    case OpCode::Subtraction:
+    case OpCode::Division:
+    case OpCode::Power:
+    case OpCode::Logarithm:
+    case OpCode::Comparison:
+    case OpCode::Opposite:
+    case OpCode::Function:
+    {
+      bool isBinary = instruction.opCode != OpCode::Opposite && instruction.opCode != OpCode::Function;
+      stackDepth -= isBinary;
+      std::complex<T> * a = stack[stackDepth - 1];
+      const std::complex<T> * b = isBinary ? stack[stackDepth] : nullptr;
+      for (int i = 0; i < n; i++) {
+        if (!isActive[i]) {
+          continue;
+        }
+        std::complex<T> bValue = isBinary ? b[i] : std::complex<T>(0.0);
+        if (a[i].imag() == static_cast<T>(0.0) && bValue.imag() == static_cast<T>(0.0) && ComputeRealOperation<T>(instruction.opCode, a[i].real(), bValue.real(), a + i)) {
+          continue;
+        }
+        Expression::SetEncounteredComplex(false);
+        a[i] = computeOperation<T>(instruction, a[i], bValue);
+        encounteredComplex[i] = encounteredComplex[i] || Expression::EncounteredComplex();
+      }
+      break;
+    }
+    case OpCode::Pop:
+      stackDepth--;
+      break;
+    case OpCode::Jump:
+      for (int i = 0; i < n; i++) {
+        if (isActive[i]) {
+          resumeIndex[i] = instruction.operand;
+        }
+      }
+      // The next instruction is reached without the value of this branch
+      stackDepth--;
+      break;
+    case OpCode::JumpIfNotTrue:
+      stackDepth--;
+      for (int i = 0; i < n; i++) {
+        if (isActive[i] && stack[stackDepth][i] != std::complex<T>(1.0)) {
+          resumeIndex[i] = instruction.operand;
+        }
+      }
+      break;
+    case OpCode::JumpIfUndefined:
+      for (int i = 0; i < n; i++) {
+        if (isActive[i] && IsUndefined(stack[stackDepth - 1][i])) {
+          stack[stackDepth - 1][i] = std::complex<T>(NAN, NAN);
+          resumeIndex[i] = instruction.operand;
+        }
+      }
+      break;
+    default:
+      assert(instruction.opCode == OpCode::Return && stackDepth == 1);
+      // Mimic approximateWithValue
+      for (int i = 0; i < n; i++) {
+        assert(isActive[i]);
+        ys[i] = m_complexFormat == Preferences::ComplexFormat::Real && encounteredComplex[i] ? NAN : ComplexNode<T>::ToScalar(stack[0][i]);
+      }
+      Expression::SetEncounteredComplex(false);
+      return;
+    }
+    assert(stackDepth >= 0 && stackDepth <= k_maxStackDepth);
+    instructionIndex++;
+  }
+}
+
+template<typename T>
+bool CompiledExpression::approximateDerivatives(T x, int order, T * derivatives, int routineIndex) const {
+  assert(isCompiled() && routineIndex < m_numberOfRoutines);
+  assert(0 <= order && order <= k_maxDerivativeOrder);
+  const int n = order + 1;
+  const std::complex<T> * constants = this->constants<T>();
+  T stack[k_maxStackDepth][k_maxNumberOfCoefficients];
+  int stackDepth = 0;
+  int instructionIndex = m_routineStarts[routineIndex];
+  while (true) {
+    const Instruction instruction = m_instructions[instructionIndex++];
+    switch (instruction.opCode) {
+    case OpCode::Variable:
+      SeriesConstant(x, stack[stackDepth], n);
+      if (n > 1) {
+        stack[stackDepth][1] = static_cast<T>(1.0);
+      }
+      stackDepth++;
+      break;
+    case OpCode::Constant:
+    {
+      std::complex<T> value = constants[instruction.operand];
+      if (value.imag() != static_cast<T>(0.0)) {
+        return false;
+      }
+      SeriesConstant(value.real(), stack[stackDepth++], n);
+      break;
+    }
+    case OpCode::Addition:
+    case OpCode::Subtraction:
+      stackDepth--;
+      for (int k = 0; k < n; k++) {
+        stack[stackDepth - 1][k] += instruction.opCode == OpCode::Addition ? stack[stackDepth][k] : -stack[stackDepth][k];
+      }
+      break;
+    case OpCode::Multiplication:
+      stackDepth--;
+      SeriesProduct(stack[stackDepth - 1], stack[stackDepth], stack[stackDepth - 1], n);
+      break;
+    case OpCode::Division:
+      stackDepth--;
+      if (stack[stackDepth][0] == static_cast<T>(0.0)) {
+        return false;
+      }
+      SeriesQuotient(stack[stackDepth - 1], stack[stackDepth], stack[stackDepth - 1], n);
+      break;
+    case OpCode::Power:
+    case OpCode::Logarithm:
+      stackDepth--;
+      if (!differentiateBinaryOperation(instruction, stack[stackDepth - 1], stack[stackDepth], n)) {
+        return false;
+      }
+      break;
+    case OpCode::Opposite:
+      for (int k = 0; k < n; k++) {
+        stack[stackDepth - 1][k] = -stack[stackDepth - 1][k];
+      }
+      break;
+    case OpCode::Function:
+      if (!differentiateFunction(static_cast<ExpressionNode::Type>(instruction.operand), stack[stackDepth - 1], n)) {
+        return false;
+      }
+      break;
+    case OpCode::Pop:
+      stackDepth--;
+      break;
+    case OpCode::JumpIfUndefined:
+      // Values are checked to be finite after each instruction
+      break;
+    case OpCode::Return:
+      assert(stackDepth == 1);
+      for (int k = 0, factorial = 1; k < n; k++) {
+        factorial *= k > 0 ? k : 1;
+        derivatives[k] = stack[0][k] * factorial;
+      }
+      return true;
+    default:
+      // Comparisons and piecewise branches are not smooth
+      return false;
+    }
+    assert(stackDepth >= 0 && stackDepth <= k_maxStackDepth);
+    // Undefined, infinite and non real values are left to the tree approximation
+    if (stackDepth > 0 && !SeriesAreFinite(stack[stackDepth - 1], n)) {
+      return false;
+    }
+  }
+}
+
+template<typename T>
+bool CompiledExpression::differentiateBinaryOperation(Instruction instruction, T * a, const T * b, int n) const {
+  // Use the value computed by the tree, which may be a real root
+  std::complex<T> value = computeOperation<T>(instruction, a[0], b[0]);
+  if (value.imag() != static_cast<T>(0.0) || !std::isfinite(value.real())) {
+    return false;
+  }
+  T result[k_maxNumberOfCoefficients];
+  result[0] = value.real();
+  if (instruction.opCode == OpCode::Logarithm) {
+    // log(a, b) = ln(a) / ln(b)
+    T logarithmOfB[k_maxNumberOfCoefficients];
+    if (a[0] <= static_cast<T>(0.0) || b[0] <= static_cast<T>(0.0) || b[0] == static_cast<T>(1.0)) {
+      return false;
+    }
+    SeriesLogarithm(a, result, n);
+    SeriesLogarithm(b, logarithmOfB, n);
+    SeriesQuotient(result, logarithmOfB, result, n);
+    result[0] = value.real();
+    SeriesCopy(result, a, n);
+    return true;
+  }
+  assert(instruction.opCode == OpCode::Power);
+  bool hasConstantIndex = true;
+  for (int k = 1; k < n; k++) {
+    hasConstantIndex = hasConstantIndex && b[k] == static_cast<T>(0.0);
+  }
+  if (!hasConstantIndex) {
+    // a^b = exp(b * ln(a))
+    if (a[0] <= static_cast<T>(0.0)) {
+      return false;
+    }
+    T exponent[k_maxNumberOfCoefficients];
+    SeriesLogarithm(a, exponent, n);
+    SeriesProduct(b, exponent, exponent, n);
+    SeriesPrimitive(exponent, result, result, n);
+  } else if (a[0] != static_cast<T>(0.0)) {
+    SeriesPower(a, b[0], result, n);
+  } else {
+    // Around a root of a, a^p is only smooth for positive integers p
+    T p = b[0];
+    if (p <= static_cast<T>(0.0) || p != std::floor(p)) {
+      return false;
+    }
+    if (p >= n) {
+      SeriesConstant(static_cast<T>(0.0), result, n);
+    } else {
+      SeriesCopy(a, result, n);
+      for (int i = 1; i < static_cast<int>(p); i++) {
+        SeriesProduct(result, a, result, n);
+      }
+    }
+  }
+  SeriesCopy(result, a, n);
+  return true;
+}
+
+template<typename T>
+bool CompiledExpression::differentiateFunction(ExpressionNode::Type type, T * a, int n) const {
+  std::complex<T> value = ComputeFunction<T>(type, a[0], m_complexFormat, m_angleUnit);
+  if (value.imag() != static_cast<T>(0.0) || !std::isfinite(value.real())) {
+    return false;
+  }
+  const T angleFactor = static_cast<T>(M_PI / Trigonometry::PiInAngleUnit(m_angleUnit));
+  T result[k_maxNumberOfCoefficients];
+  // Derivative of the function, for functions defined by their primitive
+  T derivative[k_maxNumberOfCoefficients];
+  T angle[k_maxNumberOfCoefficients];
+  T sine[k_maxNumberOfCoefficients];
+  T cosine[k_maxNumberOfCoefficients];
+  bool isPrimitive = false;
+  switch (type) {
+  case ExpressionNode::Type::AbsoluteValue:
+    if (a[0] == static_cast<T>(0.0)) {
+      return false;
+    }
+    for (int k = 0; k < n; k++) {
+      result[k] = a[0] > static_cast<T>(0.0) ? a[k] : -a[k];
+    }
+    break;
+  case ExpressionNode::Type::Cosine:
+  case ExpressionNode::Type::Sine:
+  case ExpressionNode::Type::Tangent:
+  case ExpressionNode::Type::Secant:
+  case ExpressionNode::Type::Cosecant:
+  case ExpressionNode::Type::Cotangent:
+    for (int k = 0; k < n; k++) {
+      angle[k] = a[k] * angleFactor;
+    }
+    sine[0] = std::sin(angle[0]);
+    cosine[0] = std::cos(angle[0]);
+    SeriesSineAndCosine(angle, sine, cosine, n, false);
+    if (type == ExpressionNode::Type::Cosine) {
+      SeriesCopy(cosine, result, n);
+    } else if (type == ExpressionNode::Type::Sine) {
+      SeriesCopy(sine, result, n);
+    } else {
+      const T * numerator = type == ExpressionNode::Type::Tangent ? sine : type == ExpressionNode::Type::Cotangent ? cosine : nullptr;
+      const T * denominator = type == ExpressionNode::Type::Tangent || type == ExpressionNode::Type::Secant ? cosine : sine;
+      if (denominator[0] == static_cast<T>(0.0)) {
+        return false;
+      }
+      T one[k_maxNumberOfCoefficients];
+      SeriesConstant(static_cast<T>(1.0), one, n);
+      SeriesQuotient(numerator ? numerator : one, denominator, result, n);
+    }
+    break;
+  case ExpressionNode::Type::HyperbolicCosine:
+  case ExpressionNode::Type::HyperbolicSine:
+  case ExpressionNode::Type::HyperbolicTangent:
+    sine[0] = std::sinh(a[0]);
+    cosine[0] = std::cosh(a[0]);
+    SeriesSineAndCosine(a, sine, cosine, n, true);
+    if (type == ExpressionNode::Type::HyperbolicCosine) {
+      SeriesCopy(cosine, result, n);
+    } else if (type == ExpressionNode::Type::HyperbolicSine) {
+      SeriesCopy(sine, result, n);
+    } else {
+      SeriesQuotient(sine, cosine, result, n);
+    }
+    break;
+  case ExpressionNode::Type::ArcCosine:
+  case ExpressionNode::Type::ArcSine:
+  case ExpressionNode::Type::HyperbolicArcSine:
+  case ExpressionNode::Type::HyperbolicArcCosine:
+  {
+    // Derivatives are ±1/√(1-a^2), 1/√(1+a^2) and 1/√(a^2-1)
+    T square[k_maxNumberOfCoefficients];
+    SeriesOneAndSquare(a, static_cast<T>(type == ExpressionNode::Type::HyperbolicArcSine ? 1.0 : -1.0), square, n);
+    if (type == ExpressionNode::Type::HyperbolicArcCosine) {
+      for (int k = 0; k < n; k++) {
+        square[k] = -square[k];
+      }
+    }
+    if (square[0] <= static_cast<T>(0.0)) {
+      return false;
+    }
+    derivative[0] = static_cast<T>(1.0) / std::sqrt(square[0]);
+    SeriesPower(square, static_cast<T>(-0.5), derivative, n);
+    T scale = type == ExpressionNode::Type::ArcSine ? static_cast<T>(1.0) / angleFactor : type == ExpressionNode::Type::ArcCosine ? static_cast<T>(-1.0) / angleFactor : static_cast<T>(1.0);
+    for (int k = 0; k < n; k++) {
+      derivative[k] *= scale;
+    }
+    isPrimitive = true;
+    break;
+  }
+  case ExpressionNode::Type::ArcTangent:
+  case ExpressionNode::Type::HyperbolicArcTangent:
+  {
+    // Derivatives are 1/(1+a^2) and 1/(1-a^2)
+    T square[k_maxNumberOfCoefficients];
+    T numerator[k_maxNumberOfCoefficients];
+    SeriesOneAndSquare(a, static_cast<T>(type == ExpressionNode::Type::ArcTangent ? 1.0 : -1.0), square, n);
+    if (square[0] == static_cast<T>(0.0)) {
+      return false;
+    }
+    SeriesConstant(type == ExpressionNode::Type::ArcTangent ? static_cast<T>(1.0) / angleFactor : static_cast<T>(1.0), numerator, n);
+    SeriesQuotient(numerator, square, derivative, n);
+    isPrimitive = true;
+    break;
+  }
+  case ExpressionNode::Type::Logarithm:
+  case ExpressionNode::Type::NaperianLogarithm:
+    if (a[0] <= static_cast<T>(0.0)) {
+      return false;
+    }
+    SeriesLogarithm(a, result, n);
+    if (type == ExpressionNode::Type::Logarithm) {
+      for (int k = 0; k < n; k++) {
+        result[k] /= static_cast<T>(M_LN10);
+      }
+    }
+    break;
+  case ExpressionNode::Type::SquareRoot:
+    if (a[0] <= static_cast<T>(0.0)) {
+      return false;
+    }
+    result[0] = value.real();
+    SeriesPower(a, static_cast<T>(0.5), result, n);
+    break;
+  default:
+    return false;
+  }
+  if (isPrimitive) {
+    SeriesPrimitive(a, derivative, result, n);
+  }
+  // Keep the value computed by the tree
+  result[0] = value.real();
+  SeriesCopy(result, a, n);
+  return true;
+}
+
+template<typename T>
+bool CompiledExpression::approximateOnInterval(T xMin, T xMax, Enclosure<T> * enclosure, int routineIndex) const {
+  assert(isCompiled() && routineIndex < m_numberOfRoutines);
+  assert(std::isfinite(xMin) && std::isfinite(xMax) && xMin <= xMax);
+  if (m_complexFormat != Preferences::ComplexFormat::Real) {
+    // Non real intermediate values could lead to real results
+    return false;
+  }
+  const std::complex<T> * constants = this->constants<T>();
+  T stack[k_maxStackDepth][2];
+  int stackDepth = 0;
+  int instructionIndex = m_routineStarts[routineIndex];
+  bool isContinuous = true;
+  while (true) {
+    const Instruction instruction = m_instructions[instructionIndex++];
+    T * a = stackDepth > 0 ? stack[stackDepth - 1] : nullptr;
+    switch (instruction.opCode) {
+    case OpCode::Variable:
+      IntervalSet(stack[stackDepth++], xMin, xMax);
+      break;
+    case OpCode::Constant:
+    {
+      std::complex<T> value = constants[instruction.operand];
+      if (IsUndefined(value)) {
+        IntervalSetUndefined(stack[stackDepth++]);
+        break;
+      }
+      if (value.imag() != static_cast<T>(0.0)) {
+        return false;
+      }
+      IntervalSet(stack[stackDepth++], value.real(), value.real());
+      break;
+    }
+    case OpCode::Addition:
+    case OpCode::Multiplication:
+    case OpCode::Subtraction:
+    case OpCode::Division:
+    case OpCode::Power:
+    case OpCode::Logarithm:
+      stackDepth--;
+      a = stack[stackDepth - 1];
+      if (IntervalIsUndefined(a) || IntervalIsUndefined(stack[stackDepth])) {
+        IntervalSetUndefined(a);
+      } else if (!encloseBinaryOperation(instruction, a, stack[stackDepth], &isContinuous)) {
+        return false;
+      }
+      break;
+    case OpCode::Comparison:
+      stackDepth--;
+      IntervalComparison(static_cast<ComparisonNode::OperatorType>(instruction.operand), stack[stackDepth - 1], stack[stackDepth]);
+      break;
+    case OpCode::Opposite:
+      IntervalSet(a, -a[1], -a[0]);
+      break;
+    case OpCode::Function:
+      if (!IntervalIsUndefined(a) && !encloseFunction(static_cast<ExpressionNode::Type>(instruction.operand), a, &isContinuous)) {
+        return false;
+      }
+      break;
+    case OpCode::Pop:
+      stackDepth--;
+      break;
+    case OpCode::Jump:
+      instructionIndex = instruction.operand;
+      break;
+    case OpCode::JumpIfNotTrue:
+      stackDepth--;
+      if (a[0] != a[1]) {
+        // The condition changes on the interval: the piecewise may jump
+        isContinuous = false;
+      } else if (a[0] != static_cast<T>(1.0)) {
+        instructionIndex = instruction.operand;
+      }
+      break;
+    case OpCode::JumpIfUndefined:
+      if (IntervalIsUndefined(a)) {
+        instructionIndex = instruction.operand;
+      }
+      break;
+    default:
+      assert(instruction.opCode == OpCode::Return && stackDepth == 1);
+      *enclosure = {stack[0][0], stack[0][1], !IntervalIsUndefined(stack[0])};
+      return true;
+    }
+    assert(stackDepth >= 0 && stackDepth <= k_maxStackDepth);
+    // Infinite bounds come from overflows or asymptotes
+    a = stackDepth > 0 ? stack[stackDepth - 1] : nullptr;
+    if (!isContinuous || (a && !IntervalIsUndefined(a) && !(std::isfinite(a[0]) && std::isfinite(a[1])))) {
+      *enclosure = {-static_cast<T>(INFINITY), static_cast<T>(INFINITY), false};
+      return true;
+    }
+  }
+}
+
+template<typename T>
+bool CompiledExpression::encloseBinaryOperation(Instruction instruction, T * a, const T * b, bool * isContinuous) const {
+  constexpr T zero = static_cast<T>(0.0);
+  switch (instruction.opCode) {
+  case OpCode::Addition:
+    IntervalSet(a, a[0] + b[0], a[1] + b[1]);
+    return true;
+  case OpCode::Subtraction:
+    IntervalSet(a, a[0] - b[1], a[1] - b[0]);
+    return true;
+  case OpCode::Multiplication:
+    IntervalProduct(a, b, a);
+    return true;
+  case OpCode::Division:
+  {
+    if (IntervalContains(b, zero)) {
+      // Division by zero
+      if (b[0] == b[1]) {
+        IntervalSetUndefined(a);
+      } else {
+        *isContinuous = false;
+      }
+      return true;
+    }
+    T inverse[2] = {b[0], b[1]};
+    IntervalInverse(inverse);
+    IntervalProduct(a, inverse, a);
+    return true;
+  }
+  case OpCode::Logarithm:
+  {
+    // log(a, b) = ln(a) / ln(b)
+    if (a[1] <= zero || b[1] <= zero) {
+      IntervalSetUndefined(a);
+      return true;
+    }
+    T logarithmOfB[2] = {std::log(b[0]), std::log(b[1])};
+    if (a[0] <= zero || b[0] <= zero || IntervalContains(logarithmOfB, zero)) {
+      *isContinuous = false;
+      return true;
+    }
+    IntervalInverse(logarithmOfB);
+    IntervalSet(a, std::log(a[0]), std::log(a[1]));
+    IntervalProduct(a, logarithmOfB, a);
+    return true;
+  }
+  default:
+    assert(instruction.opCode == OpCode::Power);
+  }
+  if (b[0] != b[1]) {
+    // a^b = exp(b * ln(a)), which is only real for positive a
+    if (a[0] <= zero) {
+      *isContinuous = false;
+      return true;
+    }
+    T exponent[2] = {std::log(a[0]), std::log(a[1])};
+    IntervalProduct(exponent, b, exponent);
+    IntervalSet(a, std::exp(exponent[0]), std::exp(exponent[1]));
+    return true;
+  }
+  /* With a constant index p, a^p is monotonic on each side of 0. It is even
+   * or odd on negative values if they have a real power, which is the case of
+   * integers p and of rationals whose denominator is odd. */
+  T p = b[0];
+  bool isEven = false;
+  bool isOdd = false;
+  if (p == std::floor(p)) {
+    isEven = std::fmod(p, static_cast<T>(2.0)) == zero;
+    isOdd = !isEven;
+  } else if (instruction.operand != k_noOperand) {
+    std::complex<T> rationalIndex = constants<T>()[instruction.operand];
+    if (std::fmod(rationalIndex.imag(), static_cast<T>(2.0)) != zero) {
+      isEven = std::fmod(rationalIndex.real(), static_cast<T>(2.0)) == zero;
+      isOdd = !isEven;
+    }
+  }
+  if (a[0] < zero && !isEven && !isOdd) {
+    if (a[1] < zero) {
+      IntervalSetUndefined(a);
+    } else {
+      *isContinuous = false;
+    }
+    return true;
+  }
+  if (p <= zero && IntervalContains(a, zero)) {
+    // 0^p is undefined
+    IntervalSetPartiallyUndefined(a, isContinuous);
+    return true;
+  }
+  if (p == zero) {
+    IntervalSet(a, static_cast<T>(1.0), static_cast<T>(1.0));
+  } else if (isEven && a[0] < zero) {
+    IntervalAbsoluteValue(a);
+    IntervalSet(a, std::pow(a[0], p), std::pow(a[1], p));
+  } else {
+    IntervalSet(a, std::copysign(std::pow(std::fabs(a[0]), p), a[0]), std::copysign(std::pow(std::fabs(a[1]), p), a[1]));
+  }
+  return true;
+}
+
+template<typename T>
+bool CompiledExpression::encloseFunction(ExpressionNode::Type type, T * a, bool * isContinuous) const {
+  constexpr T zero = static_cast<T>(0.0);
+  constexpr T one = static_cast<T>(1.0);
+  constexpr T pi = static_cast<T>(M_PI);
+  // Monotonic functions are evaluated at the bounds of their domain intervals
+  T lowerDomainBound = -static_cast<T>(INFINITY);
+  T upperDomainBound = static_cast<T>(INFINITY);
+  bool isMonotonic = false;
+  switch (type) {
+  case ExpressionNode::Type::AbsoluteValue:
+    IntervalAbsoluteValue(a);
+    return true;
+  case ExpressionNode::Type::Conjugate:
+  case ExpressionNode::Type::RealPart:
+    return true;
+  case ExpressionNode::Type::ImaginaryPart:
+    IntervalSet(a, zero, zero);
+    return true;
+  case ExpressionNode::Type::ComplexArgument:
+    if (a[1] < zero || a[0] >= zero) {
+      IntervalSet(a, a[1] < zero ? pi : zero, a[1] < zero ? pi : zero);
+    } else {
+      *isContinuous = false;
+    }
+    return true;
+  case ExpressionNode::Type::Ceiling:
+  case ExpressionNode::Type::Floor:
+  case ExpressionNode::Type::FracPart:
+  case ExpressionNode::Type::SignFunction:
+  {
+    // Integer parts are only continuous where they are constant
+    ExpressionNode::Type integerType = type == ExpressionNode::Type::FracPart ? ExpressionNode::Type::Floor : type;
+    T lower = ComputeFunction<T>(integerType, a[0], m_complexFormat, m_angleUnit).real();
+    T upper = ComputeFunction<T>(integerType, a[1], m_complexFormat, m_angleUnit).real();
+    if (lower != upper) {
+      *isContinuous = false;
+    } else if (type == ExpressionNode::Type::FracPart) {
+      lower = std::floor(a[0]);
+      IntervalSet(a, a[0] - lower, a[1] - lower);
+    } else {
+      IntervalSet(a, lower, lower);
+    }
+    return true;
+  }
+  case ExpressionNode::Type::Factorial:
+    // Only defined on natural numbers
+    if (a[0] == a[1]) {
+      T value = ComputeFunction<T>(type, a[0], m_complexFormat, m_angleUnit).real();
+      IntervalSet(a, value, value);
+    } else if (std::ceil(std::max(a[0], zero)) <= a[1]) {
+      *isContinuous = false;
+    } else {
+      IntervalSetUndefined(a);
+    }
+    return true;
+  case ExpressionNode::Type::Cosine:
+  case ExpressionNode::Type::Sine:
+  case ExpressionNode::Type::Secant:
+  case ExpressionNode::Type::Cosecant:
+  {
+    // sin(x) = cos(x - π/2)
+    const T angleFactor = static_cast<T>(M_PI / Trigonometry::PiInAngleUnit(m_angleUnit));
+    const T shift = type == ExpressionNode::Type::Cosine || type == ExpressionNode::Type::Secant ? zero : pi / 2;
+    IntervalSet(a, a[0] * angleFactor - shift, a[1] * angleFactor - shift);
+    IntervalCosine(a);
+    if (type == ExpressionNode::Type::Secant || type == ExpressionNode::Type::Cosecant) {
+      if (IntervalContains(a, zero)) {
+        IntervalSetPartiallyUndefined(a, isContinuous);
+      } else {
+        IntervalInverse(a);
+      }
+    }
+    return true;
+  }
+  case ExpressionNode::Type::Tangent:
+  case ExpressionNode::Type::Cotangent:
+  {
+    // Both are monotonic between their poles, shifted to the multiples of π
+    const T angleFactor = static_cast<T>(M_PI / Trigonometry::PiInAngleUnit(m_angleUnit));
+    const T shift = type == ExpressionNode::Type::Tangent ? pi / 2 : zero;
+    T lower = a[0] * angleFactor + shift;
+    T upper = a[1] * angleFactor + shift;
+    if (upper - lower >= pi || std::ceil(lower / pi) * pi <= upper) {
+      IntervalSetPartiallyUndefined(a, isContinuous);
+      return true;
+    }
+    isMonotonic = true;
+    break;
+  }
+  case ExpressionNode::Type::ArcCosecant:
+  case ExpressionNode::Type::ArcSecant:
+    // Defined on ]-inf, -1] and [1, inf[, and monotonic on each of them
+    if (a[0] > -one && a[1] < one) {
+      IntervalSetUndefined(a);
+      return true;
+    }
+    if (a[1] >= one) {
+      lowerDomainBound = one;
+    } else {
+      upperDomainBound = -one;
+    }
+    isMonotonic = true;
+    break;
+  case ExpressionNode::Type::ArcCotangent:
+    // Jumps at 0, from -π/2 to π/2
+    if (IntervalContains(a, zero)) {
+      if (a[0] == a[1]) {
+        T value = ComputeFunction<T>(type, zero, m_complexFormat, m_angleUnit).real();
+        IntervalSet(a, value, value);
+      } else {
+        *isContinuous = false;
+      }
+      return true;
+    }
+    isMonotonic = true;
+    break;
+  case ExpressionNode::Type::ArcCosine:
+  case ExpressionNode::Type::ArcSine:
+    lowerDomainBound = -one;
+    upperDomainBound = one;
+    isMonotonic = true;
+    break;
+  case ExpressionNode::Type::HyperbolicArcCosine:
+    lowerDomainBound = one;
+    isMonotonic = true;
+    break;
+  case ExpressionNode::Type::HyperbolicArcTangent:
+    // The bounds of the domain are excluded
+    if (a[1] <= -one || a[0] >= one) {
+      IntervalSetUndefined(a);
+    } else if (a[0] <= -one || a[1] >= one) {
+      *isContinuous = false;
+    } else {
+      isMonotonic = true;
+    }
+    break;
+  case ExpressionNode::Type::Logarithm:
+  case ExpressionNode::Type::NaperianLogarithm:
+    if (a[1] <= zero) {
+      IntervalSetUndefined(a);
+    } else if (a[0] <= zero) {
+      IntervalSetPartiallyUndefined(a, isContinuous);
+    } else {
+      isMonotonic = true;
+    }
+    break;
+  case ExpressionNode::Type::SquareRoot:
+    lowerDomainBound = zero;
+    isMonotonic = true;
+    break;
+  case ExpressionNode::Type::HyperbolicCosine:
+    // Even and increasing on positive values
+    IntervalAbsoluteValue(a);
+    isMonotonic = true;
+    break;
+  case ExpressionNode::Type::ArcTangent:
+  case ExpressionNode::Type::HyperbolicArcSine:
+  case ExpressionNode::Type::HyperbolicSine:
+  case ExpressionNode::Type::HyperbolicTangent:
+    isMonotonic = true;
+    break;
+  default:
+    return false;
+  }
+  if (!isMonotonic) {
+    return true;
+  }
+  if (a[1] < lowerDomainBound || a[0] > upperDomainBound) {
+    IntervalSetUndefined(a);
+    return true;
+  }
+  if (a[0] < lowerDomainBound || a[1] > upperDomainBound) {
+    *isContinuous = false;
+    return true;
+  }
+  IntervalSet(a, ComputeFunction<T>(type, a[0], m_complexFormat, m_angleUnit).real(), ComputeFunction<T>(type, a[1], m_complexFormat, m_angleUnit).real());
+  return true;
+}
+
+template float CompiledExpression::approximateWithValue<float>(float, int) const;
+template double CompiledExpression::approximateWithValue<double>(double, int) const;
+template std::complex<float> CompiledExpression::approximateWithinParent<float>(float, int) const;
+template std::complex<double> CompiledExpression::approximateWithinParent<double>(double, int) const;
+template void CompiledExpression::approximateBatch<float>(const float *, float *, int, int) const;
+template void CompiledExpression::approximateBatch<double>(const double *, double *, int, int) const;
+template bool CompiledExpression::approximateDerivatives<float>(float, int, float *, int) const;
+template bool CompiledExpression::approximateDerivatives<double>(double, int, double *, int) const;
+template bool CompiledExpression::approximateOnInterval<float>(float, float, Enclosure<float> *, int) const;
+template bool CompiledExpression::approximateOnInterval<double>(double, double, Enclosure<double> *, int) const;
+
+}
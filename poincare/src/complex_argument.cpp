@@ -28,8 +28,8 @@ Expression ComplexArgumentNode::shallowReduce(const ReductionContext& reductionC
 }
 
 template<typename T>
-Complex<T> ComplexArgumentNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
-  return Complex<T>::Builder(std::arg(c));
+std::complex<T> ComplexArgumentNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
+  return std::complex<T>(std::arg(c));
 }
 
 Expression ComplexArgument::shallowReduce(ReductionContext reductionContext) {
@@ -27,8 +27,8 @@ Expression ConjugateNode::shallowReduce(const ReductionContext& reductionContext
 }
 
 template<typename T>
-Complex<T> ConjugateNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
-  return Complex<T>::Builder(std::conj(c));
+std::complex<T> ConjugateNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
+  return std::complex<T>(std::conj(c));
 }
 
 Expression Conjugate::shallowReduce(ReductionContext reductionContext) {
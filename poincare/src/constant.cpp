@@ -13,6 +13,7 @@
 #include <algorithm>
 #include <assert.h>
 #include <ion/unicode/utf8_decoder.h>
+#include "parsing/identifier_table.h"
 
 namespace Poincare {
 
@@ -52,12 +53,12 @@ Layout ConstantNode::createLayout(Preferences::PrintFloatMode floatDisplayMode,
 }
 
 template<typename T>
-Evaluation<T> ConstantNode::templatedApproximate() const {
+std::complex<T> ConstantNode::templatedApproximate() const {
   if (isComplexI()) {
-    return Complex<T>::Builder(0.0, 1.0);
+    return std::complex<T>(0.0, 1.0);
   }
   ConstantInfo info = constantInfo();
-  return info.m_unit ? Complex<T>::Undefined() : Complex<T>::Builder(info.m_value);
+  return info.m_unit ? std::complex<T>(NAN, NAN) : std::complex<T>(info.m_value);
 }
 
 Expression ConstantNode::shallowReduce(const ReductionContext& reductionContext) {
@@ -114,12 +115,7 @@ bool Constant::derivate(const ReductionContext& reductionContext, Symbol symbol,
 }
 
 int Constant::ConstantInfoIndexFromName(const char * name, int length) {
-  for (int i = 0; i < ConstantNode::k_numberOfConstants; i++) {
-    if (ConstantNode::k_constants[i].m_aliasesList.contains(name, length)) {
-      return i;
-    }
-  }
-  return -1;
+  return IdentifierTable::IndexForName(IdentifierTable::Kind::Constant, name, length);
 }
 
 }
@@ -13,12 +13,12 @@ namespace Poincare {
 int CosecantNode::numberOfChildren() const { return Cosecant::s_functionHelper.numberOfChildren(); }
 
 template<typename T>
-Complex<T> CosecantNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
-  std::complex<T> denominator = SineNode::computeOnComplex<T>(c, complexFormat, angleUnit).complexAtIndex(0);
+std::complex<T> CosecantNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+  std::complex<T> denominator = ComplexNode<T>::Normalize(SineNode::computeOnComplex<T>(c, complexFormat, angleUnit));
   if (denominator == static_cast<T>(0.0)) {
-    return Complex<T>::Undefined();
+    return std::complex<T>(NAN, NAN);
   }
-  return Complex<T>::Builder(std::complex<T>(1) / denominator);
+  return std::complex<T>(std::complex<T>(1) / denominator);
 }
 
 Layout CosecantNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits, Context * context) const {
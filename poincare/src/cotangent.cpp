@@ -14,13 +14,13 @@ namespace Poincare {
 int CotangentNode::numberOfChildren() const { return Cotangent::s_functionHelper.numberOfChildren(); }
 
 template<typename T>
-Complex<T> CotangentNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
-  std::complex<T> denominator = SineNode::computeOnComplex<T>(c, complexFormat, angleUnit).complexAtIndex(0);
-  std::complex<T> numerator = CosineNode::computeOnComplex<T>(c, complexFormat, angleUnit).complexAtIndex(0);
+std::complex<T> CotangentNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+  std::complex<T> denominator = ComplexNode<T>::Normalize(SineNode::computeOnComplex<T>(c, complexFormat, angleUnit));
+  std::complex<T> numerator = ComplexNode<T>::Normalize(CosineNode::computeOnComplex<T>(c, complexFormat, angleUnit));
   if (denominator == static_cast<T>(0.0)) {
-    return Complex<T>::Undefined();
+    return std::complex<T>(NAN, NAN);
   }
-  return Complex<T>::Builder(numerator / denominator);
+  return std::complex<T>(numerator / denominator);
 }
 
 Layout CotangentNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits, Context * context) const {
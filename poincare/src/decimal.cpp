@@ -60,28 +60,28 @@ void removeZeroAtTheEnd(Integer * i, int minimalNumbersOfDigits = -1) {
   assert(!i->isOverflow());
 }
 
-DecimalNode::DecimalNode(const native_uint_t * mantissaDigits, uint8_t mantissaSize, int exponent, bool negative) :
+DecimalNode::DecimalNode(const uint32_t * mantissaWords, uint8_t mantissaSize, int exponent, bool negative) :
   m_negative(negative),
   m_exponent(exponent),
-  m_numberOfDigitsInMantissa(mantissaSize)
+  m_numberOfWordsInMantissa(mantissaSize)
 {
-  memcpy(m_mantissa, mantissaDigits, mantissaSize*sizeof(native_uint_t));
+  memcpy(m_mantissa, mantissaWords, mantissaSize*sizeof(uint32_t));
 }
 
 Integer DecimalNode::signedMantissa() const {
-  return Integer::BuildInteger((native_uint_t *)m_mantissa, m_numberOfDigitsInMantissa, m_negative);
+  return Integer::BuildIntegerFromWords(m_mantissa, m_numberOfWordsInMantissa, m_negative);
 }
 
 Integer DecimalNode::unsignedMantissa() const {
-  return Integer::BuildInteger((native_uint_t *)m_mantissa, m_numberOfDigitsInMantissa, false);
+  return Integer::BuildIntegerFromWords(m_mantissa, m_numberOfWordsInMantissa, false);
 }
 
-static size_t DecimalSize(uint8_t numberOfDigitsInMantissa) {
-  return sizeof(DecimalNode)+ sizeof(native_uint_t)*numberOfDigitsInMantissa;
+static size_t DecimalSize(uint8_t numberOfWordsInMantissa) {
+  return sizeof(DecimalNode)+ sizeof(uint32_t)*numberOfWordsInMantissa;
 }
 
 size_t DecimalNode::size() const {
-  return DecimalSize(m_numberOfDigitsInMantissa);
+  return DecimalSize(m_numberOfWordsInMantissa);
 }
 
 int DecimalNode::simplificationOrderSameType(const ExpressionNode * e, bool ascending, bool ignoreParentheses) const {
@@ -423,12 +423,12 @@ Decimal Decimal::Builder(T f) {
 /* We do not get rid of the useless 0s ending the mantissa here because we want
  * to keep them if they were entered by the user. */
 Decimal Decimal::Builder(Integer m, int e) {
-  return Decimal::Builder(DecimalSize(m.numberOfDigits()), m, e);
+  return Decimal::Builder(DecimalSize(m.numberOfWords()), m, e);
 }
 
 Decimal Decimal::Builder(size_t size, const Integer & m, int e) {
   void * bufferNode = TreePool::sharedPool()->alloc(size);
-  DecimalNode * node = new (bufferNode) DecimalNode(m.digits(), m.numberOfDigits(), e, m.isNegative());
+  DecimalNode * node = new (bufferNode) DecimalNode(m.words(), m.numberOfWords(), e, m.isNegative());
   TreeHandle h = TreeHandle::BuildWithGhostChildren(node);
   return static_cast<Decimal &>(h);
 }
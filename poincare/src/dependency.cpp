@@ -47,6 +47,22 @@ template<typename T> Evaluation<T> DependencyNode::templatedApproximate(const Ap
   return childAtIndex(0)->approximate(static_cast<T>(1), approximationContext);
 }
 
+template<typename T> std::complex<T> DependencyNode::templatedApproximateToComplex(const ApproximationContext& approximationContext) const {
+  ExpressionNode * dependencies = childAtIndex(Dependency::k_indexOfDependenciesList);
+  if (dependencies->type() == Type::Undefined || dependencies->type() == Type::Nonreal) {
+    return std::complex<T>(NAN, NAN);
+  }
+  assert(dependencies->type() == ExpressionNode::Type::List);
+  int childrenNumber = dependencies->numberOfChildren();
+  for (int i = 0; i < childrenNumber; i++) {
+    std::complex<T> c = dependencies->childAtIndex(i)->approximateToComplex(static_cast<T>(1), approximationContext);
+    if (std::isnan(c.real()) || std::isnan(c.imag())) {
+      return std::complex<T>(NAN, NAN);
+    }
+  }
+  return childAtIndex(0)->approximateToComplex(static_cast<T>(1), approximationContext);
+}
+
 // Dependency
 
 void Dependency::deepReduceChildren(const ReductionContext& reductionContext) {
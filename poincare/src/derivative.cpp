@@ -1,4 +1,5 @@
 #include <poincare/derivative.h>
+#include <poincare/compiled_expression.h>
 #include <poincare/dependency.h>
 #include <poincare/derivative_layout.h>
 #include <poincare/float.h>
@@ -85,6 +86,20 @@ Evaluation<T> DerivativeNode::templatedApproximate(const ApproximationContext& a
   if (std::isnan(evaluationArgument)) {
     return Complex<T>::RealUndefined();
   }
+  if (order > 0) {
+    /* Derivatives of smooth functions are computed exactly in a single pass
+     * with automatic differentiation. Ridders' extrapolation is kept for the
+     * other functions and for singular points. */
+    static_assert(k_maxOrderForApproximation <= CompiledExpression::k_maxDerivativeOrder, "Derivatives cannot be differentiated automatically");
+    bool encounteredComplex = Expression::EncounteredComplex();
+    CompiledExpression compiledFunction;
+    T derivatives[k_maxOrderForApproximation + 1];
+    if (compiledFunction.compile(Expression(childAtIndex(0)), static_cast<const SymbolNode *>(childAtIndex(1))->name(), approximationContext.context(), approximationContext.complexFormat(), approximationContext.angleUnit())
+     && compiledFunction.approximateDerivatives(evaluationArgument, order, derivatives)) {
+      return Complex<T>::Builder(derivatives[order]);
+    }
+    Expression::SetEncounteredComplex(encounteredComplex);
+  }
   return Complex<T>::Builder(scalarApproximateWithValueForArgumentAndOrder<T>(evaluationArgument, order, approximationContext));
 }
 
@@ -55,29 +55,29 @@ Expression DivisionNode::shallowReduce(const ReductionContext& reductionContext)
   return Division(this).shallowReduce(reductionContext);
 }
 
-template<typename T> Complex<T> DivisionNode::computeOnComplex(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat) {
+template<typename T> std::complex<T> DivisionNode::computeOnComplex(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat) {
   constexpr T zero = static_cast<T>(0.0);
   if (d.real() == zero && d.imag() == zero) {
-    return Complex<T>::Undefined();
+    return std::complex<T>(NAN, NAN);
   }
   // Special case to prevent (inf,0)/(1,0) from returning (inf, nan).
   if (std::isinf(std::abs(c)) || std::isinf(std::abs(d))) {
     // Handle case of pure imaginary/real divisions
     if (c.imag() == zero && d.imag() == zero) {
-      return Complex<T>::Builder(c.real()/d.real(), zero);
+      return std::complex<T>(c.real()/d.real(), zero);
     }
     if (c.real() == zero && d.real() == zero) {
-      return Complex<T>::Builder(c.imag()/d.imag(), zero);
+      return std::complex<T>(c.imag()/d.imag(), zero);
     }
     if (c.imag() == zero && d.real() == zero) {
-      return Complex<T>::Builder(zero, -c.real()/d.imag());
+      return std::complex<T>(zero, -c.real()/d.imag());
     }
     if (c.real() == zero && d.imag() == zero) {
-      return Complex<T>::Builder(zero, c.imag()/d.real());
+      return std::complex<T>(zero, c.imag()/d.real());
     }
     // Other cases are left to the standard library, and might return NaN.
   }
-  return Complex<T>::Builder(c/d);
+  return std::complex<T>(c/d);
 }
 
 // Division
@@ -1,6 +1,7 @@
 #include <poincare/addition.h>
 #include <poincare/based_integer.h>
 #include <poincare/code_point_layout.h>
+#include <poincare/compiled_expression.h>
 #include <poincare/complex_cartesian.h>
 #include <poincare/constant.h>
 #include <poincare/decimal.h>
@@ -21,6 +22,7 @@
 #include <poincare/power.h>
 #include <poincare/rational.h>
 #include <poincare/real_part.h>
+#include <poincare/reduction_profiler.h>
 #include <poincare/solver.h>
 #include <poincare/store.h>
 #include <poincare/string_layout.h>
@@ -35,12 +37,16 @@
 #include <ion/unicode/utf8_helper.h>
 #include <cmath>
 #include <float.h>
+#include <string.h>
 #include <utility>
 
 namespace Poincare {
 
 static bool s_approximationEncounteredComplex = false;
+static bool s_approximationEncounteredNonScalar = false;
 static bool s_reductionEncounteredUndistributedList = false;
+// Negative when no reduction step budget applies
+static int s_remainingReductionSteps = -1;
 
 /* Constructor & Destructor */
 
@@ -69,6 +75,15 @@ Expression Expression::ExpressionFromAddress(const void * address, size_t size)
   return Expression(static_cast<ExpressionNode *>(TreePool::sharedPool()->copyTreeFromAddress(address, size)));
 }
 
+const ExpressionNode * Expression::ApproximableNodeAtAddress(const void * address, size_t size) {
+  // Nodes read in place must be aligned as they would be in the pool
+  if (address == nullptr || size == 0 || reinterpret_cast<uintptr_t>(address) % ByteAlignment != 0) {
+    return nullptr;
+  }
+  const ExpressionNode * node = static_cast<const ExpressionNode *>(address);
+  return node->canBeApproximatedOutOfPool() ? node : nullptr;
+}
+
 /* Hierarchy */
 
 Expression Expression::childAtIndex(int i) const {
@@ -712,6 +727,22 @@ void Expression::SetEncounteredComplex(bool encounterComplex) {
   s_approximationEncounteredComplex = encounterComplex;
 }
 
+int Expression::ReductionStepBudget() {
+  return s_remainingReductionSteps;
+}
+
+void Expression::SetReductionStepBudget(int budget) {
+  s_remainingReductionSteps = budget;
+}
+
+bool Expression::EncounteredNonScalar() {
+  return s_approximationEncounteredNonScalar;
+}
+
+void Expression::SetEncounteredNonScalar(bool encounterNonScalar) {
+  s_approximationEncounteredNonScalar = encounterNonScalar;
+}
+
 bool Expression::hasComplexI(Context * context, SymbolicComputation replaceSymbols) const {
   return !isUninitialized() && recursivelyMatches(
       [](const Expression e, Context * context) {
@@ -767,8 +798,9 @@ void Expression::SetReductionEncounteredUndistributedList(bool encounter) {
 
 bool Expression::isIdenticalTo(const Expression e) const {
   /* We use the simplification order only because it is a already-coded total
-   * order on expresssions. */
-  return ExpressionNode::SimplificationOrder(node(), e.node(), true) == 0;
+   * order on expresssions. Expressions of different hashes cannot be equal in
+   * this order. */
+  return node()->hash() == e.node()->hash() && ExpressionNode::SimplificationOrder(node(), e.node(), true) == 0;
 }
 
 bool Expression::isIdenticalToWithoutParentheses(const Expression e) const {
@@ -776,6 +808,24 @@ bool Expression::isIdenticalToWithoutParentheses(const Expression e) const {
   return ExpressionNode::SimplificationOrder(node(), e.node(), true, true) == 0;
 }
 
+bool Expression::isStrictlyIdenticalTo(const Expression e) const {
+  if (type() != e.type() || numberOfChildren() != e.numberOfChildren() || hash() != e.hash()) {
+    return false;
+  }
+  // Compare the attributes stored after the TreeNode members
+  size_t nodeSize = node()->size();
+  if (nodeSize != e.node()->size() || memcmp(reinterpret_cast<const char *>(node()) + sizeof(ExpressionNode), reinterpret_cast<const char *>(e.node()) + sizeof(ExpressionNode), nodeSize - sizeof(ExpressionNode)) != 0) {
+    return false;
+  }
+  int n = numberOfChildren();
+  for (int i = 0; i < n; i++) {
+    if (!childAtIndex(i).isStrictlyIdenticalTo(e.childAtIndex(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool Expression::containsSameDependency(const Expression e, const ReductionContext& reductionContext) const {
   if (isIdenticalToWithoutParentheses(e)) {
     return true;
@@ -1096,10 +1146,17 @@ Expression Expression::reduceAndRemoveUnit(const ReductionContext& reductionCont
 
 Expression Expression::cloneAndDeepReduceWithSystemCheckpoint(ReductionContext * reductionContext, bool * reduceFailure) const {
   /* We tried first with the supplied ReductionTarget. If the reduction failed
-   * without any user interruption (too many nodes were generated), we try again
-   * with ReductionTarget::SystemForApproximation. */
+   * without any user interruption (too many nodes were generated or too many
+   * reduction steps were taken), we try again with
+   * ReductionTarget::SystemForApproximation. */
   *reduceFailure = false;
+  /* Nested reductions share the budget of the outermost one, which resets it
+   * before each attempt. */
+  bool ownsReductionStepBudget = s_remainingReductionSteps < 0;
 #if __EMSCRIPTEN__
+  if (ownsReductionStepBudget) {
+    s_remainingReductionSteps = k_maxNumberOfReductionSteps;
+  }
   Expression e = clone().deepReduce(*reductionContext);
   {
     if (ExceptionCheckpoint::HasBeenInterrupted()) {
@@ -1108,6 +1165,9 @@ Expression Expression::cloneAndDeepReduceWithSystemCheckpoint(ReductionContext *
         goto failure;
       }
       reductionContext->setTarget(ReductionTarget::SystemForApproximation);
+      if (ownsReductionStepBudget) {
+        s_remainingReductionSteps = k_maxNumberOfReductionSteps;
+      }
       e = clone().deepReduce(*reductionContext);
       if (ExceptionCheckpoint::HasBeenInterrupted()) {
         ExceptionCheckpoint::ClearInterruption();
@@ -1116,11 +1176,17 @@ failure:
       }
     }
   }
+  if (ownsReductionStepBudget) {
+    s_remainingReductionSteps = -1;
+  }
 #else
   Expression e;
-  {
-    char * treePoolCursor = TreePool::sharedPool()->cursor();
+  char * treePoolCursor = TreePool::sharedPool()->cursor();
+  while (e.isUninitialized() && !*reduceFailure) {
     ExceptionCheckpoint ecp;
+    if (ownsReductionStepBudget) {
+      s_remainingReductionSteps = k_maxNumberOfReductionSteps;
+    }
     if (ExceptionRun(ecp)) {
       e = clone().deepReduce(*reductionContext);
     } else {
@@ -1132,12 +1198,14 @@ failure:
       if (reductionContext->target() != ReductionTarget::SystemForApproximation) {
         // System interruption, try again with another ReductionTarget
         reductionContext->setTarget(ReductionTarget::SystemForApproximation);
-        e = clone().deepReduce(*reductionContext);
       } else {
         *reduceFailure = true;
       }
     }
   }
+  if (ownsReductionStepBudget) {
+    s_remainingReductionSteps = -1;
+  }
 #endif
   if (*reduceFailure) {
     // Cloning outside of ecp's scope in case it raises an exception
@@ -1154,6 +1222,32 @@ Expression Expression::cloneAndReduce(ReductionContext reductionContext) const {
   return cloneAndDeepReduceWithSystemCheckpoint(&reductionContext, &reduceFailure);
 }
 
+Expression Expression::shallowReduce(ReductionContext reductionContext) {
+  if (s_remainingReductionSteps == 0) {
+#if POINCARE_REDUCTION_PROFILER
+    ReductionProfiler::ReductionStepBudgetWasExhausted();
+#endif
+    ExceptionCheckpoint::Raise();
+#if __EMSCRIPTEN__
+    // Raise did not jump: skip the step, the result will be discarded anyway.
+    return *this;
+#endif
+  } else if (s_remainingReductionSteps > 0) {
+    s_remainingReductionSteps--;
+  }
+#if POINCARE_REDUCTION_PROFILER
+  ReductionProfiler::Measure measure(node(), ReductionProfiler::Operation::ShallowReduce);
+#endif
+  return node()->shallowReduce(reductionContext);
+}
+
+Expression Expression::shallowBeautify(const ReductionContext& reductionContext) {
+#if POINCARE_REDUCTION_PROFILER
+  ReductionProfiler::Measure measure(node(), ReductionProfiler::Operation::ShallowBeautify);
+#endif
+  return node()->shallowBeautify(reductionContext);
+}
+
 Expression Expression::deepReduce(ReductionContext reductionContext) {
   /* WARNING: This condition is to prevent logarithm of being expanded and
    * create more complex expressions that either could not be integrated
@@ -1247,7 +1341,19 @@ template<typename U> Expression Expression::approximateKeepingUnits(const Reduct
 
 template<typename U>
 U Expression::approximateToScalar(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, bool withinReduce) const {
-  return approximateToEvaluation<U>(context, complexFormat, angleUnit, withinReduce).toScalar();
+  /* Try the scalar approximation first, which does not build any Evaluation
+   * in the pool, and only fall back on the Evaluation if a list, a matrix or
+   * a boolean was met on the way. */
+  s_approximationEncounteredComplex = false;
+  s_approximationEncounteredNonScalar = false;
+  std::complex<U> c = node()->approximateToComplex(U(), ApproximationContext(context, complexFormat, angleUnit, withinReduce));
+  if (s_approximationEncounteredNonScalar) {
+    return approximateToEvaluation<U>(context, complexFormat, angleUnit, withinReduce).toScalar();
+  }
+  if (complexFormat == Preferences::ComplexFormat::Real && s_approximationEncounteredComplex) {
+    return NAN;
+  }
+  return ComplexNode<U>::ToScalar(c);
 }
 
 template<typename U>
@@ -1265,6 +1371,18 @@ U Expression::approximateWithValueForSymbol(const char * symbol, U x, Context *
   return approximateToScalar<U>(&variableContext, complexFormat, angleUnit);
 }
 
+template<typename U>
+void Expression::approximateBatch(const char * symbol, const U * xs, U * ys, int n, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  CompiledExpression compiledExpression;
+  if (compiledExpression.compile(*this, symbol, context, complexFormat, angleUnit)) {
+    compiledExpression.approximateBatch<U>(xs, ys, n);
+    return;
+  }
+  for (int i = 0; i < n; i++) {
+    ys[i] = approximateWithValueForSymbol<U>(symbol, xs[i], context, complexFormat, angleUnit);
+  }
+}
+
 /* Builder */
 
 bool Expression::IsZero(const Expression e) {
@@ -1480,6 +1598,8 @@ template Evaluation<double> Expression::approximateToEvaluation(Context * contex
 
 template float Expression::approximateWithValueForSymbol(const char * symbol, float x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
 template double Expression::approximateWithValueForSymbol(const char * symbol, double x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+template void Expression::approximateBatch(const char * symbol, const float * xs, float * ys, int n, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+template void Expression::approximateBatch(const char * symbol, const double * xs, double * ys, int n, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
 
 template Expression Expression::approximateKeepingUnits<double>(const ReductionContext& reductionContext) const;
 }
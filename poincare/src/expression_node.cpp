@@ -17,6 +17,40 @@
 
 namespace Poincare {
 
+bool ExpressionNode::canBeApproximatedOutOfPool() const {
+  switch (type()) {
+  case Type::Undefined:
+  case Type::Nonreal:
+  case Type::Rational:
+  case Type::BasedInteger:
+  case Type::Decimal:
+  case Type::Double:
+  case Type::Float:
+  case Type::Infinity:
+  case Type::ConstantMaths:
+  case Type::ConstantPhysics:
+  case Type::Addition:
+  case Type::Subtraction:
+  case Type::Multiplication:
+  case Type::Division:
+  case Type::Opposite:
+  case Type::Power:
+  case Type::SquareRoot:
+  case Type::Parenthesis:
+  case Type::Matrix:
+  case Type::List:
+    break;
+  default:
+    return false;
+  }
+  for (ExpressionNode * c : children()) {
+    if (!c->canBeApproximatedOutOfPool()) {
+      return false;
+    }
+  }
+  return true;
+}
+
 Expression ExpressionNode::replaceSymbolWithExpression(const SymbolAbstract & symbol, const Expression & expression) {
   return Expression(this).defaultReplaceSymbolWithExpression(symbol, expression);
 }
@@ -98,6 +132,16 @@ int ExpressionNode::simplificationOrderSameType(const ExpressionNode * e, bool a
   return 0;
 }
 
+uint32_t ExpressionNode::computeHash() const {
+  /* The values of numbers are not hashed as they can be modified in place, and
+   * neither are the attributes of other nodes. */
+  uint32_t hash = CombineHash(static_cast<uint32_t>(type()), numberOfChildren());
+  for (ExpressionNode * c : children()) {
+    hash = CombineHash(hash, c->hash());
+  }
+  return hash;
+}
+
 Expression ExpressionNode::shallowReduce(const ReductionContext& reductionContext) {
   Expression e(this);
   ReductionContext alterableContext = reductionContext;
@@ -147,4 +191,17 @@ void ExpressionNode::setChildrenInPlace(Expression other) {
   Expression(this).defaultSetChildrenInPlace(other);
 }
 
+template<typename T>
+std::complex<T> ExpressionNode::defaultApproximateToComplex(const ApproximationContext& approximationContext) const {
+  Evaluation<T> evaluation = approximate(T(), approximationContext);
+  if (evaluation.type() != EvaluationNode<T>::Type::Complex) {
+    Expression::SetEncounteredNonScalar(true);
+    return std::complex<T>(NAN, NAN);
+  }
+  return evaluation.complexAtIndex(0);
+}
+
+template std::complex<float> ExpressionNode::defaultApproximateToComplex<float>(const ApproximationContext& approximationContext) const;
+template std::complex<double> ExpressionNode::defaultApproximateToComplex<double>(const ApproximationContext& approximationContext) const;
+
 }
@@ -57,7 +57,7 @@ Expression ExpressionNode::deepBeautify(const ReductionContext& reductionContext
   } else if (type() == Type::PercentAddition) {
     return Expression(this).convert<PercentAddition>().deepBeautify(reductionContext);
   } else {
-    Expression e = shallowBeautify(reductionContext);
+    Expression e = Expression(this).shallowBeautify(reductionContext);
     SimplificationHelper::deepBeautifyChildren(e, reductionContext);
     return e;
   }
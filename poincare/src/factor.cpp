@@ -41,9 +41,9 @@ Evaluation<T> FactorNode::templatedApproximate(const ApproximationContext& appro
       approximationContext,
       [] (const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
         if (std::isnan(ComplexNode<T>::ToScalar(c))) {
-          return Complex<T>::Undefined();
+          return std::complex<T>(NAN, NAN);
         }
-        return Complex<T>::Builder(c);
+        return c;
       });
 }
 
@@ -1,6 +1,7 @@
 #include <poincare/helpers.h>
 #include <poincare/list.h>
 #include <assert.h>
+#include <string.h>
 #include <cmath>
 
 namespace Poincare {
@@ -12,24 +13,25 @@ size_t Helpers::AlignedSize(size_t realSize, size_t alignment) {
   return result;
 }
 
-size_t Helpers::Gcd(size_t a, size_t b) {
-  int i = a;
-  int j = b;
-  do {
-    if (i == 0) {
-      return j;
-    }
-    if (j == 0) {
-      return i;
-    }
-    if (i > j) {
-      i = i - j*(i/j);
-    } else {
-      j = j - i*(j/i);
-    }
-  } while(true);
+double Helpers::PowerOfTen(int exponent) {
+  constexpr static int k_maxExponent = 22;
+  constexpr static double k_powersOfTen[2 * k_maxExponent + 1] = {
+    1e-22, 1e-21, 1e-20, 1e-19, 1e-18, 1e-17, 1e-16, 1e-15, 1e-14, 1e-13, 1e-12, 1e-11, 1e-10, 1e-9, 1e-8, 1e-7, 1e-6, 1e-5, 1e-4, 1e-3, 1e-2, 1e-1,
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+  };
+  if (exponent < -k_maxExponent || exponent > k_maxExponent) {
+    return std::pow(10.0, exponent);
+  }
+  return k_powersOfTen[exponent + k_maxExponent];
 }
 
+static void Reverse(uint32_t * start, uint32_t * end) {
+  while (start < --end) {
+    uint32_t tmp = *start;
+    *start++ = *end;
+    *end = tmp;
+  }
+}
 
 bool Helpers::Rotate(uint32_t * dst, uint32_t * src, size_t len) {
   /* This method "rotates" an array to insert data at src with length len at
@@ -50,59 +52,53 @@ bool Helpers::Rotate(uint32_t * dst, uint32_t * src, size_t len) {
     return false;
   }
 
-  /* We start with the first data to move at address a0 (we chose src but this
-   * does not matter), move it to its final address (a1 = a0 + len). We then
-   * move the data that was in a1 to its final address (a2) and so on, until we
-   * set the data at the starting address a0.
-   * This is a cycle of changes, and we have to make GCD(len, |dst-src]) such
-   * cycles, each starting at the previous cycle starting address + 1.
-   * This is a one-move per data algorithm, so it is O(dst - src) if dst > src,
-   * else O(src+len - dst). */
-
-  size_t numberOfCycles = Gcd(len, dst < src ? src - dst : dst - src);
-  size_t dstAddressOffset = dst < src ? len : dst - len - src;
-
-  // We need the limit addresses of the data that will change
-  uint32_t * insertionZoneStart = dst < src ? dst : src;
-  uint32_t * insertionZoneEnd = dst < src ? src + len - 1 : dst - 1;
-
-  uint32_t * cycleStartAddress;
-  uint32_t * moveSrcAddress;
-  uint32_t * moveDstAddress;
-  uint32_t tmpData;
-  uint32_t nextTmpData;
-
-  for (size_t i = 0; i < numberOfCycles; i++) {
-    // Set the cycle starting source
-    cycleStartAddress = src + i;
-    assert(cycleStartAddress <= insertionZoneEnd);
-    moveSrcAddress = cycleStartAddress;
-    // Set the cycle starting destination, dstAddressOffset after the source
-    moveDstAddress = moveSrcAddress + dstAddressOffset;
-    if (moveDstAddress > insertionZoneEnd) {
-      moveDstAddress = insertionZoneStart + (moveDstAddress - insertionZoneEnd - 1);
-    }
-    tmpData = *moveSrcAddress;
-    do {
-      nextTmpData = *moveDstAddress;
-      *moveDstAddress = tmpData;
-      tmpData = nextTmpData;
-      moveSrcAddress = moveDstAddress;
-      moveDstAddress = moveSrcAddress + dstAddressOffset;
-      if (moveDstAddress > insertionZoneEnd) {
-        moveDstAddress = insertionZoneStart + (moveDstAddress - insertionZoneEnd - 1);
-      }
-    } while (moveSrcAddress != cycleStartAddress);
+  /* The moved data is swapped with the block it jumps over, which amounts to
+   * rotating the zone spanning both blocks. The cycle-leader algorithm makes
+   * one move per data but jumps across the whole zone, which is slow on large
+   * zones. Instead, the smaller block is buffered on the stack when it is
+   * short, which is the case of most moved subtrees. The zone is otherwise
+   * rotated with three reversals. Both go through memory sequentially. */
+
+  uint32_t * zoneStart = dst < src ? dst : src;
+  uint32_t * secondBlockStart = dst < src ? src : src + len;
+  uint32_t * zoneEnd = dst < src ? src + len : dst;
+  size_t firstBlockLength = secondBlockStart - zoneStart;
+  size_t secondBlockLength = zoneEnd - secondBlockStart;
+
+  constexpr size_t k_bufferLength = 64;
+  uint32_t buffer[k_bufferLength];
+  if (firstBlockLength <= k_bufferLength) {
+    memcpy(buffer, zoneStart, firstBlockLength * sizeof(uint32_t));
+    memmove(zoneStart, secondBlockStart, secondBlockLength * sizeof(uint32_t));
+    memcpy(zoneStart + secondBlockLength, buffer, firstBlockLength * sizeof(uint32_t));
+  } else if (secondBlockLength <= k_bufferLength) {
+    memcpy(buffer, secondBlockStart, secondBlockLength * sizeof(uint32_t));
+    memmove(zoneStart + secondBlockLength, zoneStart, firstBlockLength * sizeof(uint32_t));
+    memcpy(zoneStart, buffer, secondBlockLength * sizeof(uint32_t));
+  } else {
+    Reverse(zoneStart, secondBlockStart);
+    Reverse(secondBlockStart, zoneEnd);
+    Reverse(zoneStart, zoneEnd);
   }
   return true;
 }
 
-void Helpers::Sort(Swap swap, Compare compare, void * context, int numberOfElements) {
-  /* Using an insertion-sort algorithm, which has the advantage of being
-   * in-place and efficient when already sorted. It is optimal if Compare is
-   * more lenient with equalities ( >= instead of > ) */
-  for (int i = 1; i < numberOfElements; i++) {
-    for (int j = i - 1; j >= 0; j--) {
+/* The sort only reorders elements through Swap and Compare, since they may be
+ * children of a pool node. It is a bottom-up merge sort, whose runs are merged
+ * in place with rotations (SymMerge, Kim & Kutzner), so that it needs no
+ * buffer. It uses O(n*log(n)) comparisons and O(n*log(n)^2) swaps.
+ *
+ * compare(i, j) is only called with i placed after j in the input. When it
+ * returns false, i is moved before j. This is what insertion sort does, so
+ * that elements Compare deems equal keep their relative order if Compare is
+ * lenient with equalities ( >= instead of > ) and are reversed otherwise. */
+
+// Length of the runs sorted by insertion before being merged
+constexpr static int k_insertionSortRunLength = 16;
+
+static void InsertionSort(Helpers::Swap swap, Helpers::Compare compare, void * context, int numberOfElements, int start, int end) {
+  for (int i = start + 1; i < end; i++) {
+    for (int j = i - 1; j >= start; j--) {
       if (compare(j+1, j, context, numberOfElements)) {
         break;
       }
@@ -111,6 +107,121 @@ void Helpers::Sort(Swap swap, Compare compare, void * context, int numberOfEleme
   }
 }
 
+static void SwapRanges(Helpers::Swap swap, void * context, int numberOfElements, int a, int b, int length) {
+  for (int i = 0; i < length; i++) {
+    swap(a + i, b + i, context, numberOfElements);
+  }
+}
+
+// Exchange the blocks [a, m) and [m, b)
+static void RotateRanges(Helpers::Swap swap, void * context, int numberOfElements, int a, int m, int b) {
+  int i = m - a;
+  int j = b - m;
+  while (i != j) {
+    if (i > j) {
+      SwapRanges(swap, context, numberOfElements, m - i, m, j);
+      i -= j;
+    } else {
+      SwapRanges(swap, context, numberOfElements, m - i, m + j - i, i);
+      j -= i;
+    }
+  }
+  SwapRanges(swap, context, numberOfElements, m - i, m, i);
+}
+
+// Merge the sorted runs [a, m) and [m, b)
+static void MergeInPlace(Helpers::Swap swap, Helpers::Compare compare, void * context, int numberOfElements, int a, int m, int b) {
+  if (m - a == 1) {
+    // Insert a in [m, b) after the elements it must not precede
+    int i = m;
+    int j = b;
+    while (i < j) {
+      int h = (i + j) / 2;
+      if (!compare(h, a, context, numberOfElements)) {
+        i = h + 1;
+      } else {
+        j = h;
+      }
+    }
+    for (int k = a; k < i - 1; k++) {
+      swap(k, k+1, context, numberOfElements);
+    }
+    return;
+  }
+  if (b - m == 1) {
+    // Insert m in [a, m) before the first element it must precede
+    int i = a;
+    int j = m;
+    while (i < j) {
+      int h = (i + j) / 2;
+      if (compare(m, h, context, numberOfElements)) {
+        i = h + 1;
+      } else {
+        j = h;
+      }
+    }
+    for (int k = m; k > i; k--) {
+      swap(k, k-1, context, numberOfElements);
+    }
+    return;
+  }
+  int mid = (a + b) / 2;
+  int n = mid + m;
+  int start, r;
+  if (m > mid) {
+    start = n - b;
+    r = mid;
+  } else {
+    start = a;
+    r = m;
+  }
+  int p = n - 1;
+  while (start < r) {
+    int c = (start + r) / 2;
+    if (compare(p - c, c, context, numberOfElements)) {
+      start = c + 1;
+    } else {
+      r = c;
+    }
+  }
+  int end = n - start;
+  if (start < m && m < end) {
+    RotateRanges(swap, context, numberOfElements, start, m, end);
+  }
+  if (a < start && start < mid) {
+    MergeInPlace(swap, compare, context, numberOfElements, a, start, mid);
+  }
+  if (mid < end && end < b) {
+    MergeInPlace(swap, compare, context, numberOfElements, mid, end, b);
+  }
+}
+
+void Helpers::Sort(Swap swap, Compare compare, void * context, int numberOfElements) {
+  // Already sorted inputs only cost a linear scan
+  int firstUnsortedIndex = 1;
+  while (firstUnsortedIndex < numberOfElements && compare(firstUnsortedIndex, firstUnsortedIndex - 1, context, numberOfElements)) {
+    firstUnsortedIndex++;
+  }
+  if (firstUnsortedIndex >= numberOfElements) {
+    return;
+  }
+  for (int start = 0; start < numberOfElements; start += k_insertionSortRunLength) {
+    int end = start + k_insertionSortRunLength;
+    InsertionSort(swap, compare, context, numberOfElements, start, end < numberOfElements ? end : numberOfElements);
+  }
+  for (int runLength = k_insertionSortRunLength; runLength < numberOfElements; runLength *= 2) {
+    for (int start = 0; start + runLength < numberOfElements; start += 2 * runLength) {
+      int end = start + 2 * runLength;
+      int middle = start + runLength;
+      if (compare(middle, middle - 1, context, numberOfElements)) {
+        // The runs are already in order
+        continue;
+      }
+      MergeInPlace(swap, compare, context, numberOfElements, start, middle, end < numberOfElements ? end : numberOfElements);
+    }
+  }
+}
+
 bool Helpers::FloatIsGreater(float xI, float xJ, bool nanIsGreatest) {
   if (std::isnan(xI)) {
     return nanIsGreatest;
@@ -15,10 +15,10 @@ int HyperbolicCosineNode::serialize(char * buffer, int bufferSize, Preferences::
 }
 
 template<typename T>
-Complex<T> HyperbolicCosineNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
+std::complex<T> HyperbolicCosineNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
   /* If c is real and large (over 100.0), the float evaluation of std::cosh
    * will return image = NaN when it should be 0.0. */
-  return Complex<T>::Builder(ApproximationHelper::MakeResultRealIfInputIsReal<T>(ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(std::cosh(c), c), c));
+  return std::complex<T>(ApproximationHelper::MakeResultRealIfInputIsReal<T>(ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(std::cosh(c), c), c));
 }
 
 bool HyperbolicCosineNode::derivate(const ReductionContext& reductionContext, Symbol symbol, Expression symbolValue) {
@@ -39,7 +39,7 @@ Expression HyperbolicCosine::unaryFunctionDifferential(const ReductionContext& r
   return HyperbolicSine::Builder(childAtIndex(0).clone());
 }
 
-template Complex<float> Poincare::HyperbolicCosineNode::computeOnComplex<float>(std::complex<float>, Preferences::ComplexFormat, Preferences::AngleUnit);
-template Complex<double> Poincare::HyperbolicCosineNode::computeOnComplex<double>(std::complex<double>, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit);
+template std::complex<float> Poincare::HyperbolicCosineNode::computeOnComplex<float>(std::complex<float>, Preferences::ComplexFormat, Preferences::AngleUnit);
+template std::complex<double> Poincare::HyperbolicCosineNode::computeOnComplex<double>(std::complex<double>, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit);
 
 }
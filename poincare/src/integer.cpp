@@ -34,7 +34,7 @@ namespace Poincare {
  * buffer). */
 // TODO: we might want to go back to allocating the native_uint_t arrays on the stack once we increase the stack size from 32k to?
 
-static native_uint_t s_workingBuffer[Integer::k_maxNumberOfDigits + 1];
+static native_uint_t s_workingBuffer[Integer::k_maxNumberOfDigits + 2];
 static native_uint_t s_workingBufferDivision[Integer::k_maxNumberOfDigits + 1];
 
 static inline int8_t sign(bool negative) {
@@ -72,7 +72,7 @@ void IntegerNode::log(std::ostream & stream) const {
   double base = 1.0;
   for (int i = 0; i < m_numberOfDigits; i++) {
     d += m_digits[i]*base;
-    base *= std::pow(2.0,32.0);
+    base *= std::pow(2.0, Integer::k_numberOfBitsInDigit);
   }
   stream << d;
 }
@@ -95,6 +95,36 @@ Integer Integer::BuildInteger(native_uint_t * digits, uint16_t numberOfDigits, b
   return Integer(digits, numberOfDigits, negative);
 }
 
+Integer Integer::BuildIntegerFromWords(const uint32_t * words, uint8_t numberOfWords, bool negative) {
+  if (numberOfWords > k_maxNumberOfWords) {
+    return Overflow(negative);
+  }
+  if (sizeof(native_uint_t) == sizeof(uint32_t)) {
+    return BuildInteger(reinterpret_cast<native_uint_t *>(const_cast<uint32_t *>(words)), numberOfWords, negative);
+  }
+  // Words are only 4-byte aligned and the last digit may be half-filled
+  native_uint_t digits[k_maxNumberOfDigits];
+  uint8_t numberOfDigits = (numberOfWords * sizeof(uint32_t) + sizeof(native_uint_t) - 1) / sizeof(native_uint_t);
+  if (numberOfDigits > 0) {
+    digits[numberOfDigits - 1] = 0;
+  }
+  memcpy(digits, words, numberOfWords * sizeof(uint32_t));
+  return BuildInteger(digits, numberOfDigits, negative);
+}
+
+uint8_t Integer::numberOfWords() const {
+  if (isOverflow()) {
+    return k_maxNumberOfWords + 1;
+  }
+  uint8_t numberOfWords = numberOfDigits() * sizeof(native_uint_t) / sizeof(uint32_t);
+  const uint32_t * w = words();
+  // The last digit may only use its lower words
+  while (numberOfWords > 0 && w[numberOfWords - 1] == 0) {
+    numberOfWords--;
+  }
+  return numberOfWords;
+}
+
 // Private constructor
 
 Integer::Integer(native_uint_t * digits, uint16_t numberOfDigits, bool negative) {
@@ -113,15 +143,16 @@ Integer::Integer(native_int_t i) : TreeHandle(TreeNode::NoNodeIdentifier) {
 }
 
 Integer::Integer(double_native_int_t i) {
-  double_native_uint_t j = i < 0 ? -i : i;
-  native_uint_t * d = (native_uint_t *)&j;
-  native_uint_t leastSignificantDigit = *d;
-  native_uint_t mostSignificantDigit = *(d+1);
-  uint8_t numberOfDigits = (mostSignificantDigit == 0) ? 1 : 2;
+  uint64_t j = i < 0 ? -static_cast<uint64_t>(i) : i;
+  native_uint_t d[2] = {static_cast<native_uint_t>(j), 0};
+  if (sizeof(native_uint_t) < sizeof(uint64_t)) {
+    d[1] = static_cast<native_uint_t>(j >> (k_numberOfBitsInDigit % 64));
+  }
+  uint8_t numberOfDigits = (d[1] == 0) ? 1 : 2;
   if (numberOfDigits == 1) {
     m_identifier = TreeNode::NoNodeIdentifier;
     m_negative = i < 0;
-    m_digit = leastSignificantDigit;
+    m_digit = d[0];
   } else {
     new (this) Integer(d, 2, i < 0);
   }
@@ -214,16 +245,19 @@ int Integer::serializeInBinaryBase(char * buffer, int bufferSize, char symbol, O
   buffer[currentChar++] = '0';
   buffer[currentChar++] = symbol;
 
-  int nbOfDigits = numberOfDigits();
   // Special case for 0
-  if (nbOfDigits == 0) {
+  if (numberOfDigits() == 0) {
     buffer[currentChar++] = '0';
     buffer[currentChar] = 0;
     return currentChar;
   }
 
+  // Print the words so that the output does not depend on the size of digits
+  const uint32_t * words = this->words();
+  int nbOfWords = numberOfWords();
+
   // Compute the required bufferSize to print the integer
-  int requiredBufferSize = OMG::Print::MaxLengthOfUInt32(base) * (nbOfDigits - 1) + OMG::Print::LengthOfUInt32(base, digit(nbOfDigits - 1));
+  int requiredBufferSize = OMG::Print::MaxLengthOfUInt32(base) * (nbOfWords - 1) + OMG::Print::LengthOfUInt32(base, words[nbOfWords - 1]);
   // Don't forget 0x prefix and the null termination
   requiredBufferSize += 3;
   if (requiredBufferSize > bufferSize) {
@@ -231,12 +265,12 @@ int Integer::serializeInBinaryBase(char * buffer, int bufferSize, char symbol, O
   }
 
   buffer[requiredBufferSize - 1] = 0;
-  for (int i = nbOfDigits - 1; i >= 0; i--) {
+  for (int i = nbOfWords - 1; i >= 0; i--) {
     currentChar +=
       OMG::Print::UInt32(
         base,
-        digit(i),
-        i == nbOfDigits - 1 ? OMG::Print::LeadingZeros::Trim : OMG::Print::LeadingZeros::Keep,
+        words[i],
+        i == nbOfWords - 1 ? OMG::Print::LeadingZeros::Trim : OMG::Print::LeadingZeros::Keep,
         buffer + currentChar,
         bufferSize - currentChar
       );
@@ -292,28 +326,25 @@ T Integer::approximate() const {
   uint16_t exponent = IEEE754<T>::exponentOffset();
   /* Escape case if the exponent is too big to be stored */
   assert(numberOfDigits() > 0);
-  if (((int)numberOfDigits()-1)*32+numberOfBitsInLastDigit-1> IEEE754<T>::maxExponent()-IEEE754<T>::exponentOffset()) {
+  if (((int)numberOfDigits()-1)*k_numberOfBitsInDigit+numberOfBitsInLastDigit-1> IEEE754<T>::maxExponent()-IEEE754<T>::exponentOffset()) {
     return  m_negative ? -INFINITY : INFINITY;
   }
-  exponent += (numberOfDigits()-1)*32;
+  exponent += (numberOfDigits()-1)*k_numberOfBitsInDigit;
   exponent += numberOfBitsInLastDigit-1;
 
   uint64_t mantissa = 0;
-  /* Shift the most significant int to the left of the mantissa. The most
-   * significant 1 will be ignore at the end when inserting the mantissa in
-   * the resulting uint64_t (as required by IEEE754). */
-  assert(IEEE754<T>::size()-numberOfBitsInLastDigit >= 0 && IEEE754<T>::size()-numberOfBitsInLastDigit < 64); // Shift operator behavior is undefined if the right operand is negative, or greater than or equal to the length in bits of the promoted left operand
-  mantissa |= ((uint64_t)lastDigit << (IEEE754<T>::size()-numberOfBitsInLastDigit));
-  uint8_t digitIndex = 2;
-  int numberOfBits = numberOfBitsInLastDigit;
-  /* Complete the mantissa by inserting, from left to right, every digit of the
-   * Integer from the most significant one to the last from. We break when
-   * the mantissa is complete to avoid undefined right shifting (Shift operator
+  uint8_t digitIndex = 1;
+  int numberOfBits = numberOfBitsInLastDigit - k_numberOfBitsInDigit;
+  /* Fill the mantissa by inserting, from left to right, every digit of the
+   * Integer from the most significant one to the last from. The most
+   * significant 1 will be ignored at the end when inserting the mantissa in
+   * the resulting uint64_t (as required by IEEE754). We break when the
+   * mantissa is complete to avoid undefined right shifting (Shift operator
    * behavior is undefined if the right operand is negative, or greater than or
    * equal to the length in bits of the promoted left operand). */
   while (numberOfDigits() >= digitIndex && numberOfBits < IEEE754<T>::size()) {
     lastDigit = digit(numberOfDigits()-digitIndex);
-    numberOfBits += 32;
+    numberOfBits += k_numberOfBitsInDigit;
     if (IEEE754<T>::size() > numberOfBits) {
       assert(IEEE754<T>::size()-numberOfBits > 0 && IEEE754<T>::size()-numberOfBits < 64);
       mantissa |= ((uint64_t)lastDigit << (IEEE754<T>::size()-numberOfBits));
@@ -385,14 +416,13 @@ Integer Integer::Power(const Integer & i, const Integer & j) {
   if (j.isOverflow() || i.isOverflow()) {
     return Overflow(false);
   }
-  // Exponentiate by squaring : i^j = (i*i)^(j/2) * i^(j%2)
+  /* Exponentiate by squaring : i^j = (i*i)^(j/2) * i^(j%2)
+   * The bits of j are read from its digits instead of dividing it by 2. */
   Integer i1(1);
   Integer i2(i);
-  Integer exp(j);
-  while (!exp.isOne()) {
-    IntegerDivision ud = udiv(exp, Integer(2));
-    exp = ud.quotient;
-    if (ud.remainder.isOne()) {
+  int numberOfBits = (j.numberOfDigits() - 1) * k_numberOfBitsInDigit + OMG::BitHelper::log2(j.digit(j.numberOfDigits() - 1));
+  for (int bit = 0; bit < numberOfBits - 1; bit++) {
+    if ((j.digit(bit / k_numberOfBitsInDigit) >> (bit % k_numberOfBitsInDigit)) & 1) {
       i1 = Multiplication(i1, i2);
     }
     i2 = Multiplication(i2, i2);
@@ -442,45 +472,46 @@ Integer Integer::multiplication(const Integer & a, const Integer & b, bool oneDi
   if (a.isOverflow() || b.isOverflow()) {
     return Integer::Overflow(a.m_negative != b.m_negative);
   }
+  if (a.isZero() || b.isZero()) {
+    return Integer(0);
+  }
+  uint8_t aSize = a.numberOfDigits();
+  uint8_t bSize = b.numberOfDigits();
+  int size = aSize + bSize;
+  /* The product is at least beta^(size-2) since the most significant digits of
+   * a and b are not null. */
+  if (size - 2 >= k_maxNumberOfDigits + oneDigitOverflow) {
+    // Overflow the largest Integer
+    return Integer::Overflow(a.m_negative != b.m_negative);
+  }
+  static_assert(sizeof(s_workingBuffer) >= (k_maxNumberOfDigits + 2)*sizeof(native_uint_t), "The working buffer cannot contain the largest products");
 
-  uint8_t size = std::min(a.numberOfDigits() + b.numberOfDigits(), k_maxNumberOfDigits + oneDigitOverflow); // Enable overflowing of 1 digit
-
+  /* Read the digits through pointers rather than digit(i), which resolves the
+   * node of the Integer at each call. */
+  const native_uint_t * aDigits = a.digits();
+  const native_uint_t * bDigits = b.digits();
   memset(s_workingBuffer, 0, size*sizeof(native_uint_t));
-
-  double_native_uint_t carry = 0;
-  for (uint8_t i = 0; i < a.numberOfDigits(); i++) {
-    double_native_uint_t aDigit = a.digit(i);
-    carry = 0;
-    for (uint8_t j = 0; j < b.numberOfDigits(); j++) {
-      double_native_uint_t bDigit = b.digit(j);
-      /* The fact that aDigit and bDigit are double_native is very important,
-       * otherwise the product might end up being computed on single_native size
-       * and then zero-padded. */
-      double_native_uint_t p = aDigit*bDigit + carry; // TODO: Prove it cannot overflow double_native type
-      native_uint_t * l = (native_uint_t *)&p;
-      if (i+j < (uint8_t) k_maxNumberOfDigits+oneDigitOverflow) {
-        p += s_workingBuffer[i+j];
-        s_workingBuffer[i+j] = l[0];
-      } else {
-        if (l[0] != 0) {
-          // Overflow the largest Integer
-          return Integer::Overflow(a.m_negative != b.m_negative);
-        }
-      }
-      carry = l[1];
-    }
-    if (i+b.numberOfDigits() < (uint8_t) k_maxNumberOfDigits+oneDigitOverflow) {
-      s_workingBuffer[i+b.numberOfDigits()] += carry;
-    } else {
-      if (carry != 0) {
-        // Overflow the largest Integer
-        return Integer::Overflow(a.m_negative != b.m_negative);
-      }
+  for (uint8_t i = 0; i < aSize; i++) {
+    double_native_uint_t aDigit = aDigits[i];
+    native_uint_t carry = 0;
+    for (uint8_t j = 0; j < bSize; j++) {
+      /* The fact that aDigit is double_native is very important, otherwise the
+       * product might end up being computed on single_native size and then
+       * zero-padded. It cannot overflow since
+       * (beta-1)*(beta-1)+2*(beta-1) = beta^2-1 */
+      double_native_uint_t p = aDigit*bDigits[j] + carry + s_workingBuffer[i+j];
+      s_workingBuffer[i+j] = static_cast<native_uint_t>(p);
+      carry = p >> k_numberOfBitsInDigit;
     }
+    s_workingBuffer[i+bSize] = carry;
   }
-  while (size>0 && s_workingBuffer[size-1] == 0) {
+  while (size > 0 && s_workingBuffer[size-1] == 0) {
     size--;
   }
+  if (size > k_maxNumberOfDigits + oneDigitOverflow) {
+    // Overflow the largest Integer
+    return Integer::Overflow(a.m_negative != b.m_negative);
+  }
   return BuildInteger(s_workingBuffer, size, a.m_negative != b.m_negative, oneDigitOverflow);
 }
 
@@ -545,27 +576,27 @@ Integer Integer::usum(const Integer & a, const Integer & b, bool subtract, bool
 }
 
 Integer Integer::multiplyByPowerOf2(uint8_t pow) const {
-  assert(pow < 32);
+  assert(pow < k_numberOfBitsInDigit);
   native_uint_t carry = 0;
   for (uint8_t i = 0; i < numberOfDigits(); i++) {
     s_workingBuffer[i] = digit(i) << pow | carry;
-    carry = pow == 0 ? 0 : digit(i) >> (32-pow);
+    carry = pow == 0 ? 0 : digit(i) >> (k_numberOfBitsInDigit-pow);
   }
   s_workingBuffer[numberOfDigits()] = carry;
   return BuildInteger(s_workingBuffer, carry ? numberOfDigits() + 1 : numberOfDigits(), false, true);
 }
 
 Integer Integer::divideByPowerOf2(uint8_t pow) const {
-  assert(pow < 32);
+  assert(pow < k_numberOfBitsInDigit);
   native_uint_t carry = 0;
   for (int i = numberOfDigits() - 1; i >= 0; i--) {
     s_workingBuffer[i] = digit(i) >> pow | carry;
-    carry = pow == 0 ? 0 : digit(i) << (32-pow);
+    carry = pow == 0 ? 0 : digit(i) << (k_numberOfBitsInDigit-pow);
   }
   return BuildInteger(s_workingBuffer, s_workingBuffer[numberOfDigits()-1] > 0 ? numberOfDigits() : numberOfDigits()-1, false, true);
 }
 
-// return this*(2^16)^pow
+// return this*(2^k_numberOfBitsInHalfDigit)^pow
 Integer Integer::multiplyByPowerOfBase(uint8_t pow) const {
   int nbOfHalfDigits = numberOfHalfDigits();
   half_native_uint_t * digits = reinterpret_cast<half_native_uint_t *>(s_workingBuffer);
@@ -594,12 +625,29 @@ IntegerDivision Integer::udiv(const Integer & numerator, const Integer & denomin
     IntegerDivision div = {.quotient = Integer(0), .remainder = Integer(numerator)};
     return div;
   }
-  /* Let's call beta = 1 << 16 */
+  if (denominator.numberOfDigits() == 1) {
+    // Divide by a single digit from the most significant digit of numerator
+    native_uint_t d = denominator.digit(0);
+    const native_uint_t * numeratorDigits = numerator.digits();
+    int qNumberOfDigits = numerator.numberOfDigits();
+    double_native_uint_t r = 0;
+    for (int i = qNumberOfDigits - 1; i >= 0; i--) {
+      double_native_uint_t current = (r << k_numberOfBitsInDigit) | numeratorDigits[i];
+      s_workingBufferDivision[i] = static_cast<native_uint_t>(current / d);
+      r = current % d;
+    }
+    while (s_workingBufferDivision[qNumberOfDigits-1] == 0) {
+      qNumberOfDigits--;
+    }
+    native_uint_t remainder = static_cast<native_uint_t>(r);
+    return {.quotient = BuildInteger(s_workingBufferDivision, qNumberOfDigits, false), .remainder = BuildInteger(&remainder, remainder == 0 ? 0 : 1, false)};
+  }
+  /* Let's call beta = 1 << k_numberOfBitsInHalfDigit */
   /* Normalize numerator & denominator:
    * Find A = 2^k*numerator & B = 2^k*denominator such as B > beta/2
    * if A = B*Q+R (R < B) then numerator = denominator*Q + R/2^k. */
   half_native_uint_t b = denominator.halfDigit(denominator.numberOfHalfDigits()-1);
-  half_native_uint_t halfBase = 1 << (16-1);
+  half_native_uint_t halfBase = static_cast<half_native_uint_t>(1) << (k_numberOfBitsInHalfDigit-1);
   int pow = 0;
   assert(b != 0);
   while (!(b & halfBase)) {
@@ -623,14 +671,14 @@ IntegerDivision Integer::udiv(const Integer & numerator, const Integer & denomin
     qDigits[m] = 1; // q[m] = 1
     A = usum(A, betaMB, true, true); // A-B*beta^m
   }
-  native_int_t base = 1 << 16;
+  native_uint_t base = static_cast<native_uint_t>(1) << k_numberOfBitsInHalfDigit;
   for (int j = m-1; j >= 0; j--) {
     half_native_uint_t bnMinus1 = (native_uint_t)B.halfDigit(n-1);
     assert(bnMinus1 != 0);
     native_uint_t qj2 = ((native_uint_t)A.halfDigit(n+j)*base+(native_uint_t)A.halfDigit(n+j-1))/bnMinus1; // (a[n+j]*beta+a[n+j-1])/b[n-1]
-    half_native_uint_t baseMinus1 = (1 << 16) -1; // beta-1
+    half_native_uint_t baseMinus1 = base - 1; // beta-1
     qDigits[j] = qj2 < (native_uint_t)baseMinus1 ? (half_native_uint_t)qj2 : baseMinus1; // std::min(qj2, beta -1)
-    A = Integer::addition(A, multiplication(qDigits[j], B.multiplyByPowerOfBase(j), true), true, true); // A-q[j]*beta^j*B
+    A = Integer::addition(A, multiplication(Integer(static_cast<double_native_int_t>(qDigits[j])), B.multiplyByPowerOfBase(j), true), true, true); // A-q[j]*beta^j*B
     if (A.isNegative()) {
       Integer betaJM = B.multiplyByPowerOfBase(j); // betaJM = B*beta^j
       while (A.isNegative()) {
@@ -643,8 +691,8 @@ IntegerDivision Integer::udiv(const Integer & numerator, const Integer & denomin
   while (qDigits[qNumberOfDigits-1] == 0 && qNumberOfDigits > 1) {
     qNumberOfDigits--;
   }
-  int qNumberOfDigitsInBase32 = qNumberOfDigits%2 == 1 ? qNumberOfDigits/2+1 : qNumberOfDigits/2;
-  IntegerDivision div = {.quotient = BuildInteger((native_uint_t *)qDigits, qNumberOfDigitsInBase32, false), .remainder = A};
+  int qNumberOfNativeDigits = qNumberOfDigits%2 == 1 ? qNumberOfDigits/2+1 : qNumberOfDigits/2;
+  IntegerDivision div = {.quotient = BuildInteger((native_uint_t *)qDigits, qNumberOfNativeDigits, false), .remainder = A};
   if (pow > 0 && !div.remainder.isZero()) {
     div.remainder = div.remainder.divideByPowerOf2(pow);
   }
@@ -1,5 +1,7 @@
 #include <poincare/integral.h>
+#include <poincare/compiled_expression.h>
 #include <poincare/complex.h>
+#include <poincare/float.h>
 #include <poincare/integral_layout.h>
 #include <poincare/serialization_helper.h>
 #include <poincare/simplification_helper.h>
@@ -12,6 +14,7 @@
 #include <algorithm>
 #include <cmath>
 #include <float.h>
+#include <string.h>
 #include <stdlib.h>
 
 namespace Poincare {
@@ -59,8 +62,20 @@ Evaluation<T> IntegralNode::templatedApproximate(const ApproximationContext& app
   if (std::isnan(a) || std::isnan(b)) {
     return Complex<T>::RealUndefined();
   }
-  bool fIsNanInA = std::isnan(firstChildScalarValueForArgument(a, approximationContext));
-  bool fIsNanInB = std::isnan(firstChildScalarValueForArgument(b, approximationContext));
+  /* The quadratures evaluate the integrand hundreds of times: evaluate its
+   * compiled form when possible. */
+  CompiledExpression compiledExpression;
+  const char * parameterName = static_cast<const SymbolNode *>(childAtIndex(1))->name();
+  bool isCompiled = compiledExpression.compile(Expression(childAtIndex(0)), parameterName, approximationContext.context(), approximationContext.complexFormat(), approximationContext.angleUnit());
+  const CompiledExpression * compiledIntegrand = isCompiled ? &compiledExpression : nullptr;
+  return Complex<T>::Builder(approximateBetweenBounds(a, b, Expression(childAtIndex(2)), Expression(childAtIndex(3)), compiledIntegrand, approximationContext));
+}
+
+template<typename T>
+T IntegralNode::approximateBetweenBounds(T a, T b, Expression lowerBound, Expression upperBound, const CompiledExpression * compiledIntegrand, const ApproximationContext& approximationContext) const {
+  assert(!std::isnan(a) && !std::isnan(b));
+  bool fIsNanInA = std::isnan(integrandValue(a, compiledIntegrand, approximationContext));
+  bool fIsNanInB = std::isnan(integrandValue(b, compiledIntegrand, approximationContext));
   // The integrand has a singularity on a bound of the interval, use tanh-sinh quadrature
   if (fIsNanInA || fIsNanInB) {
     /* When we have a singularity at a bound, we want to evaluate the integrand
@@ -77,21 +92,21 @@ Evaluation<T> IntegralNode::templatedApproximate(const ApproximationContext& app
     const ReductionContext reductionContext(approximationContext.context(), approximationContext.complexFormat(), approximationContext.angleUnit(), Preferences::UnitFormat::Metric, ReductionTarget::SystemForAnalysis);
     /* Rewrite the integrand to be able to compute it directly at abscissa a + x */
     if (fIsNanInA && a != 0) {
-      alternativeIntegrand.integrandNearA = rewriteIntegrandNear(childAtIndex(2), reductionContext);
+      alternativeIntegrand.integrandNearA = rewriteIntegrandNear(lowerBound, reductionContext);
     }
     // Same near b - x
     if (fIsNanInB && b != 0) {
-      alternativeIntegrand.integrandNearB = rewriteIntegrandNear(childAtIndex(3), reductionContext);
+      alternativeIntegrand.integrandNearB = rewriteIntegrandNear(upperBound, reductionContext);
     }
     /* We are using 4 levels of refinement which means ≈ 64 integrand evaluations
      * = 2 (R- and R+) * 2^4 (ticks/unit) * 4 (typical decay on the examples)
      * It could be increased but precision is likely lost somewhere else in
      * hard examples. */
-    DetailedResult<T> detailedResult = tanhSinhQuadrature<T>(4, alternativeIntegrand, approximationContext);
+    DetailedResult<T> detailedResult = tanhSinhQuadrature<T>(4, alternativeIntegrand, compiledIntegrand, approximationContext);
     // Arbitrary value to have the best choice of quadrature on the examples
     constexpr T insufficientPrecision = 0.001;
     if (!std::isnan(detailedResult.integral) && detailedResult.absoluteError < insufficientPrecision) {
-      return Complex<T>::Builder(detailedResult.integral);
+      return detailedResult.integral;
     }
   }
   /* Choose the right substitution to use in Gauss-Konrod.
@@ -134,28 +149,73 @@ Evaluation<T> IntegralNode::templatedApproximate(const ApproximationContext& app
   /* The tolerance sqrt(eps) estimated by the method is an upper bound and the
    * real is error is typically eps */
   constexpr T precision = Float<T>::SqrtEpsilonLax();
-  DetailedResult<T> detailedResult = adaptiveQuadrature<T>(start, end, precision, k_maxNumberOfIterations, substitution, approximationContext);
+  DetailedResult<T> detailedResult = adaptiveQuadrature<T>(start, end, precision, k_maxNumberOfIterations, substitution, compiledIntegrand, approximationContext);
   constexpr T minimumPrecisionForDisplay = 0.1;
-  T result = detailedResult.absoluteError > minimumPrecisionForDisplay ? NAN : scale * detailedResult.integral;
-  return Complex<T>::Builder(result);
+  return detailedResult.absoluteError > minimumPrecisionForDisplay ? NAN : scale * detailedResult.integral;
 }
 
 template<typename T>
-T IntegralNode::integrand(T x, Substitution<T> substitution, const ApproximationContext& approximationContext) const {
+void IntegralNode::approximateAtUpperBounds(const T * upperBounds, T * values, int n, const ApproximationContext& approximationContext, T startUpperBound, T startValue) const {
+  T a = childAtIndex(2)->approximate(T(), approximationContext).toScalar();
+  CompiledExpression compiledExpression;
+  const char * parameterName = static_cast<const SymbolNode *>(childAtIndex(1))->name();
+  bool isCompiled = compiledExpression.compile(Expression(childAtIndex(0)), parameterName, approximationContext.context(), approximationContext.complexFormat(), approximationContext.angleUnit());
+  const CompiledExpression * compiledIntegrand = isCompiled ? &compiledExpression : nullptr;
+  Substitution<T> noSubstitution = {};
+  noSubstitution.type = Substitution<T>::Type::None;
+  constexpr T precision = Float<T>::SqrtEpsilonLax();
+  T previousB = startUpperBound;
+  T previousValue = startValue;
+  for (int i = 0; i < n; i++) {
+    T b = upperBounds[i];
+    T value = NAN;
+    if (std::isfinite(previousValue) && std::isfinite(previousB) && std::isfinite(b)) {
+      /* The interval between consecutive bounds is short: a Gauss-Kronrod
+       * quadrature is usually precise enough on it. */
+      DetailedResult<T> detailedResult = previousB <= b ?
+        adaptiveQuadrature<T>(previousB, b, precision, k_maxNumberOfIterations, noSubstitution, compiledIntegrand, approximationContext) :
+        adaptiveQuadrature<T>(b, previousB, precision, k_maxNumberOfIterations, noSubstitution, compiledIntegrand, approximationContext);
+      /* The errors of the steps add up along the curve: each of them must be
+       * negligible compared to the running sum. */
+      if (detailedResult.absoluteError <= precision * std::max(static_cast<T>(1.0), std::fabs(previousValue))) {
+        value = previousValue + (previousB <= b ? detailedResult.integral : -detailedResult.integral);
+      }
+    }
+    if (std::isnan(value) && !std::isnan(a) && !std::isnan(b)) {
+      /* Integrate from the lower bound when no previous value is known, or
+       * when the integrand is not regular between the bounds. */
+      value = approximateBetweenBounds(a, b, Expression(childAtIndex(2)), Float<T>::Builder(b), compiledIntegrand, approximationContext);
+    }
+    values[i] = value;
+    previousB = b;
+    previousValue = value;
+  }
+}
+
+template<typename T>
+T IntegralNode::integrandValue(T x, const CompiledExpression * compiledIntegrand, const ApproximationContext& approximationContext) const {
+  if (compiledIntegrand) {
+    return ComplexNode<T>::ToScalar(compiledIntegrand->approximateWithinParent(x));
+  }
+  return firstChildScalarValueForArgument(x, approximationContext);
+}
+
+template<typename T>
+T IntegralNode::integrand(T x, Substitution<T> substitution, const CompiledExpression * compiledIntegrand, const ApproximationContext& approximationContext) const {
   switch (substitution.type) {
   case Substitution<T>::Type::None:
-    return firstChildScalarValueForArgument(x, approximationContext);
+    return integrandValue(x, compiledIntegrand, approximationContext);
   case Substitution<T>::Type::LeftOpen:
   {
     T z = 1.0 / (x + 1.0);
     T arg = substitution.originB - (2.0 * z - 1.0);
-    return firstChildScalarValueForArgument(arg, approximationContext) * z * z;
+    return integrandValue(arg, compiledIntegrand, approximationContext) * z * z;
   }
   case Substitution<T>::Type::RightOpen:
   {
     T z = 1.0 / (x + 1);
     T arg = 2.0 * z + substitution.originA - 1.0;
-    return firstChildScalarValueForArgument(arg, approximationContext) * z * z;
+    return integrandValue(arg, compiledIntegrand, approximationContext) * z * z;
   }
   default:
   {
@@ -164,7 +224,7 @@ T IntegralNode::integrand(T x, Substitution<T> substitution, const Approximation
     T inv = 1.0 / (1.0 - x2);
     T w = (1.0 + x2) * inv * inv;
     T arg = x * inv;
-    return firstChildScalarValueForArgument(arg, approximationContext) * w;
+    return integrandValue(arg, compiledIntegrand, approximationContext) * w;
   }
   }
 }
@@ -177,7 +237,7 @@ Expression IntegralNode::rewriteIntegrandNear(Expression bound, const ReductionC
 }
 
 template<typename T>
-T IntegralNode::integrandNearBound(T x, T xc, AlternativeIntegrand alternativeIntegrand, const ApproximationContext& approximationContext) const {
+T IntegralNode::integrandNearBound(T x, T xc, AlternativeIntegrand alternativeIntegrand, const CompiledExpression * compiledIntegrand, const ApproximationContext& approximationContext) const {
   T scale = (alternativeIntegrand.b - alternativeIntegrand.a) / 2.0;
   T arg = xc * scale;
   if (x < 0) {
@@ -191,15 +251,15 @@ T IntegralNode::integrandNearBound(T x, T xc, AlternativeIntegrand alternativeIn
     }
     arg = alternativeIntegrand.b - arg;
   }
-  return firstChildScalarValueForArgument(arg, approximationContext) * scale;
+  return integrandValue(arg, compiledIntegrand, approximationContext) * scale;
 }
 
 /* Tanh-Sinh quadrature
  * cf https://www.davidhbailey.com/dhbpapers/dhb-tanh-sinh.pdf */
 template<typename T>
-IntegralNode::DetailedResult<T> IntegralNode::tanhSinhQuadrature(int level, AlternativeIntegrand alternativeIntegrand, const ApproximationContext& approximationContext) const {
+IntegralNode::DetailedResult<T> IntegralNode::tanhSinhQuadrature(int level, AlternativeIntegrand alternativeIntegrand, const CompiledExpression * compiledIntegrand, const ApproximationContext& approximationContext) const {
   T h = 2.0;
-  T result = M_PI_2 * integrandNearBound(0.0, 1.0, alternativeIntegrand, approximationContext); // j=0
+  T result = M_PI_2 * integrandNearBound(0.0, 1.0, alternativeIntegrand, compiledIntegrand, approximationContext); // j=0
   int j = 1;
   T sn2 = 0, sn1 = 0;
   T maxWjFj = 0;
@@ -217,7 +277,7 @@ IntegralNode::DetailedResult<T> IntegralNode::tanhSinhQuadrature(int level, Alte
       T abscissa = std::tanh(sinh);
       T distanceToBound = 1.0 / (std::exp(sinh) * std::cosh(sinh));
       if (leftOk) {
-        T leftValue = integrandNearBound(-abscissa, distanceToBound, alternativeIntegrand, approximationContext);
+        T leftValue = integrandNearBound(-abscissa, distanceToBound, alternativeIntegrand, compiledIntegrand, approximationContext);
         if (std::isnan(leftValue)) {
           leftOk = false;
         } else {
@@ -229,7 +289,7 @@ IntegralNode::DetailedResult<T> IntegralNode::tanhSinhQuadrature(int level, Alte
         if (std::abs(weight * leftValue) < Float<T>::EpsilonLax()) leftOk = false;
       }
       if (rightOk) {
-        T rightValue = integrandNearBound(abscissa, distanceToBound, alternativeIntegrand, approximationContext);
+        T rightValue = integrandNearBound(abscissa, distanceToBound, alternativeIntegrand, compiledIntegrand, approximationContext);
         if (std::isnan(rightValue)) {
           rightOk = false;
         } else {
@@ -299,7 +359,7 @@ T IntegralNode::lagrangeGaussQuadrature(T a, T b, const ApproximationContext& ap
 #else
 
 template<typename T>
-IntegralNode::DetailedResult<T> IntegralNode::kronrodGaussQuadrature(T a, T b, Substitution<T> substitution, const ApproximationContext& approximationContext) const {
+IntegralNode::DetailedResult<T> IntegralNode::kronrodGaussQuadrature(T a, T b, Substitution<T> substitution, const CompiledExpression * compiledIntegrand, const ApproximationContext& approximationContext) const {
   constexpr T epsilon = Float<T>::Epsilon();
   constexpr T max = sizeof(T) == sizeof(double) ? DBL_MAX : FLT_MAX;
   /* We here use Kronrod-Legendre quadrature with n = 21
@@ -333,7 +393,7 @@ IntegralNode::DetailedResult<T> IntegralNode::kronrodGaussQuadrature(T a, T b, S
   errorResult.absoluteError = 0;
 
   T gaussIntegral = 0;
-  T fCenter = integrand(center ,substitution, approximationContext);
+  T fCenter = integrand(center ,substitution, compiledIntegrand, approximationContext);
   if (std::isnan(fCenter)) {
     return errorResult;
   }
@@ -341,11 +401,11 @@ IntegralNode::DetailedResult<T> IntegralNode::kronrodGaussQuadrature(T a, T b, S
   T absKronrodIntegral = std::fabs(kronrodIntegral);
   for (int j = 0; j < 10; j++) {
     T xDelta = halfLength * x[j];
-    T fval1 = integrand(center - xDelta, substitution, approximationContext);
+    T fval1 = integrand(center - xDelta, substitution, compiledIntegrand, approximationContext);
     if (std::isnan(fval1)) {
       return errorResult;
     }
-    T fval2 = integrand(center + xDelta, substitution, approximationContext);
+    T fval2 = integrand(center + xDelta, substitution, compiledIntegrand, approximationContext);
     if (std::isnan(fval2)) {
       return errorResult;
     }
@@ -383,14 +443,14 @@ IntegralNode::DetailedResult<T> IntegralNode::kronrodGaussQuadrature(T a, T b, S
 }
 
 template<typename T>
-IntegralNode::DetailedResult<T> IntegralNode::adaptiveQuadrature(T a, T b, T eps, int numberOfIterations, Substitution<T> substitution, const ApproximationContext& approximationContext) const {
-  DetailedResult<T> quadKG = kronrodGaussQuadrature(a, b, substitution, approximationContext);
+IntegralNode::DetailedResult<T> IntegralNode::adaptiveQuadrature(T a, T b, T eps, int numberOfIterations, Substitution<T> substitution, const CompiledExpression * compiledIntegrand, const ApproximationContext& approximationContext) const {
+  DetailedResult<T> quadKG = kronrodGaussQuadrature(a, b, substitution, compiledIntegrand, approximationContext);
   if (quadKG.absoluteError <= eps) {
     return quadKG;
   } else if (--numberOfIterations > 0) {
     T m = (a+b)/2;
-    DetailedResult<T> left = adaptiveQuadrature<T>(a, m, eps/2, numberOfIterations, substitution, approximationContext);
-    DetailedResult<T> right = adaptiveQuadrature<T>(m, b, eps/2, numberOfIterations, substitution, approximationContext);
+    DetailedResult<T> left = adaptiveQuadrature<T>(a, m, eps/2, numberOfIterations, substitution, compiledIntegrand, approximationContext);
+    DetailedResult<T> right = adaptiveQuadrature<T>(m, b, eps/2, numberOfIterations, substitution, compiledIntegrand, approximationContext);
     DetailedResult<T> result;
     result.integral = left.integral + right.integral;
     result.absoluteError = left.absoluteError + right.absoluteError;
@@ -424,6 +484,17 @@ void Integral::deepReduceChildren(const ReductionContext& reductionContext) {
   }
 }
 
+bool Integral::isAntiderivative(const char * symbol, Context * context) const {
+  Expression upperBound = childAtIndex(3);
+  if (upperBound.type() != ExpressionNode::Type::Symbol || strcmp(static_cast<Symbol &>(upperBound).name(), symbol) != 0) {
+    return false;
+  }
+  // The integrand does not depend on symbol if it is the integration variable
+  return childAtIndex(2).polynomialDegree(context, symbol) == 0
+    && (strcmp(childAtIndex(1).convert<Symbol>().name(), symbol) == 0
+        || childAtIndex(0).polynomialDegree(context, symbol) == 0);
+}
+
 Expression Integral::shallowReduce(ReductionContext reductionContext) {
   {
     Expression e = SimplificationHelper::defaultShallowReduce(
@@ -441,4 +512,7 @@ Expression Integral::shallowReduce(ReductionContext reductionContext) {
   return *this;
 }
 
+template void IntegralNode::approximateAtUpperBounds<float>(const float * upperBounds, float * values, int n, const ApproximationContext& approximationContext, float startUpperBound, float startValue) const;
+template void IntegralNode::approximateAtUpperBounds<double>(const double * upperBounds, double * values, int n, const ApproximationContext& approximationContext, double startUpperBound, double startValue) const;
+
 }
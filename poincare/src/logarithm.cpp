@@ -75,12 +75,30 @@ template<typename U> Evaluation<U> LogarithmNode::templatedApproximate(const App
         std::complex<U> n = c[1];
         return Complex<U>::Builder(
             DivisionNode::computeOnComplex<U>(
-              computeOnComplex(x, complexFormat, angleUnit).complexAtIndex(0),
-              computeOnComplex(n, complexFormat, angleUnit).complexAtIndex(0),
-              complexFormat).complexAtIndex(0));
+              ComplexNode<U>::Normalize(computeOnComplex(x, complexFormat, angleUnit)),
+              ComplexNode<U>::Normalize(computeOnComplex(n, complexFormat, angleUnit)),
+              complexFormat));
       });
 }
 
+template<typename U> std::complex<U> LogarithmNode::templatedApproximateToComplex(const ApproximationContext& approximationContext) const {
+  if (numberOfChildren() == 1) {
+    return ApproximationHelper::MapOneChildToComplex<U>(this, approximationContext, computeOnComplex<U>);
+  }
+  std::complex<U> n = childAtIndex(1)->approximateToComplex(U(), approximationContext);
+  if (Poincare::Preferences::sharedPreferences()->basedLogarithmIsForbidden()
+      && ComplexNode<U>::ToScalar(n) != static_cast<U>(10.0)
+      && ComplexNode<U>::ToScalar(n) != static_cast<U>(M_E)) {
+    return std::complex<U>(NAN, NAN);
+  }
+  std::complex<U> x = childAtIndex(0)->approximateToComplex(U(), approximationContext);
+  return ComplexNode<U>::Normalize(
+      DivisionNode::computeOnComplex<U>(
+        ComplexNode<U>::Normalize(computeOnComplex(x, approximationContext.complexFormat(), approximationContext.angleUnit())),
+        ComplexNode<U>::Normalize(computeOnComplex(n, approximationContext.complexFormat(), approximationContext.angleUnit())),
+        approximationContext.complexFormat()));
+}
+
 void Logarithm::deepReduceChildren(const ReductionContext& reductionContext) {
   assert(numberOfChildren() == 2);
   /* We reduce the base first because of the case log(x1^y, x2) with x1 == x2.
@@ -373,5 +391,7 @@ Expression Logarithm::shallowBeautify() {
 
 template Evaluation<float> LogarithmNode::templatedApproximate<float>(const ApproximationContext&) const;
 template Evaluation<double> LogarithmNode::templatedApproximate<double>(const ApproximationContext&) const;
+template std::complex<float> LogarithmNode::templatedApproximateToComplex<float>(const ApproximationContext&) const;
+template std::complex<double> LogarithmNode::templatedApproximateToComplex<double>(const ApproximationContext&) const;
 
 }
@@ -60,7 +60,7 @@ Evaluation<T> LogicalOperatorNotNode::templatedApproximate(const ApproximationCo
     ApproximationHelper::MapOneChild<T>(
       this,
       approximationContext,
-      [](const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) { return Complex<T>::Undefined(); },
+      [](const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) { return std::complex<T>(NAN, NAN); },
       [](const bool b) {
         Evaluation<T> result = BooleanEvaluation<T>::Builder(!b);
         return result;
@@ -6,6 +6,7 @@
 #include <float.h>
 #include <poincare/absolute_value.h>
 #include <poincare/addition.h>
+#include <poincare/arithmetic.h>
 #include <poincare/division.h>
 #include <poincare/exception_checkpoint.h>
 #include <poincare/exception_checkpoint.h>
@@ -218,6 +219,10 @@ Matrix Matrix::rowCanonize(const ReductionContext& reductionContext, Expression
   // The matrix children have to be reduced to be able to spot 0
   deepReduceChildren(reductionContext);
 
+  if (rowCanonizeRationals(determinant, reduced)) {
+    return *this;
+  }
+
   Multiplication det = Multiplication::Builder();
 
   int m = numberOfRows();
@@ -317,6 +322,135 @@ Matrix Matrix::rowCanonize(const ReductionContext& reductionContext, Expression
   return *this;
 }
 
+static int AbsoluteNaturalOrder(Integer a, Integer b) {
+  a.setNegative(false);
+  b.setNegative(false);
+  return Integer::NaturalOrder(a, b);
+}
+
+bool Matrix::rowCanonizeRationals(Expression * determinant, bool reduced) {
+  int m = numberOfRows();
+  int n = numberOfColumns();
+  assert(m*n <= 2*k_maxNumberOfChildren);
+
+  // Scale the matrix by the lcm of its denominators to work on integers
+  Integer scale(1);
+  for (int i = 0; i < m*n; i++) {
+    Expression child = childAtIndex(i);
+    if (child.type() != ExpressionNode::Type::Rational) {
+      return false;
+    }
+    Integer lcm = Arithmetic::LCM(scale, static_cast<Rational &>(child).integerDenominator());
+    if (lcm.isOverflow()) {
+      return false;
+    }
+    scale = lcm;
+  }
+  Integer cells[2*k_maxNumberOfChildren];
+  for (int i = 0; i < m*n; i++) {
+    Rational child = childAtIndex(i).convert<Rational>();
+    Integer cell = Integer::Multiplication(child.signedIntegerNumerator(), Integer::Division(scale, child.integerDenominator()).quotient);
+    if (cell.isOverflow()) {
+      return false;
+    }
+    cells[i] = cell;
+  }
+
+  /* Bareiss fraction-free elimination: with p the previous pivot, each step
+   * replaces M[i][j] by (M[h][k]*M[i][j]-M[i][k]*M[h][j])/p. The division is
+   * exact and the cells remain minors of the matrix, so they stay as small as
+   * the coefficients of the result. Pivots are picked like in rowCanonize so
+   * that both methods output the same forms. */
+  Integer previousPivot(1);
+  bool negateDeterminant = false;
+  bool hasNullPivot = false;
+  int numberOfPivots = 0;
+  int h = 0; // row pivot
+  int k = 0; // column pivot
+  while (h < m && k < n) {
+    int iPivot = -1;
+    for (int i = h; i < m; i++) {
+      if (cells[i*n+k].isZero()) {
+        continue;
+      }
+      if (iPivot < 0 || AbsoluteNaturalOrder(cells[i*n+k], cells[iPivot*n+k]) > 0) {
+        iPivot = i;
+        if (reduced) {
+          break;
+        }
+      }
+    }
+    if (iPivot < 0) {
+      // No non-null coefficient in this column, skip
+      hasNullPivot = true;
+      k++;
+      continue;
+    }
+    if (iPivot != h) {
+      for (int col = k; col < n; col++) {
+        Integer temp = cells[iPivot*n+col];
+        cells[iPivot*n+col] = cells[h*n+col];
+        cells[h*n+col] = temp;
+      }
+      negateDeterminant = !negateDeterminant;
+    }
+    Integer pivot = cells[h*n+k];
+    int l = reduced ? 0 : h + 1;
+    for (int i = l; i < m; i++) {
+      if (i == h) { continue; }
+      Integer factor = cells[i*n+k];
+      // Rows below the pivot are null on the left of column k
+      for (int j = i < h ? 0 : k+1; j < n; j++) {
+        if (j == k) { continue; }
+        Integer difference = Integer::Subtraction(Integer::Multiplication(pivot, cells[i*n+j]), Integer::Multiplication(factor, cells[h*n+j]));
+        if (difference.isOverflow()) {
+          return false;
+        }
+        IntegerDivision division = Integer::Division(difference, previousPivot);
+        assert(division.remainder.isZero());
+        cells[i*n+j] = division.quotient;
+      }
+      cells[i*n+k] = Integer(0);
+    }
+    previousPivot = pivot;
+    numberOfPivots++;
+    h++;
+    k++;
+  }
+
+  if (determinant) {
+    /* The product of the pivots of rowCanonize is the last Bareiss pivot
+     * divided by the scale at the power of the number of pivots. */
+    if (hasNullPivot) {
+      *determinant = Rational::Builder(0);
+    } else {
+      Integer denominator = Integer::Power(scale, Integer(numberOfPivots));
+      if (denominator.isOverflow()) {
+        return false;
+      }
+      previousPivot.setNegative(previousPivot.isNegative() != negateDeterminant);
+      *determinant = Rational::Builder(previousPivot, denominator);
+    }
+  }
+
+  // Divide each row by its pivot
+  for (int i = 0; i < m; i++) {
+    int pivotColumn = 0;
+    while (pivotColumn < n && cells[i*n+pivotColumn].isZero()) {
+      pivotColumn++;
+    }
+    for (int j = 0; j < n; j++) {
+      Integer numerator = cells[i*n+j];
+      Integer denominator = j <= pivotColumn ? Integer(1) : cells[i*n+pivotColumn];
+      if (j == pivotColumn) {
+        numerator = Integer(1);
+      }
+      replaceChildAtIndexInPlace(i*n+j, numerator.isZero() ? Rational::Builder(0) : Rational::Builder(numerator, denominator));
+    }
+  }
+  return true;
+}
+
 template<typename T>
 void Matrix::ArrayRowCanonize(T * array, int numberOfRows, int numberOfColumns, T * determinant, bool reduced) {
   int h = 0; // row pivot
@@ -590,6 +724,12 @@ Expression Matrix::computeInverseOrDeterminant(bool computeDeterminant, const Re
      * after the long jump. */
     Matrix cl = clone().convert<Matrix>();
     *couldCompute = true;
+    if (computeDeterminant) {
+      // Compute the determinant
+      Expression d;
+      cl.rowCanonize(reductionContext, &d);
+      return d;
+    }
     /* Create the matrix (A|I) with A is the input matrix and I the dim
      * identity matrix */
     Matrix matrixAI = Matrix::Builder();
@@ -603,12 +743,6 @@ Expression Matrix::computeInverseOrDeterminant(bool computeDeterminant, const Re
       }
     }
     matrixAI.setDimensions(dim, 2*dim);
-    if (computeDeterminant) {
-      // Compute the determinant
-      Expression d;
-      matrixAI.rowCanonize(reductionContext, &d);
-      return d;
-    }
     // Compute the inverse
     matrixAI = matrixAI.rowCanonize(reductionContext, nullptr);
     // Check inversibility
@@ -47,12 +47,12 @@ Evaluation<T> NthRootNode::templatedApproximate(const ApproximationContext& appr
          * correspond to the principale angle. */
         if (complexFormat == Preferences::ComplexFormat::Real && indexc.imag() == 0.0 && std::round(indexc.real()) == indexc.real()) {
           // root(x, q) with q integer and x real
-          Complex<T> result = PowerNode::computeNotPrincipalRealRootOfRationalPow(basec, static_cast<T>(1.0), indexc.real());
-          if (!result.isUndefined()) {
-            return result;
+          std::complex<T> result = PowerNode::computeNotPrincipalRealRootOfRationalPow(basec, static_cast<T>(1.0), indexc.real());
+          if (!std::isnan(result.real()) && !std::isnan(result.imag())) {
+            return Complex<T>::Builder(result);
           }
         }
-        return PowerNode::computeOnComplex<T>(basec, std::complex<T>(1.0)/(indexc), complexFormat);
+        return Complex<T>::Builder(PowerNode::computeOnComplex<T>(basec, std::complex<T>(1.0)/(indexc), complexFormat));
       });
 }
 
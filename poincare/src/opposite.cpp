@@ -25,6 +25,12 @@ Evaluation<T> OppositeNode::templatedApproximate(const ApproximationContext& app
   return MultiplicationNode::Compute(Complex<T>::Builder(-1), childEval, approximationContext.complexFormat());
 }
 
+template<typename T>
+std::complex<T> OppositeNode::templatedApproximateToComplex(const ApproximationContext& approximationContext) const {
+  std::complex<T> c = childAtIndex(0)->approximateToComplex(T(), approximationContext);
+  return ComplexNode<T>::Normalize(MultiplicationNode::computeOnComplex<T>(std::complex<T>(-1), c, approximationContext.complexFormat()));
+}
+
 /* Layout */
 
 bool OppositeNode::childAtIndexNeedsUserParentheses(const Expression & child, int childIndex) const {
@@ -1,20 +1,11 @@
 #include "helper.h"
+#include "identifier_table.h"
 
 namespace Poincare {
 
 const Expression::FunctionHelper * const * ParsingHelper::GetReservedFunction(const char * name, size_t nameLength) {
-  const Expression::FunctionHelper * const * reservedFunction = s_reservedFunctions;
-  while (reservedFunction < s_reservedFunctionsUpperBound) {
-    int nameDifference = (**reservedFunction).aliasesList().maxDifferenceWith(name, nameLength);
-    if (nameDifference == 0) {
-      return reservedFunction;
-    }
-    if (nameDifference < 0) {
-      break;
-    }
-    reservedFunction++;
-  }
-  return nullptr;
+  int index = IdentifierTable::IndexForName(IdentifierTable::Kind::ReservedFunction, name, nameLength);
+  return index < 0 ? nullptr : s_reservedFunctions + index;
 }
 
 const Expression::FunctionHelper * const * ParsingHelper::GetInverseFunction(const char * name, size_t nameLength) {
@@ -104,12 +95,7 @@ const ParsingHelper::IdentifierBuilder ParsingHelper::GetIdentifierBuilder(const
 }
 
 int ParsingHelper::SpecialIdentifierIndexForName(const char * name, size_t nameLength) {
-  for (int i = 0; i < k_numberOfSpecialIdentifiers; i++) {
-    if (s_specialIdentifiers[i].identifierAliasesList.contains(name, nameLength)) {
-      return i;
-    }
-  }
-  return -1;
+  return IdentifierTable::IndexForName(IdentifierTable::Kind::SpecialIdentifier, name, nameLength);
 }
 
 }
\ No newline at end of file
@@ -7,11 +7,11 @@
 namespace Poincare {
 
 class ParsingHelper {
-
+  friend class IdentifierTable;
 public:
-  /* The method GetReservedFunction passes through the successive
-   * entries of the reserved functions array in order to determine
-   * whether a token corresponds to an entry. The constexpr static
+  /* The method GetReservedFunction returns the first entry of the reserved
+   * functions array matching a name. Functions accepting different numbers of
+   * children have successive entries, and the constexpr static
    * s_reservedFunctionsUpperBound marks the end of the array. */
   static const Expression::FunctionHelper * const * GetReservedFunction(const char * name, size_t nameLength);
   static const Expression::FunctionHelper * const * GetInverseFunction(const char * name, size_t nameLength);
@@ -47,7 +47,7 @@ private:
   // The array of reserved functions' helpers
   constexpr static const Expression::FunctionHelper * s_reservedFunctions[] = {
     /* This MUST be ordered according to name, and then by numberOfChildren
-     * otherwise GetReservedFunction won't work properly.
+     * otherwise the parser won't find all the entries of a name.
      * If the function has multiple aliases, take the first alias
      * in alphabetical order to choose position in list.
      *
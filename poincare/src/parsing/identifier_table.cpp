@@ -0,0 +1,190 @@
+#include "identifier_table.h"
+#include "helper.h"
+#include <poincare/helpers.h>
+#include <assert.h>
+
+namespace Poincare {
+
+// FNV-1a hash of the name, seeded with the kind
+constexpr static uint32_t Hash(IdentifierTable::Kind kind, const char * name, size_t length) {
+  uint32_t hash = (2166136261u ^ static_cast<uint8_t>(kind)) * 16777619u;
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ static_cast<uint8_t>(name[i])) * 16777619u;
+  }
+  return hash;
+}
+
+constexpr static bool NamesAreEqual(const char * name1, size_t length1, const char * name2, size_t length2) {
+  if (length1 != length2) {
+    return false;
+  }
+  for (size_t i = 0; i < length1; i++) {
+    if (name1[i] != name2[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template<typename Visitor>
+constexpr static void VisitAliases(Visitor * visitor, IdentifierTable::Kind kind, AliasesList aliasesList, int index, const UnitNode::Representative * representative) {
+  /* AliasesList iterators are not constexpr, so the formatted list is parsed
+   * here: either a single name, or names following \01 and separated by \00
+   * until an empty one. */
+  const char * alias = aliasesList;
+  bool hasMultipleAliases = alias[0] == '\01';
+  alias += hasMultipleAliases;
+  while (true) {
+    size_t length = Helpers::StringLength(alias);
+    visitor->add(kind, alias, length, index, representative);
+    if (!hasMultipleAliases) {
+      return;
+    }
+    alias += length + 1;
+    if (alias[0] == 0) {
+      return;
+    }
+  }
+}
+
+template<typename Visitor, typename R, size_t N>
+constexpr void IdentifierTable::VisitRepresentatives(Visitor * visitor, const R (&representatives)[N], int * rank) {
+  for (size_t i = 0; i < N; i++) {
+    VisitAliases(visitor, Kind::Unit, representatives[i].rootSymbols(), *rank, representatives + i);
+    (*rank)++;
+  }
+}
+
+template<typename Visitor>
+constexpr void IdentifierTable::VisitIdentifiers(Visitor * visitor) {
+  for (const Expression::FunctionHelper * const * reservedFunction = ParsingHelper::s_reservedFunctions; reservedFunction < ParsingHelper::s_reservedFunctionsUpperBound; reservedFunction++) {
+    VisitAliases(visitor, Kind::ReservedFunction, (*reservedFunction)->aliasesList(), reservedFunction - ParsingHelper::s_reservedFunctions, nullptr);
+  }
+  for (int i = 0; i < ParsingHelper::k_numberOfSpecialIdentifiers; i++) {
+    VisitAliases(visitor, Kind::SpecialIdentifier, ParsingHelper::s_specialIdentifiers[i].identifierAliasesList, i, nullptr);
+  }
+  for (int i = 0; i < ConstantNode::k_numberOfConstants; i++) {
+    VisitAliases(visitor, Kind::Constant, ConstantNode::k_constants[i].m_aliasesList, i, nullptr);
+  }
+  // In the order of Representative::DefaultRepresentatives
+  int rank = 0;
+  VisitRepresentatives(visitor, Unit::k_timeRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_distanceRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_angleRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_massRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_currentRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_temperatureRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_amountOfSubstanceRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_luminousIntensityRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_frequencyRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_forceRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_pressureRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_energyRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_powerRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_electricChargeRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_electricPotentialRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_electricCapacitanceRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_electricResistanceRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_electricConductanceRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_magneticFluxRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_magneticFieldRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_inductanceRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_catalyticActivityRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_surfaceRepresentatives, &rank);
+  VisitRepresentatives(visitor, Unit::k_volumeRepresentatives, &rank);
+}
+
+class IdentifierTable::Counter {
+public:
+  constexpr Counter() : m_numberOfAliases(0) {}
+  constexpr void add(Kind kind, const char * name, size_t length, int index, const UnitNode::Representative * representative) { m_numberOfAliases++; }
+  constexpr int numberOfAliases() const { return m_numberOfAliases; }
+private:
+  int m_numberOfAliases;
+};
+
+constexpr int IdentifierTable::NumberOfAliases() {
+  Counter counter;
+  VisitIdentifiers(&counter);
+  return counter.numberOfAliases();
+}
+
+template<int NumberOfEntries, int NumberOfSlots>
+class IdentifierTable::Table {
+public:
+  constexpr Table() : m_entries{}, m_slots{}, m_numberOfEntries(0) {
+    VisitIdentifiers(this);
+  }
+  constexpr void add(Kind kind, const char * name, size_t length, int index, const UnitNode::Representative * representative) {
+    int slot = firstSlot(kind, name, length);
+    while (m_slots[slot] != k_emptySlot) {
+      if (entryHasName(m_entries + m_slots[slot] - 1, kind, name, length)) {
+        /* Only keep the first entry of a name, as GetReservedFunction returns
+         * the first of the successive entries of diff or sum. */
+        return;
+      }
+      slot = nextSlot(slot);
+    }
+    assert(m_numberOfEntries < NumberOfEntries && index <= UINT8_MAX && length <= UINT8_MAX);
+    m_entries[m_numberOfEntries] = Entry{name, representative, static_cast<uint8_t>(length), kind, static_cast<uint8_t>(index)};
+    m_slots[slot] = ++m_numberOfEntries;
+  }
+  const Entry * find(Kind kind, const char * name, size_t length) const {
+    for (int slot = firstSlot(kind, name, length); m_slots[slot] != k_emptySlot; slot = nextSlot(slot)) {
+      const Entry * entry = m_entries + m_slots[slot] - 1;
+      if (entryHasName(entry, kind, name, length)) {
+        return entry;
+      }
+    }
+    return nullptr;
+  }
+
+private:
+  static_assert(NumberOfEntries < UINT8_MAX, "Slots cannot index all the entries");
+  static_assert((NumberOfSlots & (NumberOfSlots - 1)) == 0, "The number of slots must be a power of 2");
+  static_assert(NumberOfSlots > NumberOfEntries, "The table must keep empty slots");
+  constexpr static uint8_t k_emptySlot = 0;
+
+  constexpr static int firstSlot(Kind kind, const char * name, size_t length) { return Hash(kind, name, length) & (NumberOfSlots - 1); }
+  constexpr static int nextSlot(int slot) { return (slot + 1) & (NumberOfSlots - 1); }
+  constexpr static bool entryHasName(const Entry * entry, Kind kind, const char * name, size_t length) {
+    return entry->kind == kind && NamesAreEqual(entry->name, entry->nameLength, name, length);
+  }
+
+  Entry m_entries[NumberOfEntries];
+  // Index of the entry plus one, or k_emptySlot
+  uint8_t m_slots[NumberOfSlots];
+  int m_numberOfEntries;
+};
+
+constexpr static int NumberOfSlotsForEntries(int numberOfEntries) {
+  // Keep the load factor under 1/2 for short probe sequences
+  int numberOfSlots = 1;
+  while (numberOfSlots < 2 * numberOfEntries) {
+    numberOfSlots *= 2;
+  }
+  return numberOfSlots;
+}
+
+const IdentifierTable::Entry * IdentifierTable::EntryForName(Kind kind, const char * name, size_t length) {
+  constexpr static int k_numberOfAliases = NumberOfAliases();
+  constexpr static Table<k_numberOfAliases, NumberOfSlotsForEntries(k_numberOfAliases)> k_table;
+  return k_table.find(kind, name, length);
+}
+
+int IdentifierTable::IndexForName(Kind kind, const char * name, size_t length) {
+  assert(kind != Kind::Unit);
+  const Entry * entry = EntryForName(kind, name, length);
+  return entry ? entry->index : -1;
+}
+
+const UnitNode::Representative * IdentifierTable::RepresentativeForRootSymbol(const char * rootSymbol, size_t length, int * rank) {
+  const Entry * entry = EntryForName(Kind::Unit, rootSymbol, length);
+  if (!entry) {
+    return nullptr;
+  }
+  *rank = entry->index;
+  return entry->representative;
+}
+
+}
@@ -0,0 +1,57 @@
+#ifndef POINCARE_PARSING_IDENTIFIER_TABLE_H
+#define POINCARE_PARSING_IDENTIFIER_TABLE_H
+
+#include <poincare/unit.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Poincare {
+
+/* The IdentifierTable resolves the names of reserved functions, special
+ * identifiers, constants and unit root symbols with a single hash lookup
+ * instead of scanning each of their arrays.
+ *
+ * The table is an open addressing hash table built by the compiler from the
+ * arrays themselves: it cannot get out of sync with them and costs nothing at
+ * runtime. Entries are keyed by kind and name, since the same name can be
+ * both a function and a unit (as "min"). */
+
+class IdentifierTable {
+public:
+  enum class Kind : uint8_t {
+    ReservedFunction,
+    SpecialIdentifier,
+    Constant,
+    Unit,
+  };
+
+  /* Return the index of the name in the array of its kind, or -1. For reserved
+   * functions, it is the index of the first entry of the name in
+   * ParsingHelper::s_reservedFunctions. */
+  static int IndexForName(Kind kind, const char * name, size_t length);
+  /* Return the representative having rootSymbol among its aliases, or nullptr.
+   * rank is the position of the representative when iterating over
+   * Representative::DefaultRepresentatives. */
+  static const UnitNode::Representative * RepresentativeForRootSymbol(const char * rootSymbol, size_t length, int * rank);
+
+private:
+  struct Entry {
+    const char * name;
+    const UnitNode::Representative * representative;
+    uint8_t nameLength;
+    Kind kind;
+    uint8_t index;
+  };
+  class Counter;
+  template<int NumberOfEntries, int NumberOfSlots> class Table;
+
+  // Call visitor->add on each alias of each identifier
+  template<typename Visitor> constexpr static void VisitIdentifiers(Visitor * visitor);
+  template<typename Visitor, typename R, size_t N> constexpr static void VisitRepresentatives(Visitor * visitor, const R (&representatives)[N], int * rank);
+  constexpr static int NumberOfAliases();
+  static const Entry * EntryForName(Kind kind, const char * name, size_t length);
+};
+
+}
+
+#endif
@@ -5,8 +5,10 @@
 #include <poincare/complex_cartesian.h>
 #include <poincare/division.h>
 #include <poincare/float.h>
+#include <poincare/helpers.h>
 #include <poincare/imaginary_part.h>
 #include <poincare/least_common_multiple.h>
+#include <poincare/multiplication.h>
 #include <poincare/nth_root.h>
 #include <poincare/opposite.h>
 #include <poincare/power.h>
@@ -15,6 +17,7 @@
 #include <poincare/sign_function.h>
 #include <poincare/subtraction.h>
 #include <poincare/undefined.h>
+#include <utility>
 
 namespace Poincare {
 
@@ -400,6 +403,304 @@ int Polynomial::CubicPolynomialRoots(Expression a, Expression b, Expression c, E
   return !root1->isUndefined() + !root2->isUndefined() + !root3->isUndefined();
 }
 
+// Replace a by a*b, a having enough room for the product
+static void MultiplyCoefficients(double * a, int aDegree, const double * b, int bDegree) {
+  // Compute by decreasing degrees, as a[k] only depends on a[0] to a[k]
+  for (int k = aDegree + bDegree; k >= 0; k--) {
+    double coefficient = 0.;
+    for (int l = std::max(0, k - aDegree); l <= std::min(k, bDegree); l++) {
+      coefficient += a[k - l] * b[l];
+    }
+    a[k] = coefficient;
+  }
+}
+
+int Polynomial::ApproximateCoefficients(const Expression & e, const char * symbol, double * coefficients, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+  int degree = e.polynomialDegree(context, symbol);
+  if (degree < 0 || degree > k_maxApproximatedDegree) {
+    return -1;
+  }
+  if (degree == 0) {
+    coefficients[0] = e.approximateToScalar<double>(context, complexFormat, angleUnit);
+    return std::isfinite(coefficients[0]) ? 0 : -1;
+  }
+  ExpressionNode::Type type = e.type();
+  if (type == ExpressionNode::Type::Symbol) {
+    // e has degree 1, it is the symbol itself
+    coefficients[0] = 0.;
+    coefficients[1] = 1.;
+    return 1;
+  }
+  if (type != ExpressionNode::Type::Addition && type != ExpressionNode::Type::Multiplication && type != ExpressionNode::Type::Power) {
+    return -1;
+  }
+  /* The expression does not need to be developed: children coefficients are
+   * added or multiplied on the approximated arrays. */
+  double childCoefficients[k_maxApproximatedDegree + 1];
+  for (int k = 0; k <= degree; k++) {
+    coefficients[k] = 0.;
+  }
+  if (type == ExpressionNode::Type::Power) {
+    // The exponent is a positive integer since e is a polynomial
+    int childDegree = ApproximateCoefficients(e.childAtIndex(0), symbol, childCoefficients, context, complexFormat, angleUnit);
+    if (childDegree <= 0) {
+      return -1;
+    }
+    coefficients[0] = 1.;
+    for (int productDegree = 0; productDegree < degree; productDegree += childDegree) {
+      MultiplyCoefficients(coefficients, productDegree, childCoefficients, childDegree);
+    }
+    return degree;
+  }
+  bool isAddition = type == ExpressionNode::Type::Addition;
+  coefficients[0] = isAddition ? 0. : 1.;
+  int resultDegree = 0;
+  int numberOfChildren = e.numberOfChildren();
+  for (int i = 0; i < numberOfChildren; i++) {
+    int childDegree = ApproximateCoefficients(e.childAtIndex(i), symbol, childCoefficients, context, complexFormat, angleUnit);
+    if (childDegree < 0) {
+      return -1;
+    }
+    assert(isAddition ? childDegree <= degree : resultDegree + childDegree <= degree);
+    if (isAddition) {
+      for (int k = 0; k <= childDegree; k++) {
+        coefficients[k] += childCoefficients[k];
+      }
+      resultDegree = std::max(resultDegree, childDegree);
+    } else {
+      MultiplyCoefficients(coefficients, resultDegree, childCoefficients, childDegree);
+      resultDegree += childDegree;
+    }
+  }
+  assert(resultDegree == degree);
+  return degree;
+}
+
+void Polynomial::EvaluateWithDerivative(const double * coefficients, int degree, std::complex<double> z, std::complex<double> * value, std::complex<double> * derivative, double * errorBound) {
+  double modulus = std::abs(z);
+  *value = coefficients[degree];
+  *derivative = 0.;
+  *errorBound = std::fabs(coefficients[degree]);
+  for (int k = degree - 1; k >= 0; k--) {
+    *derivative = *derivative * z + *value;
+    *value = *value * z + coefficients[k];
+    *errorBound = *errorBound * modulus + std::fabs(coefficients[k]);
+  }
+  // Bound of the rounding errors of Horner's scheme
+  *errorBound *= 2 * degree * Float<double>::Epsilon();
+}
+
+bool Polynomial::ApproximateRoots(const double * coefficients, int degree, std::complex<double> * roots) {
+  assert(0 < degree && degree <= k_maxApproximatedDegree && coefficients[degree] != 0.);
+  /* The initial approximations are spread on a circle centered on the mean of
+   * the roots, which is the trace of the companion matrix divided by the
+   * degree. Its radius is the geometric mean of the distances from the roots to
+   * the center, given by the determinant of the companion matrix of the
+   * polynomial shifted on the center. The initial angle keeps the
+   * approximations off the real axis, so that they can reach complex roots. */
+  double center = -coefficients[degree - 1] / (degree * coefficients[degree]);
+  std::complex<double> value, derivative;
+  double errorBound;
+  EvaluateWithDerivative(coefficients, degree, center, &value, &derivative, &errorBound);
+  double radius = std::pow(std::abs(value) / std::fabs(coefficients[degree]), 1. / degree);
+  if (!(radius > 0.) || !std::isfinite(radius)) {
+    radius = 1.;
+  }
+  for (int i = 0; i < degree; i++) {
+    roots[i] = center + std::polar(radius, k_initialAngle + 2. * M_PI * i / degree);
+  }
+
+  /* Each iteration applies Newton's method to p(z)/prod(z-roots[j]), which
+   * repels the approximations from one another. Approximations are updated as
+   * soon as they are computed, and are frozen once they converged. */
+  bool converged[k_maxApproximatedDegree] = {};
+  int numberOfConvergedRoots = 0;
+  for (int iteration = 0; iteration < k_maxNumberOfAberthIterations && numberOfConvergedRoots < degree; iteration++) {
+    for (int i = 0; i < degree; i++) {
+      if (converged[i]) {
+        continue;
+      }
+      EvaluateWithDerivative(coefficients, degree, roots[i], &value, &derivative, &errorBound);
+      /* Once the value cannot be told apart from zero, a last correction
+       * still improves the approximation of simple roots. */
+      bool rootIsReached = std::abs(value) <= errorBound;
+      if (value != 0.) {
+        std::complex<double> repulsion = 0.;
+        for (int j = 0; j < degree; j++) {
+          if (j != i) {
+            repulsion += 1. / (roots[i] - roots[j]);
+          }
+        }
+        std::complex<double> correction = 1. / (derivative / value - repulsion);
+        if (!std::isfinite(correction.real()) || !std::isfinite(correction.imag())) {
+          continue;
+        }
+        roots[i] -= correction;
+        rootIsReached = rootIsReached || std::abs(correction) <= Float<double>::Epsilon() * std::abs(roots[i]);
+      }
+      if (rootIsReached) {
+        converged[i] = true;
+        numberOfConvergedRoots++;
+      }
+    }
+  }
+  return numberOfConvergedRoots == degree;
+}
+
+bool Polynomial::RefineRealRoot(const double * coefficients, int degree, int multiplicity, double * root, double extent) {
+  /* The mean of the approximations of a multiple root is not precise, but the
+   * root is a simple root of the (multiplicity-1)-th derivative, on which
+   * Newton's method converges quickly. */
+  double derivativeCoefficients[k_maxApproximatedDegree + 1];
+  int derivativeDegree = degree - multiplicity + 1;
+  for (int k = 0; k <= derivativeDegree; k++) {
+    double factor = 1.;
+    for (int l = k + 1; l < k + multiplicity; l++) {
+      factor *= l;
+    }
+    derivativeCoefficients[k] = coefficients[k + multiplicity - 1] * factor;
+  }
+  std::complex<double> value, derivative;
+  double errorBound;
+  double x = *root;
+  bool converged = false;
+  for (int iteration = 0; iteration < k_maxNumberOfNewtonIterations && !converged; iteration++) {
+    EvaluateWithDerivative(derivativeCoefficients, derivativeDegree, x, &value, &derivative, &errorBound);
+    double correction = value.real() / derivative.real();
+    if (value == 0.) {
+      converged = true;
+      break;
+    }
+    if (!std::isfinite(correction)) {
+      break;
+    }
+    x -= correction;
+    converged = std::abs(value) <= errorBound || std::fabs(correction) <= Float<double>::Epsilon() * std::fabs(x);
+  }
+  if (!converged || std::fabs(x - *root) > extent + Float<double>::Epsilon() * std::fabs(*root)) {
+    return false;
+  }
+  /* The derivative of a nearly real pair of complex conjugate roots also has a
+   * real root between them, but the polynomial does not vanish there. */
+  if (multiplicity > 1) {
+    EvaluateWithDerivative(coefficients, degree, x, &value, &derivative, &errorBound);
+    if (std::abs(value) > errorBound) {
+      return false;
+    }
+  }
+  *root = x;
+  return true;
+}
+
+int Polynomial::ApproximateRealRoots(const double * coefficients, int degree, double * roots) {
+  assert(degree <= k_maxApproximatedDegree);
+  // Leading coefficients can cancel out once approximated
+  while (degree >= 0 && coefficients[degree] == 0.) {
+    degree--;
+  }
+  if (degree < 0) {
+    return -1;
+  }
+  // Factor the null root out, so that it is exact
+  int numberOfRoots = 0;
+  int valuation = 0;
+  while (coefficients[valuation] == 0.) {
+    valuation++;
+  }
+  if (valuation > 0) {
+    roots[numberOfRoots++] = 0.;
+    coefficients += valuation;
+    degree -= valuation;
+  }
+  if (degree == 0) {
+    return numberOfRoots;
+  }
+
+  std::complex<double> complexRoots[k_maxApproximatedDegree];
+  if (!ApproximateRoots(coefficients, degree, complexRoots)) {
+    return -1;
+  }
+
+  /* The disk centered on an approximation z_i, with radius
+   * degree*|p(z_i)/(a_n*prod(z_i-z_j))|, contains a root, and a connected
+   * component of m such disks contains m roots. A root of multiplicity m is
+   * approximated by m points around it: padding p(z_i) with its evaluation
+   * error merges their disks, and the component is reduced to its mean. */
+  double radii[k_maxApproximatedDegree];
+  for (int i = 0; i < degree; i++) {
+    std::complex<double> value, derivative;
+    double errorBound;
+    EvaluateWithDerivative(coefficients, degree, complexRoots[i], &value, &derivative, &errorBound);
+    std::complex<double> product = coefficients[degree];
+    for (int j = 0; j < degree; j++) {
+      if (j != i && complexRoots[j] != complexRoots[i]) {
+        product *= complexRoots[i] - complexRoots[j];
+      }
+    }
+    radii[i] = degree * (std::abs(value) + errorBound) / std::abs(product);
+  }
+  int clusters[k_maxApproximatedDegree];
+  for (int i = 0; i < degree; i++) {
+    clusters[i] = i;
+  }
+  for (int i = 0; i < degree; i++) {
+    for (int j = i + 1; j < degree; j++) {
+      if (clusters[i] == clusters[j] || std::abs(complexRoots[i] - complexRoots[j]) > radii[i] + radii[j]) {
+        continue;
+      }
+      int mergedCluster = clusters[j];
+      for (int k = 0; k < degree; k++) {
+        if (clusters[k] == mergedCluster) {
+          clusters[k] = clusters[i];
+        }
+      }
+    }
+  }
+  for (int cluster = 0; cluster < degree; cluster++) {
+    std::complex<double> sum = 0.;
+    int size = 0;
+    bool isReal = true;
+    for (int i = 0; i < degree; i++) {
+      if (clusters[i] == cluster) {
+        sum += complexRoots[i];
+        size++;
+        isReal = isReal && std::fabs(complexRoots[i].imag()) <= radii[i];
+      }
+    }
+    if (size == 0 || !isReal) {
+      continue;
+    }
+    /* A nearly real pair of complex conjugate roots can fit in its disks too:
+     * the cluster is only real if Newton's method converges on the real line. */
+    double mean = sum.real() / size;
+    double extent = 0.;
+    for (int i = 0; i < degree; i++) {
+      if (clusters[i] == cluster) {
+        extent = std::max(extent, std::abs(complexRoots[i] - mean) + radii[i]);
+      }
+    }
+    if (!RefineRealRoot(coefficients, degree, size, &mean, extent)) {
+      continue;
+    }
+    roots[numberOfRoots++] = mean;
+  }
+
+  Helpers::Sort(
+      // Swap
+      [](int i, int j, void * ctx, int n) {
+        double * roots = static_cast<double *>(ctx);
+        std::swap(roots[i], roots[j]);
+      },
+      // Compare
+      [](int i, int j, void * ctx, int n) {
+        double * roots = static_cast<double *>(ctx);
+        return roots[i] > roots[j];
+      },
+      roots,
+      numberOfRoots);
+  return numberOfRoots;
+}
+
 Expression Polynomial::ReducePolynomial(const Expression * coefficients, int degree, Expression parameter, const ReductionContext& reductionContext) {
   Addition polynomial = Addition::Builder();
   polynomial.addChildAtIndexInPlace(coefficients[0].clone(), 0, 0);
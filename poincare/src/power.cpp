@@ -160,7 +160,7 @@ double PowerNode::degreeForSortingAddition(bool symbolsOnly) const {
 // Private
 
 template<typename T>
-Complex<T> PowerNode::computeNotPrincipalRealRootOfRationalPow(const std::complex<T> c, T p, T q) {
+std::complex<T> PowerNode::computeNotPrincipalRealRootOfRationalPow(const std::complex<T> c, T p, T q) {
   // Assert p and q are in fact integers
   assert(std::round(p) == p);
   assert(std::round(q) == q);
@@ -176,17 +176,17 @@ Complex<T> PowerNode::computeNotPrincipalRealRootOfRationalPow(const std::comple
     std::complex<T> absc = c;
     absc.real(std::fabs(absc.real()));
     // compute |c|^(p/q) which is a real
-    Complex<T> absCPowD = PowerNode::computeOnComplex<T>(absc, std::complex<T>(p/q), Preferences::ComplexFormat::Real);
+    std::complex<T> absCPowD = ComplexNode<T>::Normalize(PowerNode::computeOnComplex<T>(absc, std::complex<T>(p/q), Preferences::ComplexFormat::Real));
     /* As q is odd, c^(p/q) = (sign(c)^(1/q))^p * |c|^(p/q)
      *                      = sign(c)^p         * |c|^(p/q)
      *                      = -|c|^(p/q) iff c < 0 and p odd */
-    return c.real() < static_cast<T>(0.0) && std::pow(static_cast<T>(-1.0), p) < static_cast<T>(0.0) ? Complex<T>::Builder(-absCPowD.complexAtIndex(0)) : absCPowD;
+    return c.real() < static_cast<T>(0.0) && std::pow(static_cast<T>(-1.0), p) < static_cast<T>(0.0) ? ComplexNode<T>::Normalize(-absCPowD) : absCPowD;
   }
-  return Complex<T>::Undefined();
+  return std::complex<T>(NAN, NAN);
 }
 
 template<typename T>
-Complex<T> PowerNode::computeOnComplex(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat) {
+std::complex<T> PowerNode::computeOnComplex(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat) {
   std::complex<T> result;
   if (c.imag() == static_cast<T>(0.0) && d.imag() == static_cast<T>(0.0) && c.real() != static_cast<T>(0.0) && (c.real() > static_cast<T>(0.0) || std::round(d.real()) == d.real())) {
     /* pow: (R+, R) -> R+ (2^1.3 ~ 2.46)
@@ -220,9 +220,9 @@ Complex<T> PowerNode::computeOnComplex(const std::complex<T> c, const std::compl
      * Neglecting it could cause visual artefacts when plotting x^x with a
      * cartesian complex format. The issue is still visible when x is so small
      * that result is 0, which is plotted even though it is "complex". */
-    return Complex<T>::Builder(result);
+    return std::complex<T>(result);
   }
-  return Complex<T>::Builder(ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(result, c, d, false));
+  return std::complex<T>(ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(result, c, d, false));
 }
 
 // Layout
@@ -288,6 +288,15 @@ int PowerNode::simplificationOrderSameType(const ExpressionNode * e, bool ascend
   return SimplificationOrder(childAtIndex(1), e->childAtIndex(1), ascending, ignoreParentheses);
 }
 
+uint32_t PowerNode::computeHash() const {
+  /* x^1 is ordered as x. Since rationals can be modified in place, powers with
+   * any rational exponent are hashed as their base. */
+  if (childAtIndex(1)->type() == Type::Rational) {
+    return childAtIndex(0)->hash();
+  }
+  return ExpressionNode::computeHash();
+}
+
 bool PowerNode::derivate(const ReductionContext& reductionContext, Symbol symbol, Expression symbolValue) {
   return Power(this).derivate(reductionContext, symbol, symbolValue);
 }
@@ -318,50 +327,64 @@ template<typename T> MatrixComplex<T> PowerNode::computeOnMatrixAndComplex(const
   return result;
 }
 
+template<typename T> bool PowerNode::isRationalIndex(T * p, T * q) const {
+  // If the power has been reduced, we look for a rational index
+  if (childAtIndex(1)->type() == ExpressionNode::Type::Rational) {
+    const RationalNode * r = static_cast<const RationalNode *>(childAtIndex(1));
+    *p = r->signedNumerator().approximate<T>();
+    *q = r->denominator().approximate<T>();
+    return true;
+  }
+  /* If the power has been simplified (reduced + beautified), we look for an
+   * index of the for Division(Rational,Rational). */
+  if (childAtIndex(1)->type() == ExpressionNode::Type::Division && childAtIndex(1)->childAtIndex(0)->type() == ExpressionNode::Type::Rational && childAtIndex(1)->childAtIndex(1)->type() == ExpressionNode::Type::Rational) {
+    const RationalNode * pRat = static_cast<const RationalNode *>(childAtIndex(1)->childAtIndex(0));
+    const RationalNode * qRat = static_cast<const RationalNode *>(childAtIndex(1)->childAtIndex(1));
+    if (!pRat->denominator().isOne() || !qRat->denominator().isOne()) {
+      return false;
+    }
+    *p = pRat->signedNumerator().approximate<T>();
+    *q = qRat->signedNumerator().approximate<T>();
+    return true;
+  }
+  /* We don't handle power that haven't been reduced or simplified as the
+   * index can take to many forms and still be equivalent to p/q,
+   * with p, q integers. */
+  return false;
+}
+
 template<typename T> Evaluation<T> PowerNode::templatedApproximate(const ApproximationContext& approximationContext) const {
   /* Special case: c^(p/q) with p, q integers
    * In real mode, c^(p/q) might have a real root which is not the principal
    * root. We return this value in that case to avoid returning "nonreal". */
   if (approximationContext.complexFormat() == Preferences::ComplexFormat::Real) {
     Evaluation<T> base = childAtIndex(0)->approximate(T(), approximationContext);
-    if (base.type() != EvaluationNode<T>::Type::Complex) {
-      goto defaultApproximation;
-    }
-    std::complex<T> c = base.complexAtIndex(0);
-    T p = NAN;
-    T q = NAN;
-    // If the power has been reduced, we look for a rational index
-    if (childAtIndex(1)->type() == ExpressionNode::Type::Rational) {
-      const RationalNode * r = static_cast<const RationalNode *>(childAtIndex(1));
-      p = r->signedNumerator().approximate<T>();
-      q = r->denominator().approximate<T>();
-    }
-    /* If the power has been simplified (reduced + beautified), we look for an
-     * index of the for Division(Rational,Rational). */
-    if (childAtIndex(1)->type() == ExpressionNode::Type::Division && childAtIndex(1)->childAtIndex(0)->type() == ExpressionNode::Type::Rational && childAtIndex(1)->childAtIndex(1)->type() == ExpressionNode::Type::Rational) {
-      const RationalNode * pRat = static_cast<const RationalNode *>(childAtIndex(1)->childAtIndex(0));
-      const RationalNode * qRat = static_cast<const RationalNode *>(childAtIndex(1)->childAtIndex(1));
-      if (!pRat->denominator().isOne() || !qRat->denominator().isOne()) {
-        goto defaultApproximation;
+    T p, q;
+    if (base.type() == EvaluationNode<T>::Type::Complex && isRationalIndex(&p, &q) && !std::isnan(p) && !std::isnan(q)) {
+      std::complex<T> result = computeNotPrincipalRealRootOfRationalPow(base.complexAtIndex(0), p, q);
+      if (!std::isnan(result.real()) && !std::isnan(result.imag())) {
+        return Complex<T>::Builder(result);
       }
-      p = pRat->signedNumerator().approximate<T>();
-      q = qRat->signedNumerator().approximate<T>();
-    }
-    /* We don't handle power that haven't been reduced or simplified as the
-     * index can take to many forms and still be equivalent to p/q,
-     * with p, q integers. */
-    if (std::isnan(p) || std::isnan(q)) {
-      goto defaultApproximation;
-    }
-    Complex<T> result = computeNotPrincipalRealRootOfRationalPow(c, p, q);
-    if (!result.isUndefined()) {
-      return std::move(result);
     }
   }
-defaultApproximation:
   return ApproximationHelper::MapReduce<T>(this, approximationContext, Compute<T>);
 }
 
+template<typename T> std::complex<T> PowerNode::templatedApproximateToComplex(const ApproximationContext& approximationContext) const {
+  // Same as templatedApproximate, approximating the base only once
+  std::complex<T> base = childAtIndex(0)->approximateToComplex(T(), approximationContext);
+  T p, q;
+  if (approximationContext.complexFormat() == Preferences::ComplexFormat::Real && isRationalIndex(&p, &q) && !std::isnan(p) && !std::isnan(q)) {
+    std::complex<T> result = computeNotPrincipalRealRootOfRationalPow(base, p, q);
+    if (!std::isnan(result.real()) && !std::isnan(result.imag())) {
+      return result;
+    }
+  }
+  std::complex<T> index = childAtIndex(1)->approximateToComplex(T(), approximationContext);
+  std::complex<T> result = ComplexNode<T>::Normalize(computeOnComplex<T>(base, index, approximationContext.complexFormat()));
+  return std::isnan(result.real()) || std::isnan(result.imag()) ? std::complex<T>(NAN, NAN) : result;
+}
+
 // Power
 
 int Power::getPolynomialCoefficients(Context * context, const char * symbolName, Expression coefficients[]) const {
@@ -1574,16 +1597,18 @@ bool Power::RationalExponentShouldNotBeReduced(const Rational & b, const Rationa
 }
 
 
-template Complex<float> PowerNode::computeOnComplex<float>(std::complex<float>, std::complex<float>, Preferences::ComplexFormat);
-template Complex<double> PowerNode::computeOnComplex<double>(std::complex<double>, std::complex<double>, Preferences::ComplexFormat);
+template std::complex<float> PowerNode::computeOnComplex<float>(std::complex<float>, std::complex<float>, Preferences::ComplexFormat);
+template std::complex<double> PowerNode::computeOnComplex<double>(std::complex<double>, std::complex<double>, Preferences::ComplexFormat);
 
-template Complex<double> PowerNode::computeNotPrincipalRealRootOfRationalPow<double>(std::complex<double>, double, double);
-template Complex<float> PowerNode::computeNotPrincipalRealRootOfRationalPow<float>(std::complex<float>, float, float);
+template std::complex<double> PowerNode::computeNotPrincipalRealRootOfRationalPow<double>(std::complex<double>, double, double);
+template std::complex<float> PowerNode::computeNotPrincipalRealRootOfRationalPow<float>(std::complex<float>, float, float);
 
 template Evaluation<float> Poincare::PowerNode::Compute<float>(Evaluation<float> eval1, Evaluation<float> eval2, Preferences::ComplexFormat complexFormat);
 template Evaluation<double> Poincare::PowerNode::Compute<double>(Evaluation<double> eval1, Evaluation<double> eval2, Preferences::ComplexFormat complexFormat);
 
 template Evaluation<float> Poincare::PowerNode::templatedApproximate<float>(const Poincare::ApproximationContext& approximationContext) const;
 template Evaluation<double> Poincare::PowerNode::templatedApproximate<double>(const Poincare::ApproximationContext& approximationContext) const;
+template std::complex<float> Poincare::PowerNode::templatedApproximateToComplex<float>(const Poincare::ApproximationContext& approximationContext) const;
+template std::complex<double> Poincare::PowerNode::templatedApproximateToComplex<double>(const Poincare::ApproximationContext& approximationContext) const;
 
 }
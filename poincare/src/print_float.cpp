@@ -1,5 +1,6 @@
 #include <poincare/print_float.h>
 #include <poincare/decimal.h>
+#include <poincare/helpers.h>
 #include <poincare/ieee754.h>
 #include <poincare/infinity.h>
 #include <poincare/preferences.h>
@@ -20,92 +21,51 @@ extern "C" {
 
 namespace Poincare {
 
-constexpr int PrintFloat::Long::k_maxNumberOfCharsForDigit;
-
-PrintFloat::Long::Long(int64_t i) :
-  m_negative(i < 0)
-{
-  int64_t nonNegativeI = m_negative ? -i : i;
-  m_digits[1] = 0 + (nonNegativeI % k_base);
-  m_digits[0] = (nonNegativeI - m_digits[1]) / k_base;
-}
-
-PrintFloat::Long::Long(uint32_t d1, uint32_t d2, bool negative) {
-  m_digits[1] = d2;
-  m_digits[0] = d1;
-  m_negative = negative && !isZero();
-}
-
-void PrintFloat::Long::DivisionByTen(const Long & longToDivide, Long * quotient, Long * digit) {
-  assert(quotient != nullptr && digit != nullptr);
-  if (longToDivide.isZero()) {
-    *quotient = Long(0);
-    *digit = Long(0);
-    return;
-  }
-
-  uint32_t digit0 = longToDivide.digit(0);
-  uint32_t digit1 = longToDivide.digit(1);
-
-  uint32_t d = digit1 % 10;
-  uint32_t digit1DividedByTen = (digit1 - d)/10;
-  *digit = Long(d);
-
-  if (digit0 == 0) {
-    *quotient = Long(0, digit1DividedByTen, longToDivide.isNegative());
-  } else {
-    *quotient = Long(digit0/10, digit1DividedByTen + (k_base/10) * (digit0 % 10), longToDivide.isNegative());
-  }
-}
-
-void PrintFloat::Long::MultiplySmallLongByTen(Long & smallLong) {
-  assert(smallLong.digit(0) == 0 && smallLong.digit(1) < (k_base/1000) && !smallLong.isZero());
-  uint32_t newDigit1 = smallLong.digit(1) * 10;
-  smallLong = Long(0, newDigit1, smallLong.isNegative());
-}
-
-int PrintFloat::Long::serialize(char * buffer, int bufferSize) const {
-  if (bufferSize == 0) {
-    return bufferSize-1;
-  }
-  if (bufferSize == 1) {
-    buffer[0] = 0;
-    return bufferSize-1;
-  }
-  int numberOfChars = m_negative ? 1 : 0; // 1 for the minus sign char
-  if (m_digits[0] != 0) {
-    numberOfChars += PrintInt::Left(m_digits[0], buffer + numberOfChars, bufferSize - numberOfChars - 1);
-    int wantedNumberOfChars = numberOfChars + k_maxNumberOfCharsForDigit + 1;
-    if (wantedNumberOfChars > bufferSize) {
-      /* There is not enough space for serializing the second digit and the null
-       * terminating char. */
-      return wantedNumberOfChars;
+// The 100 pairs of decimal digits, from "00" to "99"
+constexpr static char k_digitPairs[] =
+  "00010203040506070809101112131415161718192021222324"
+  "25262728293031323334353637383940414243444546474849"
+  "50515253545556575859606162636465666768697071727374"
+  "75767778798081828384858687888990919293949596979899";
+
+PrintFloat::Digits::Digits(uint64_t i) {
+  // Fill m_digits from the right, then shift them to the left
+  int firstDigit = k_maxNumberOfDigits;
+  while (i > UINT32_MAX) {
+    uint32_t lowDigits = i % k_base;
+    i /= k_base;
+    for (int k = 0; k < 4; k++) {
+      const char * pair = k_digitPairs + 2 * (lowDigits % 100);
+      m_digits[--firstDigit] = pair[1];
+      m_digits[--firstDigit] = pair[0];
+      lowDigits /= 100;
     }
-    numberOfChars+= PrintInt::Right(m_digits[1], buffer + numberOfChars, std::min(k_maxNumberOfCharsForDigit, bufferSize - numberOfChars - 1));
-  } else {
-    numberOfChars+= PrintInt::Left(m_digits[1], buffer + numberOfChars, bufferSize - numberOfChars - 1);
   }
-  if (m_negative) {
-    assert(UTF8Decoder::CharSizeOfCodePoint('-') == 1);
-    if (bufferSize > 0) {
-      buffer[0] = '-';
-    }
+  uint32_t highDigits = i;
+  while (highDigits >= 100) {
+    const char * pair = k_digitPairs + 2 * (highDigits % 100);
+    m_digits[--firstDigit] = pair[1];
+    m_digits[--firstDigit] = pair[0];
+    highDigits /= 100;
   }
-  if (numberOfChars <= bufferSize - 1) {
-    buffer[numberOfChars] = 0;
+  if (highDigits >= 10) {
+    const char * pair = k_digitPairs + 2 * highDigits;
+    m_digits[--firstDigit] = pair[1];
+    m_digits[--firstDigit] = pair[0];
+  } else {
+    m_digits[--firstDigit] = '0' + highDigits;
   }
-  return numberOfChars;
+  m_numberOfDigits = k_maxNumberOfDigits - firstDigit;
+  memmove(m_digits, m_digits + firstDigit, m_numberOfDigits);
 }
 
-void PrintFloat::PrintLongWithDecimalMarker(char * buffer, int bufferLength, Long & i, int decimalMarkerPosition) {
+void PrintFloat::PrintDigitsWithDecimalMarker(char * buffer, int bufferLength, const Digits & digits, bool negative, int decimalMarkerPosition) {
   /* The decimal marker position is always preceded by a char, thus, it is never
    * in first position. When called by ConvertFloatToText, the buffer length is
    * always > 0 as we asserted a minimal number of available chars. */
   assert(bufferLength > 0 && decimalMarkerPosition != 0);
-  constexpr int tempBufferSize = PrintFloat::k_maxFloatCharSize;
-  char tempBuffer[tempBufferSize];
-  int intLength = i.serialize(tempBuffer, tempBufferSize);
-  int firstDigitChar = UTF8Helper::CodePointIs(tempBuffer, '-') ? 1 : 0;
+  int firstDigitChar = negative ? 1 : 0;
+  int digitIndex = 0;
   /* We should use the UTF8Decoder to write code points in buffers, but it is
    * much clearer to manipulate chars directly as we know that the code point we
    * use ('.', '0, '1', '2', ...) are only one char long. */
@@ -115,17 +75,11 @@ void PrintFloat::PrintLongWithDecimalMarker(char * buffer, int bufferLength, Lon
       buffer[k] = '.';
       continue;
     }
-    if (intLength > firstDigitChar) {
-      assert(UTF8Decoder::CharSizeOfCodePoint(tempBuffer[intLength-1]) == 1);
-      buffer[k] = tempBuffer[--intLength];
-      continue;
-    }
-    assert(UTF8Decoder::CharSizeOfCodePoint('0') == 1);
-    buffer[k] = '0';
+    buffer[k] = digits.digitFromRight(digitIndex++);
   }
-  if (firstDigitChar == 1) {
-    assert(UTF8Decoder::CharSizeOfCodePoint(tempBuffer[0]) == 1);
-    buffer[0] = tempBuffer[0];
+  if (negative) {
+    assert(UTF8Decoder::CharSizeOfCodePoint('-') == 1);
+    buffer[0] = '-';
   }
 }
 
@@ -216,7 +170,7 @@ PrintFloat::TextLengths PrintFloat::ConvertFloatToTextPrivate(T f, char * buffer
    * With doubles, 0.000600000028 * 10^10 = 6000000.2849...
    * This value is then rounded into mantissa = 6000000 which yields a proper
    * display of 0.0006 */
-  double unroundedMantissa = static_cast<double>(f) * std::pow(10.0, (double)(numberOfSignificantDigits - 1 - exponentInBase10));
+  double unroundedMantissa = static_cast<double>(f) * Helpers::PowerOfTen(numberOfSignificantDigits - 1 - exponentInBase10);
   // Round mantissa to get the right number of significant digits
   double mantissa = std::round(unroundedMantissa);
 
@@ -277,7 +231,9 @@ PrintFloat::TextLengths PrintFloat::ConvertFloatToTextPrivate(T f, char * buffer
   assert(numberOfSignificantDigits < std::log10(std::pow(2.0f, 63.0f)));
 
   // Remove/Add the zeroes on the right side of the mantissa
-  Long dividend = Long((int64_t)mantissa);
+  int64_t integerMantissa = mantissa;
+  bool negativeMantissa = integerMantissa < 0;
+  Digits digits(negativeMantissa ? -integerMantissa : integerMantissa);
 
   int exponentForEngineeringNotation = 0;
   int minimalNumberOfMantissaDigits = 1;
@@ -292,17 +248,13 @@ PrintFloat::TextLengths PrintFloat::ConvertFloatToTextPrivate(T f, char * buffer
       assert(numberOfCharsForMantissaWithoutSign - numberOfSignificantDigits < 3);
       for (int i = 0; i < numberOfZeroesToAdd; i++) {
         assert(mantissa < 1000);
-        Long::MultiplySmallLongByTen(dividend);
+        digits.addZero();
       }
     }
   }
   if (removeZeroes) {
-    Long digit;
-    Long quotient;
-    Long::DivisionByTen(dividend, &quotient, &digit);
     int minimumNumberOfCharsInMantissa = mode == Preferences::PrintFloatMode::Engineering ? minimalNumberOfMantissaDigits : 1;
-    int numberOfZerosRemoved = 0;
-    while (digit.isZero()
+    while (digits.lastDigitIsZero()
         && numberOfCharsForMantissaWithoutSign > minimumNumberOfCharsInMantissa
         && (numberOfCharsForMantissaWithoutSign > exponentInBase10 + 1
           || mode == Preferences::PrintFloatMode::Scientific
@@ -310,9 +262,7 @@ PrintFloat::TextLengths PrintFloat::ConvertFloatToTextPrivate(T f, char * buffer
     {
       assert(UTF8Decoder::CharSizeOfCodePoint('0') == 1);
       numberOfCharsForMantissaWithoutSign--;
-      dividend = quotient;
-      Long::DivisionByTen(dividend, &quotient, &digit);
-      numberOfZerosRemoved++;
+      digits.removeLastDigit();
     }
     if (numberOfCharsForMantissaWithoutSign > availableCharLength) {
       // Escape now if the true number of needed digits is not required
@@ -383,7 +333,7 @@ PrintFloat::TextLengths PrintFloat::ConvertFloatToTextPrivate(T f, char * buffer
     // Exception 3: We are about to overflow the buffer.
     return exceptionResult;
   }
-  PrintLongWithDecimalMarker(buffer, numberOfCharsForMantissaWithSign, dividend, decimalMarkerPosition);
+  PrintDigitsWithDecimalMarker(buffer, numberOfCharsForMantissaWithSign, digits, negativeMantissa, decimalMarkerPosition);
   if (doNotWriteExponent) {
     buffer[numberOfCharsForMantissaWithSign] = 0;
     return {.CharLength = numberOfCharsForMantissaWithSign, .GlyphLength = numberOfCharsForMantissaWithSign};
@@ -392,8 +342,7 @@ PrintFloat::TextLengths PrintFloat::ConvertFloatToTextPrivate(T f, char * buffer
   assert(numberOfCharsForMantissaWithSign < bufferSize);
   int currentNumberOfChar = numberOfCharsForMantissaWithSign;
   currentNumberOfChar+= UTF8Decoder::CodePointToChars(UCodePointLatinLetterSmallCapitalE, buffer + currentNumberOfChar, bufferSize - currentNumberOfChar - 1);
-  dividend = Long(exponent); // reuse dividend as it is not needed anymore
-  PrintLongWithDecimalMarker(buffer + currentNumberOfChar, numberOfCharExponent, dividend, -1);
+  PrintDigitsWithDecimalMarker(buffer + currentNumberOfChar, numberOfCharExponent, Digits(std::abs(exponent)), exponent < 0, -1);
   buffer[currentNumberOfChar + numberOfCharExponent] = 0;
   assert(neededNumberOfChars == currentNumberOfChar + numberOfCharExponent);
   return {.CharLength = currentNumberOfChar + numberOfCharExponent, .GlyphLength = numberOfCharsForMantissaWithSign + 1 + numberOfCharExponent};
@@ -15,46 +15,46 @@ namespace Poincare {
 
 /* Rational Node */
 
-RationalNode::RationalNode(const native_uint_t * numeratorDigits, uint8_t numeratorSize, const native_uint_t * denominatorDigits, uint8_t denominatorSize, bool negative) :
+RationalNode::RationalNode(const uint32_t * numeratorWords, uint8_t numeratorSize, const uint32_t * denominatorWords, uint8_t denominatorSize, bool negative) :
   m_negative(negative),
-  m_numberOfDigitsNumerator(numeratorSize),
-  m_numberOfDigitsDenominator(denominatorSize)
+  m_numberOfWordsNumerator(numeratorSize),
+  m_numberOfWordsDenominator(denominatorSize)
 {
-  assert(numeratorSize == 0 || (numeratorDigits == nullptr) == (numeratorSize > Integer::k_maxNumberOfDigits));
-  if (numeratorDigits) {
-    memcpy(m_digits, numeratorDigits, numeratorSize*sizeof(native_uint_t));
+  assert(numeratorSize == 0 || (numeratorWords == nullptr) == (numeratorSize > Integer::k_maxNumberOfWords));
+  if (numeratorWords) {
+    memcpy(m_words, numeratorWords, numeratorSize*sizeof(uint32_t));
   } else {
     numeratorSize = 0;
   }
-  assert(denominatorSize == 0 || (denominatorDigits == nullptr) == (denominatorSize > Integer::k_maxNumberOfDigits));
-  if (denominatorDigits) {
-    memcpy(m_digits + numeratorSize, denominatorDigits, denominatorSize*sizeof(native_uint_t));
+  assert(denominatorSize == 0 || (denominatorWords == nullptr) == (denominatorSize > Integer::k_maxNumberOfWords));
+  if (denominatorWords) {
+    memcpy(m_words + numeratorSize, denominatorWords, denominatorSize*sizeof(uint32_t));
   }
 }
 
 Integer RationalNode::signedNumerator() const {
-  return Integer::BuildInteger((native_uint_t *)m_digits, m_numberOfDigitsNumerator, m_negative, false);
+  return Integer::BuildIntegerFromWords(m_words, m_numberOfWordsNumerator, m_negative);
 }
 
 Integer RationalNode::unsignedNumerator() const {
-  return Integer::BuildInteger((native_uint_t *)m_digits, m_numberOfDigitsNumerator, false, false);
+  return Integer::BuildIntegerFromWords(m_words, m_numberOfWordsNumerator, false);
 }
 
 Integer RationalNode::denominator() const {
-  uint8_t numeratorSize = m_numberOfDigitsNumerator > Integer::k_maxNumberOfDigits ? 0 : m_numberOfDigitsNumerator;
-  return Integer::BuildInteger(((native_uint_t *)m_digits + numeratorSize), m_numberOfDigitsDenominator, false, false);
+  uint8_t numeratorSize = m_numberOfWordsNumerator > Integer::k_maxNumberOfWords ? 0 : m_numberOfWordsNumerator;
+  return Integer::BuildIntegerFromWords(m_words + numeratorSize, m_numberOfWordsDenominator, false);
 }
 
 // Tree Node
 
-static size_t RationalSize(uint8_t numeratorNumberOfDigits, uint8_t denominatorNumberOfDigits) {
-  uint8_t realNumeratorSize = numeratorNumberOfDigits > Integer::k_maxNumberOfDigits ? 0 : numeratorNumberOfDigits;
-  uint8_t realDenominatorSize = denominatorNumberOfDigits > Integer::k_maxNumberOfDigits ? 0 : denominatorNumberOfDigits;
-  return sizeof(RationalNode) + sizeof(native_uint_t)*(realNumeratorSize + realDenominatorSize);
+static size_t RationalSize(uint8_t numeratorNumberOfWords, uint8_t denominatorNumberOfWords) {
+  uint8_t realNumeratorSize = numeratorNumberOfWords > Integer::k_maxNumberOfWords ? 0 : numeratorNumberOfWords;
+  uint8_t realDenominatorSize = denominatorNumberOfWords > Integer::k_maxNumberOfWords ? 0 : denominatorNumberOfWords;
+  return sizeof(RationalNode) + sizeof(uint32_t)*(realNumeratorSize + realDenominatorSize);
 }
 
 size_t RationalNode::size() const {
-  return RationalSize(m_numberOfDigitsNumerator, m_numberOfDigitsDenominator);
+  return RationalSize(m_numberOfWordsNumerator, m_numberOfWordsDenominator);
 }
 
 // Serialization Node
@@ -156,20 +156,20 @@ Rational Rational::Builder(Integer & num, Integer & den) {
     den = Integer::Division(den, gcd).quotient;
   }
   bool negative = (!num.isNegative() && den.isNegative()) || (!den.isNegative() && num.isNegative());
-  return Rational::Builder(num.digits(), num.numberOfDigits(), den.digits(), den.numberOfDigits(), negative);
+  return Rational::Builder(num.words(), num.numberOfWords(), den.words(), den.numberOfWords(), negative);
 }
 
 Rational Rational::Builder(const Integer & numerator) {
-  native_uint_t one = 1;
-  return Rational::Builder(numerator.digits(), numerator.numberOfDigits(), &one, 1, numerator.isNegative());
+  uint32_t one = 1;
+  return Rational::Builder(numerator.words(), numerator.numberOfWords(), &one, 1, numerator.isNegative());
 }
 
 Rational Rational::Builder(native_int_t i) {
-  native_uint_t one = 1;
+  uint32_t one = 1;
   if (i == 0) {
     return Rational::Builder(nullptr, 0, &one, 1, false);
   }
-  native_uint_t absI = i < 0 ? -i : i;
+  uint32_t absI = i < 0 ? -i : i;
   return Rational::Builder(&absI, 1, &one, 1, i < 0);
 }
 
@@ -215,7 +215,7 @@ Rational Rational::IntegerPower(const Rational & i, const Integer & j) {
   return Rational::Builder(newNumerator, newDenominator);
 }
 
-Rational Rational::Builder(const native_uint_t * i, uint8_t numeratorSize, const native_uint_t * j, uint8_t denominatorSize, bool negative) {
+Rational Rational::Builder(const uint32_t * i, uint8_t numeratorSize, const uint32_t * j, uint8_t denominatorSize, bool negative) {
   void * bufferNode = TreePool::sharedPool()->alloc(RationalSize(numeratorSize, denominatorSize));
   RationalNode * node = new (bufferNode) RationalNode(i, numeratorSize, j, denominatorSize, negative);
   TreeHandle h = TreeHandle::BuildWithGhostChildren(node);
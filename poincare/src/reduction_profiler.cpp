@@ -0,0 +1,97 @@
+#include <poincare/reduction_profiler.h>
+
+#if POINCARE_REDUCTION_PROFILER
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string.h>
+
+namespace Poincare {
+
+bool ReductionProfiler::s_isRunning = false;
+uint64_t ReductionProfiler::s_nestedTime = 0;
+uint32_t ReductionProfiler::s_numberOfExhaustedBudgets = 0;
+ReductionProfiler::Counter ReductionProfiler::s_counters[k_numberOfOperations][k_numberOfTypes];
+char ReductionProfiler::s_typeNames[k_numberOfTypes][k_maxNameLength];
+
+ReductionProfiler::Measure::Measure(const ExpressionNode * node, Operation operation) :
+  m_start(0),
+  m_nestedTimeOfParent(0),
+  m_type(node->type()),
+  m_operation(s_isRunning ? operation : Operation::NumberOfOperations)
+{
+  if (m_operation == Operation::NumberOfOperations) {
+    return;
+  }
+  char * name = s_typeNames[static_cast<int>(m_type)];
+  if (name[0] == 0) {
+    std::ostringstream stream;
+    node->logNodeName(stream);
+    strlcpy(name, stream.str().c_str(), k_maxNameLength);
+  }
+  m_nestedTimeOfParent = s_nestedTime;
+  s_nestedTime = 0;
+  m_start = Now();
+}
+
+ReductionProfiler::Measure::~Measure() {
+  if (m_operation == Operation::NumberOfOperations) {
+    return;
+  }
+  uint64_t elapsed = Now() - m_start;
+  /* Measures skipped by an exception leave their nested time behind, which
+   * may then exceed the elapsed time of an enclosing measure. */
+  uint64_t ownTime = s_nestedTime < elapsed ? elapsed - s_nestedTime : 0;
+  Counter * counter = &s_counters[static_cast<int>(m_operation)][static_cast<int>(m_type)];
+  counter->numberOfCalls++;
+  counter->time += ownTime;
+  s_nestedTime = m_nestedTimeOfParent + elapsed;
+}
+
+void ReductionProfiler::Start() {
+  memset(s_counters, 0, sizeof(s_counters));
+  s_nestedTime = 0;
+  s_numberOfExhaustedBudgets = 0;
+  s_isRunning = true;
+}
+
+void ReductionProfiler::ReductionStepBudgetWasExhausted() {
+  if (s_isRunning) {
+    s_numberOfExhaustedBudgets++;
+  }
+}
+
+void ReductionProfiler::Log() {
+  constexpr const char * operationNames[k_numberOfOperations] = {"shallowReduce", "shallowBeautify"};
+  for (int o = 0; o < k_numberOfOperations; o++) {
+    std::cout << operationNames[o] << std::endl;
+    std::cout << std::left << std::setw(k_maxNameLength) << "  type" << std::right << std::setw(10) << "calls" << std::setw(12) << "time (us)" << std::endl;
+    // Print the types by decreasing time
+    bool printed[k_numberOfTypes] = {};
+    while (true) {
+      int next = -1;
+      for (int t = 0; t < k_numberOfTypes; t++) {
+        const Counter & counter = s_counters[o][t];
+        if (!printed[t] && counter.numberOfCalls > 0 && (next < 0 || counter.time > s_counters[o][next].time)) {
+          next = t;
+        }
+      }
+      if (next < 0) {
+        break;
+      }
+      printed[next] = true;
+      std::cout << "  " << std::left << std::setw(k_maxNameLength - 2) << s_typeNames[next] << std::right << std::setw(10) << s_counters[o][next].numberOfCalls << std::setw(12) << s_counters[o][next].time << std::endl;
+    }
+  }
+  std::cout << "Exhausted reduction step budgets: " << s_numberOfExhaustedBudgets << std::endl;
+}
+
+uint64_t ReductionProfiler::Now() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}
+
+#endif
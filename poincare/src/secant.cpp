@@ -13,12 +13,12 @@ namespace Poincare {
 int SecantNode::numberOfChildren() const { return Secant::s_functionHelper.numberOfChildren(); }
 
 template<typename T>
-Complex<T> SecantNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
-  std::complex<T> denominator = CosineNode::computeOnComplex<T>(c, complexFormat, angleUnit).complexAtIndex(0);
+std::complex<T> SecantNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+  std::complex<T> denominator = ComplexNode<T>::Normalize(CosineNode::computeOnComplex<T>(c, complexFormat, angleUnit));
   if (denominator == static_cast<T>(0.0)) {
-    return Complex<T>::Undefined();
+    return std::complex<T>(NAN, NAN);
   }
-  return Complex<T>::Builder(std::complex<T>(1) / denominator);
+  return std::complex<T>(std::complex<T>(1) / denominator);
 }
 
 Layout SecantNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits, Context * context) const {
@@ -35,17 +35,17 @@ bool SignFunctionNode::derivate(const ReductionContext& reductionContext, Symbol
 }
 
 template<typename T>
-Complex<T> SignFunctionNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
+std::complex<T> SignFunctionNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
   if (c.imag() != 0 || std::isnan(c.real())) {
-    return Complex<T>::RealUndefined();
+    return std::complex<T>(NAN, 0.0);
   }
   if (c.real() == 0) {
-    return Complex<T>::Builder(0.0);
+    return std::complex<T>(0.0);
   }
   if (c.real() < 0) {
-    return Complex<T>::Builder(-1.0);
+    return std::complex<T>(-1.0);
   }
-  return Complex<T>::Builder(1.0);
+  return std::complex<T>(1.0);
 }
 
 
@@ -1,4 +1,5 @@
 #include <poincare/solver.h>
+#include <poincare/compiled_expression.h>
 #include <poincare/piecewise_operator.h>
 #include <poincare/subtraction.h>
 #include <poincare/solver_algorithms.h>
@@ -74,19 +75,122 @@ Coordinate2D<T> Solver<T>::next(const Expression & e, BracketTest test, HoneResu
   if (e.recursivelyMatches(Expression::IsRandom, m_context)) {
     return Coordinate2D<T>(NAN, NAN);
   }
-  FunctionEvaluationParameters parameters = { .context = m_context, .unknown = m_unknown, .expression = e, .complexFormat = m_complexFormat, .angleUnit = m_angleUnit };
-  FunctionEvaluation f = [](T x, const void * aux) {
-    const FunctionEvaluationParameters * p = reinterpret_cast<const FunctionEvaluationParameters *>(aux);
-    return p->expression.approximateWithValueForSymbol(p->unknown, x, p->context, p->complexFormat, p->angleUnit);
-  };
-  DiscontinuityEvaluation discontinuityTestForPiecewise = [](T x1, T x2, const void * aux) {
-    const FunctionEvaluationParameters * p = reinterpret_cast<const FunctionEvaluationParameters *>(aux);
-    assert(p->expression.type() == ExpressionNode::Type::PiecewiseOperator);
-    const PiecewiseOperator piecewise = static_cast<const PiecewiseOperator &>(p->expression);
-    return piecewise.indexOfFirstTrueConditionWithValueForSymbol<T>(p->unknown, x1, p->context, p->complexFormat, p->angleUnit) != piecewise.indexOfFirstTrueConditionWithValueForSymbol(p->unknown, x2, p->context, p->complexFormat, p->angleUnit);
+  /* The expression is evaluated many times while bracketing and honing:
+   * evaluate its compiled form when possible. */
+  CompiledExpression compiledExpression;
+  bool isCompiled = compiledExpression.compile(e, m_unknown, m_context, m_complexFormat, m_angleUnit);
+  FunctionEvaluationParameters parameters = { .context = m_context, .unknown = m_unknown, .expression = e, .complexFormat = m_complexFormat, .angleUnit = m_angleUnit, .compiledExpression = isCompiled ? &compiledExpression : nullptr };
+  return next(EvaluateExpression, &parameters, test, hone, e.type() == ExpressionNode::Type::PiecewiseOperator ? PiecewiseConditionChanges : nullptr);
+}
+
+template<typename T>
+void Solver<T>::visitRootsAndExtrema(const Expression & e, bool searchRoots, bool searchExtrema, SolutionVisitor visitor, void * visitorAux) {
+  assert(m_unknown && m_unknown[0] != '\0');
+  assert(!searchRoots || canVisitRoots(e));
+  if (e.recursivelyMatches(Expression::IsRandom, m_context)) {
+    return;
+  }
+  // nextRoot does not look for the roots of an expression that cannot be null
+  searchRoots = searchRoots && e.isNull(m_context) != TrinaryBoolean::False;
+  CompiledExpression compiledExpression;
+  bool isCompiled = compiledExpression.compile(e, m_unknown, m_context, m_complexFormat, m_angleUnit);
+  FunctionEvaluationParameters parameters = { .context = m_context, .unknown = m_unknown, .expression = e, .complexFormat = m_complexFormat, .angleUnit = m_angleUnit, .compiledExpression = isCompiled ? &compiledExpression : nullptr };
+  visitRootsAndExtrema(EvaluateExpression, &parameters, searchRoots, searchExtrema, visitor, visitorAux, e.type() == ExpressionNode::Type::PiecewiseOperator ? PiecewiseConditionChanges : nullptr);
+}
+
+template<typename T>
+void Solver<T>::visitRootsAndExtrema(FunctionEvaluation f, const void * aux, bool searchRoots, bool searchExtrema, SolutionVisitor visitor, void * visitorAux, DiscontinuityEvaluation discontinuityTest) {
+  /* The sweep is the one of next, but it does not stop on solutions. Since
+   * consecutive triplets overlap, a bracket can fire twice: the last solution
+   * of each kind is kept to skip the ones already found. */
+  T lastRoot = k_NAN;
+  T lastMinimum = k_NAN;
+  T lastMaximum = k_NAN;
+  auto visit = [&](Coordinate2D<T> solution, Interest interest, T * lastSolution) {
+    if (!std::isfinite(solution.x1()) || !validSolution(solution.x1()) || (!std::isnan(*lastSolution) && !isAfter(solution.x1(), *lastSolution))) {
+      return;
+    }
+    *lastSolution = solution.x1();
+    if (std::fabs(solution.x2()) < NullTolerance(solution.x1())) {
+      solution.setX2(k_zero);
+    }
+    visitor(solution, interest, visitorAux);
   };
 
-  return next(f, &parameters, test, hone, e.type() == ExpressionNode::Type::PiecewiseOperator ? discontinuityTestForPiecewise : nullptr);
+  Coordinate2D<T> p1, p2(start(), f(start(), aux)), p3(nextX(p2.x1(), end(), static_cast<T>(1.)), k_NAN);
+  p3.setX2(f(p3.x1(), aux));
+  while ((start() < p3.x1()) == (p3.x1() < end())) {
+    p1 = p2;
+    p2 = p3;
+    T slope = (p2.x2() - p1.x2()) / (p2.x1() - p1.x1());
+    p3.setX1(nextX(p2.x1(), end(), slope));
+    p3.setX2(f(p3.x1(), aux));
+
+    Coordinate2D<T> start = p1;
+    Coordinate2D<T> middle = p2;
+    Coordinate2D<T> end = p3;
+    Interest root = OddRootInBracket(start, middle, end, aux);
+    Interest minimum = MinimumInBracket(start, middle, end, aux);
+    Interest maximum = MaximumInBracket(start, middle, end, aux);
+    if (root == Interest::None && minimum == Interest::None && maximum == Interest::None && UndefinedInBracket(start, middle, end, aux) == Interest::Discontinuity) {
+      ExcludeUndefinedFromBracket(&start, &middle, &end, f, aux, minimalStep(middle.x1(), slope));
+      root = OddRootInBracket(start, middle, end, aux);
+      minimum = MinimumInBracket(start, middle, end, aux);
+      maximum = MaximumInBracket(start, middle, end, aux);
+    }
+    // A root found from the previous triplet can lie in this bracket too
+    bool rootIsKnown = !std::isnan(lastRoot) && (start.x1() < lastRoot) == (lastRoot < end.x1());
+    if (searchRoots && root != Interest::None && !rootIsKnown) {
+      visit(honeAndRoundSolution(f, aux, start.x1(), end.x1(), Interest::Root, CompositeBrentForRoot, discontinuityTest), Interest::Root, &lastRoot);
+    }
+    /* As in EvenOrOddRootInBracket, an extremum is a root if it is null and
+     * the bracket has no odd root. */
+    bool extremumCanBeRoot = searchRoots && root == Interest::None && !rootIsKnown;
+    if ((searchExtrema || extremumCanBeRoot) && minimum != Interest::None) {
+      Coordinate2D<T> solution = honeAndRoundSolution(f, aux, start.x1(), end.x1(), Interest::LocalMinimum, SafeBrentMinimum, discontinuityTest);
+      if (searchExtrema) {
+        visit(solution, Interest::LocalMinimum, &lastMinimum);
+      }
+      if (extremumCanBeRoot && std::fabs(solution.x2()) < NullTolerance(solution.x1())) {
+        visit(solution, Interest::Root, &lastRoot);
+      }
+    }
+    if ((searchExtrema || extremumCanBeRoot) && maximum != Interest::None) {
+      Coordinate2D<T> solution = honeAndRoundSolution(f, aux, start.x1(), end.x1(), Interest::LocalMaximum, SafeBrentMaximum, discontinuityTest);
+      if (searchExtrema) {
+        visit(solution, Interest::LocalMaximum, &lastMaximum);
+      }
+      if (extremumCanBeRoot && std::fabs(solution.x2()) < NullTolerance(solution.x1())) {
+        visit(solution, Interest::Root, &lastRoot);
+      }
+    }
+  }
+}
+
+template<typename T>
+bool Solver<T>::canVisitRoots(const Expression & e) const {
+  switch (e.type()) {
+  case ExpressionNode::Type::Addition:
+  case ExpressionNode::Type::Subtraction:
+    // nextRootInAddition also sweeps e, but first looks into these children
+    for (int i = 0; i < e.numberOfChildren(); i++) {
+      if (HasFractionalPowerTerm(e.childAtIndex(i), m_context, const_cast<Solver<T> *>(this))) {
+        return false;
+      }
+    }
+    return true;
+  case ExpressionNode::Type::Multiplication:
+  case ExpressionNode::Type::Power:
+  case ExpressionNode::Type::NthRoot:
+  case ExpressionNode::Type::Division:
+  case ExpressionNode::Type::AbsoluteValue:
+  case ExpressionNode::Type::HyperbolicSine:
+  case ExpressionNode::Type::Opposite:
+  case ExpressionNode::Type::SquareRoot:
+    return false;
+  default:
+    return true;
+  }
 }
 
 template<typename T>
@@ -184,6 +288,45 @@ typename Solver<T>::Interest Solver<T>::EvenOrOddRootInBracket(Coordinate2D<T> a
   return extremum == Interest::None ? MaximumInBracket(a, b, c, aux) : extremum;
 }
 
+template<typename T>
+T Solver<T>::EvaluateExpression(T x, const void * aux) {
+  const FunctionEvaluationParameters * p = reinterpret_cast<const FunctionEvaluationParameters *>(aux);
+  if (p->compiledExpression) {
+    return p->compiledExpression->approximateWithValue(x);
+  }
+  return p->expression.approximateWithValueForSymbol(p->unknown, x, p->context, p->complexFormat, p->angleUnit);
+}
+
+template<typename T>
+bool Solver<T>::PiecewiseConditionChanges(T x1, T x2, const void * aux) {
+  const FunctionEvaluationParameters * p = reinterpret_cast<const FunctionEvaluationParameters *>(aux);
+  assert(p->expression.type() == ExpressionNode::Type::PiecewiseOperator);
+  const PiecewiseOperator piecewise = static_cast<const PiecewiseOperator &>(p->expression);
+  return piecewise.indexOfFirstTrueConditionWithValueForSymbol<T>(p->unknown, x1, p->context, p->complexFormat, p->angleUnit) != piecewise.indexOfFirstTrueConditionWithValueForSymbol(p->unknown, x2, p->context, p->complexFormat, p->angleUnit);
+}
+
+template<typename T>
+bool Solver<T>::IsFractionalPower(const Expression e, Context * context, void * aux) {
+  const Solver<T> * solver = static_cast<const Solver<T> *>(aux);
+  T exponent = k_NAN;
+  if (e.type() == ExpressionNode::Type::SquareRoot) {
+    exponent = static_cast<T>(0.5);
+  } else if (e.type() == ExpressionNode::Type::Power) {
+    exponent = e.childAtIndex(1).approximateToScalar<T>(context, solver->m_complexFormat, solver->m_angleUnit);
+  } else if (e.type() == ExpressionNode::Type::NthRoot) {
+    exponent = static_cast<T>(1.) / e.childAtIndex(1).approximateToScalar<T>(context, solver->m_complexFormat, solver->m_angleUnit);
+  }
+  if (std::isnan(exponent)) {
+    return false;
+  }
+  return k_zero < exponent && exponent < static_cast<T>(1.);
+}
+
+template<typename T>
+bool Solver<T>::HasFractionalPowerTerm(const Expression e, Context * context, void * aux) {
+  return e.recursivelyMatches(IsFractionalPower, context, SymbolicComputation::ReplaceAllDefinedSymbolsWithDefinition, aux);
+}
+
 template<typename T>
 Coordinate2D<T> Solver<T>::SafeBrentMinimum(FunctionEvaluation f, const void * aux, T xMin, T xMax, Interest interest, T precision) {
   if (xMax < xMin) {
@@ -359,6 +502,12 @@ bool Solver<T>::validSolution(T x) const {
   return m_xStart < m_xEnd ? m_xStart + minStep < x && x < m_xEnd : m_xEnd < x && x < m_xStart - minStep;
 }
 
+template<typename T>
+bool Solver<T>::isAfter(T x, T reference) const {
+  T minStep = minimalStep(reference);
+  return m_xStart < m_xEnd ? reference + minStep < x : x < reference - minStep;
+}
+
 template<typename T>
 T Solver<T>::nextX(T x, T direction, T slope) const {
   /* Compute the next step for the bracketing algorithm. The formula is derived
@@ -474,27 +623,7 @@ Coordinate2D<T> Solver<T>::nextRootInAddition(const Expression & e) const {
    * Since the expression does not change sign around x0, the usual numerical
    * schemes won't work. We instead look for the zeroes of f, and check whether
    * they are zeroes of the whole expression. */
-  Expression::ExpressionTestAuxiliary test = [](const Expression e, Context * context, void * aux) {
-    return e.recursivelyMatches([](const Expression e, Context * context, void * aux) {
-          const Solver<T> * solver = static_cast<const Solver<T> *>(aux);
-          T exponent = k_NAN;
-          if (e.type() == ExpressionNode::Type::SquareRoot) {
-          exponent = static_cast<T>(0.5);
-          } else if (e.type() == ExpressionNode::Type::Power) {
-          exponent = e.childAtIndex(1).approximateToScalar<T>(context, solver->m_complexFormat, solver->m_angleUnit);
-          } else if (e.type() == ExpressionNode::Type::NthRoot) {
-          exponent = static_cast<T>(1.) / e.childAtIndex(1).approximateToScalar<T>(context, solver->m_complexFormat, solver->m_angleUnit);
-          }
-          if (std::isnan(exponent)) {
-          return false;
-          }
-          return k_zero < exponent && exponent < static_cast<T>(1.);
-        },
-        context,
-        SymbolicComputation::ReplaceAllDefinedSymbolsWithDefinition,
-        aux);
-  };
-  T xChildrenRoot = nextRootInChildren(e, test, const_cast<Solver<T> *>(this)).x1();
+  T xChildrenRoot = nextRootInChildren(e, HasFractionalPowerTerm, const_cast<Solver<T> *>(this)).x1();
   Solver<T> solver = *this;
   T xRoot = solver.next(e, EvenOrOddRootInBracket, CompositeBrentForRoot).x1();
   if (!std::isfinite(xRoot) || std::fabs(xChildrenRoot - m_xStart) < std::fabs(xRoot - m_xStart)) {
@@ -566,6 +695,9 @@ template Coordinate2D<double> Solver<double>::next(FunctionEvaluation, const voi
 template Coordinate2D<double> Solver<double>::nextRoot(const Expression &);
 template Coordinate2D<double> Solver<double>::nextMinimum(const Expression &);
 template Coordinate2D<double> Solver<double>::nextIntersection(const Expression &, const Expression &, Expression *);
+template void Solver<double>::visitRootsAndExtrema(const Expression &, bool, bool, SolutionVisitor, void *);
+template void Solver<double>::visitRootsAndExtrema(FunctionEvaluation, const void *, bool, bool, SolutionVisitor, void *, DiscontinuityEvaluation);
+template bool Solver<double>::canVisitRoots(const Expression &) const;
 template void Solver<double>::stretch();
 template Coordinate2D<double> Solver<double>::SafeBrentMaximum(FunctionEvaluation, const void *, double, double, Interest, double);
 template double Solver<double>::MaximalStep(double);
@@ -126,6 +126,18 @@ int StatisticsDataset<T>::indexAtCumulatedWeight(T weight, int * upperIndex) con
     }
     return -1;
   }
+  if (m_recomputeSortedIndex && !m_hasSelectedElement) {
+    /* A single element is often needed (the median of a list for instance),
+     * which does not require sorting the whole dataset. */
+    m_hasSelectedElement = true;
+    int lowerIndex, selectedUpperIndex;
+    if (selectIndexAtCumulatedWeight(weight, &lowerIndex, &selectedUpperIndex)) {
+      if (upperIndex) {
+        *upperIndex = selectedUpperIndex;
+      }
+      return lowerIndex;
+    }
+  }
   T epsilon = sizeof(T) == sizeof(double) ? DBL_EPSILON : FLT_EPSILON;
   int elementSortedIndex = -1;
   T cumulatedWeight = 0.0;
@@ -161,6 +173,115 @@ int StatisticsDataset<T>::indexAtCumulatedWeight(T weight, int * upperIndex) con
   return indexAtSortedIndex(elementSortedIndex);
 }
 
+template<typename T>
+bool StatisticsDataset<T>::selectIndexAtCumulatedWeight(T weight, int * lowerIndex, int * upperIndex) const {
+  /* Find the element indexAtCumulatedWeight would find in the sorted dataset,
+   * with a quickselect on the elements of non-null weight. The weights of
+   * both sides of the pivot are summed in another order than the cumulated
+   * weights, which only yields the same sums if the weights are integers. */
+  constexpr int k_maxLengthForSelection = 256;
+  int n = datasetLength();
+  if (n > k_maxLengthForSelection) {
+    return false;
+  }
+  T epsilon = sizeof(T) == sizeof(double) ? DBL_EPSILON : FLT_EPSILON;
+  uint16_t indexes[k_maxLengthForSelection];
+  int numberOfIndexes = 0;
+  T total = 0.0;
+  for (int i = 0; i < n; i++) {
+    T elementWeight = weightAtIndex(i);
+    /* Negative weights would be skipped here, so leave them to the sorted
+     * cumulated weights. */
+    if (std::isnan(elementWeight) || elementWeight != std::round(elementWeight) || elementWeight < static_cast<T>(0.0)) {
+      return false;
+    }
+    if (elementWeight > static_cast<T>(0.0)) {
+      indexes[numberOfIndexes++] = i;
+      total += elementWeight;
+    }
+  }
+  T target = weight - epsilon;
+  if (numberOfIndexes == 0 || total < target || total >= static_cast<T>(1.0) / epsilon) {
+    // The cumulated weight is never reached, or sums are not exact.
+    return false;
+  }
+  int lower = -1;
+  T cumulatedWeight;
+  if (target <= static_cast<T>(0.0)) {
+    lower = indexes[0];
+    for (int k = 1; k < numberOfIndexes; k++) {
+      if (valueIsGreaterThan(lower, indexes[k])) {
+        lower = indexes[k];
+      }
+    }
+    cumulatedWeight = weightAtIndex(lower);
+  }
+  // Weight of the elements preceding the ones in [start, end)
+  T precedingWeight = 0.0;
+  int start = 0;
+  int end = numberOfIndexes;
+  // Give up on quickselect if its pivots are too unbalanced
+  int remainingDepth = 0;
+  for (int k = numberOfIndexes; k > 1; k /= 2) {
+    remainingDepth += 2;
+  }
+  while (lower < 0) {
+    if (end - start == 1) {
+      lower = indexes[start];
+      cumulatedWeight = precedingWeight + weightAtIndex(lower);
+      break;
+    }
+    if (remainingDepth-- == 0) {
+      return false;
+    }
+    // Move the median of the first, middle and last elements at the end
+    int middle = (start + end) / 2;
+    if (valueIsGreaterThan(indexes[start], indexes[middle])) {
+      std::swap(indexes[start], indexes[middle]);
+    }
+    if (valueIsGreaterThan(indexes[middle], indexes[end - 1])) {
+      std::swap(indexes[middle], indexes[end - 1]);
+    }
+    if (valueIsGreaterThan(indexes[start], indexes[middle])) {
+      std::swap(indexes[start], indexes[middle]);
+    }
+    std::swap(indexes[middle], indexes[end - 1]);
+    int pivot = indexes[end - 1];
+    int pivotPosition = start;
+    T smallerWeight = 0.0;
+    for (int k = start; k < end - 1; k++) {
+      if (valueIsGreaterThan(pivot, indexes[k])) {
+        smallerWeight += weightAtIndex(indexes[k]);
+        std::swap(indexes[k], indexes[pivotPosition++]);
+      }
+    }
+    std::swap(indexes[pivotPosition], indexes[end - 1]);
+    if (precedingWeight + smallerWeight >= target) {
+      end = pivotPosition;
+      continue;
+    }
+    T pivotCumulatedWeight = precedingWeight + smallerWeight + weightAtIndex(pivot);
+    if (pivotCumulatedWeight >= target) {
+      lower = pivot;
+      cumulatedWeight = pivotCumulatedWeight;
+    } else {
+      precedingWeight = pivotCumulatedWeight;
+      start = pivotPosition + 1;
+    }
+  }
+  *lowerIndex = lower;
+  *upperIndex = lower;
+  if (std::fabs(cumulatedWeight - weight) < epsilon) {
+    // The upper element is the next one of positive weight
+    for (int k = 0; k < numberOfIndexes; k++) {
+      if (valueIsGreaterThan(indexes[k], lower) && (*upperIndex == lower || valueIsGreaterThan(*upperIndex, indexes[k]))) {
+        *upperIndex = indexes[k];
+      }
+    }
+  }
+  return true;
+}
+
 template<typename T>
 int StatisticsDataset<T>::indexAtSortedIndex(int i) const {
   buildSortedIndex();
@@ -176,7 +297,7 @@ void StatisticsDataset<T>::buildSortedIndex() const {
   for (int i = 0; i < datasetLength(); i++) {
     sortedIndexes.addValueAtIndex(static_cast<float>(i), i);
   }
-  void * pack[] = {&sortedIndexes, const_cast<DatasetColumn<T> *>(m_values)};
+  void * pack[] = {&sortedIndexes, const_cast<StatisticsDataset<T> *>(this)};
   Helpers::Sort(
       [](int i, int j, void * ctx, int n) { // swap
         void ** pack = reinterpret_cast<void **>(ctx);
@@ -188,10 +309,8 @@ void StatisticsDataset<T>::buildSortedIndex() const {
       [](int i, int j, void * ctx, int n) { // compare
         void ** pack = reinterpret_cast<void **>(ctx);
         FloatList<float> * sortedIndex = reinterpret_cast<FloatList<float> *>(pack[0]);
-        DatasetColumn<T> * values = reinterpret_cast<DatasetColumn<T> *>(pack[1]);
-        int sortedIndexI = static_cast<int>(sortedIndex->valueAtIndex(i));
-        int sortedIndexJ = static_cast<int>(sortedIndex->valueAtIndex(j));
-        return std::isnan(values->valueAtIndex(sortedIndexI)) || values->valueAtIndex(sortedIndexI) >= values->valueAtIndex(sortedIndexJ);
+        const StatisticsDataset<T> * dataset = reinterpret_cast<const StatisticsDataset<T> *>(pack[1]);
+        return dataset->valueIsGreaterThan(static_cast<int>(sortedIndex->valueAtIndex(i)), static_cast<int>(sortedIndex->valueAtIndex(j)));
       },
       pack,
       datasetLength());
@@ -199,6 +318,50 @@ void StatisticsDataset<T>::buildSortedIndex() const {
   m_recomputeSortedIndex = false;
 }
 
+template<typename T>
+void StatisticsDataset<T>::setValueHasBeenModified(int index) {
+  m_memoizedTotalWeight = NAN;
+  m_hasSelectedElement = false;
+  if (m_recomputeSortedIndex) {
+    return;
+  }
+  int n = datasetLength();
+  assert(m_sortedIndex.length() == n && index >= 0 && index < n);
+  int position = 0;
+  while (static_cast<int>(m_sortedIndex.valueAtIndex(position)) != index) {
+    position++;
+    assert(position < n);
+  }
+  m_sortedIndex.removeValueAtIndex(position);
+  // Insert it back among the n-1 other sorted indexes
+  int lower = 0;
+  int upper = n - 1;
+  while (lower < upper) {
+    int middle = (lower + upper) / 2;
+    if (valueIsGreaterThan(index, static_cast<int>(m_sortedIndex.valueAtIndex(middle)))) {
+      lower = middle + 1;
+    } else {
+      upper = middle;
+    }
+  }
+  m_sortedIndex.addValueAtIndex(static_cast<float>(index), lower);
+}
+
+template<typename T>
+bool StatisticsDataset<T>::valueIsGreaterThan(int i, int j) const {
+  /* Values are sorted by increasing value then index, which is the order a
+   * stable sort of the dataset yields. */
+  T valueI = m_values->valueAtIndex(i);
+  T valueJ = m_values->valueAtIndex(j);
+  if (std::isnan(valueI) != std::isnan(valueJ)) {
+    return std::isnan(valueI);
+  }
+  if (!std::isnan(valueI) && valueI != valueJ) {
+    return valueI > valueJ;
+  }
+  return i > j;
+}
+
 template class StatisticsDataset<float>;
 template class StatisticsDataset<double>;
 
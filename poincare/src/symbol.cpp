@@ -96,6 +96,11 @@ bool SymbolNode::derivate(const ReductionContext& reductionContext, Symbol symbo
 template<typename T>
 Evaluation<T> SymbolNode::templatedApproximate(const ApproximationContext& approximationContext) const {
   Symbol s(this);
+  // Approximate the definition where it is stored, instead of a copy of it
+  const ExpressionNode * definition = approximationContext.context()->approximableNodeForSymbol(s);
+  if (definition) {
+    return definition->approximate(T(), approximationContext);
+  }
   // No need to preserve undefined symbols because they will be approximated.
   Expression e = SymbolAbstract::Expand(s, approximationContext.context(), false, SymbolicComputation::ReplaceAllSymbolsWithDefinitionsOrUndefined);
   if (e.isUninitialized()) {
@@ -104,6 +109,20 @@ Evaluation<T> SymbolNode::templatedApproximate(const ApproximationContext& appro
   return e.node()->approximate(T(), approximationContext);
 }
 
+template<typename T>
+std::complex<T> SymbolNode::templatedApproximateToComplex(const ApproximationContext& approximationContext) const {
+  Symbol s(this);
+  const ExpressionNode * definition = approximationContext.context()->approximableNodeForSymbol(s);
+  if (definition) {
+    return definition->approximateToComplex(T(), approximationContext);
+  }
+  Expression e = SymbolAbstract::Expand(s, approximationContext.context(), false, SymbolicComputation::ReplaceAllSymbolsWithDefinitionsOrUndefined);
+  if (e.isUninitialized()) {
+    return std::complex<T>(NAN, NAN);
+  }
+  return e.node()->approximateToComplex(T(), approximationContext);
+}
+
 bool SymbolNode::isUnknown() const {
   bool result = UTF8Helper::CodePointIs(m_name, UCodePointUnknown);
   if (result) {
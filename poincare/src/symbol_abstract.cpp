@@ -34,6 +34,14 @@ int SymbolAbstractNode::simplificationOrderSameType(const ExpressionNode * e, bo
   return strcmp(name(), static_cast<const SymbolAbstractNode *>(e)->name());
 }
 
+uint32_t SymbolAbstractNode::computeHash() const {
+  uint32_t hash = static_cast<uint32_t>(type());
+  for (const char * c = name(); *c != 0; c++) {
+    hash = CombineHash(hash, *c);
+  }
+  return hash;
+}
+
 int SymbolAbstractNode::serialize(char * buffer, int bufferSize, Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
   return std::min<int>(strlcpy(buffer, name(), bufferSize), bufferSize - 1);
 }
@@ -24,7 +24,7 @@ int TangentNode::serialize(char * buffer, int bufferSize, Preferences::PrintFloa
 }
 
 template<typename T>
-Complex<T> TangentNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
+std::complex<T> TangentNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
   std::complex<T> angleInput = Trigonometry::ConvertToRadian(c, angleUnit);
   std::complex<T> res = std::tan(angleInput);
   /* tan should be undefined at (2n+1)*pi/2 for any integer n.
@@ -40,7 +40,7 @@ Complex<T> TangentNode::computeOnComplex(const std::complex<T> c, Preferences::C
   if (sin == std::complex<T>(1) || sin == std::complex<T>(-1)) {
     res = std::complex<T>(NAN, NAN);
   }
-  return Complex<T>::Builder(ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(res, angleInput));
+  return std::complex<T>(ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(res, angleInput));
 }
 
 Expression TangentNode::shallowReduce(const ReductionContext& reductionContext) {
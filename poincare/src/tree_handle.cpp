@@ -79,6 +79,7 @@ void TreeHandle::replaceChildInPlace(TreeHandle oldChild, TreeHandle newChild) {
   TreePool::sharedPool()->move(TreePool::sharedPool()->last(), oldChild.node(), oldChild.numberOfChildren());
   oldChild.node()->release(oldChild.numberOfChildren());
   oldChild.deleteParentIdentifier();
+  node()->invalidateHash();
 }
 
 void TreeHandle::replaceChildAtIndexInPlace(int oldChildIndex, TreeHandle newChild) {
@@ -106,7 +107,9 @@ void TreeHandle::mergeChildrenAtIndexInPlace(TreeHandle t, int i) {
     TreePool::sharedPool()->moveChildren(node()->lastDescendant()->next(), t.node());
   }
   node()->incrementNumberOfChildren(numberOfNewChildren);
+  node()->invalidateHash();
   t.node()->eraseNumberOfChildren();
+  t.node()->invalidateHash();
   for (int j = 0; j < numberOfNewChildren; j++) {
     assert(i+j < numberOfChildren());
     childAtIndex(i+j).setParentIdentifier(identifier());
@@ -129,6 +132,7 @@ void TreeHandle::swapChildrenInPlace(int i, int j) {
   TreeHandle secondChild = childAtIndex(secondChildIndex);
   TreePool::sharedPool()->move(firstChild.node()->nextSibling(), secondChild.node(), secondChild.numberOfChildren());
   TreePool::sharedPool()->move(childAtIndex(secondChildIndex).node()->nextSibling(), firstChild.node(), firstChild.numberOfChildren());
+  node()->invalidateHash();
 }
 
 #if POINCARE_TREE_LOG
@@ -160,6 +164,7 @@ void TreeHandle::addChildAtIndexInPlace(TreeHandle t, int index, int currentNumb
   TreePool::sharedPool()->move(newChildPosition, t.node(), t.numberOfChildren());
   t.node()->retain();
   node()->incrementNumberOfChildren();
+  node()->invalidateHash();
   t.setParentIdentifier(identifier());
 
   node()->didChangeArity(currentNumberOfChildren+1);
@@ -183,12 +188,14 @@ void TreeHandle::removeChildInPlace(TreeHandle t, int childNumberOfChildren) {
   t.node()->release(childNumberOfChildren);
   t.deleteParentIdentifier();
   node()->incrementNumberOfChildren(-1);
+  node()->invalidateHash();
 }
 
 void TreeHandle::removeChildrenInPlace(int currentNumberOfChildren) {
   assert(!isUninitialized());
   deleteParentIdentifierInChildren();
   TreePool::sharedPool()->removeChildren(node(), currentNumberOfChildren);
+  node()->invalidateHash();
 }
 
 /* Private */
@@ -30,6 +30,27 @@ void TreeNode::rename(uint16_t identifier, bool unregisterPreviousIdentifier, bo
   updateParentIdentifierInChildren();
 }
 
+uint16_t TreeNode::hash() const {
+  if (m_hash == k_noHash) {
+    uint32_t hash = computeHash();
+    m_hash = static_cast<uint16_t>(hash ^ (hash >> 16));
+    if (m_hash == k_noHash) {
+      m_hash = 1;
+    }
+  }
+  return m_hash;
+}
+
+void TreeNode::invalidateHash() {
+  /* A hash is only memoized once the hashes it depends on are: the ancestors
+   * above one without memoized hash cannot depend on this node. */
+  TreeNode * node = this;
+  do {
+    node->m_hash = k_noHash;
+    node = node->parent();
+  } while (node != nullptr && node->m_hash != k_noHash);
+}
+
 // Hierarchy
 
 TreeNode * TreeNode::parent() const {
@@ -150,6 +171,14 @@ TreeNode * TreeNode::lastDescendant() const {
 
 // Protected
 
+uint32_t TreeNode::computeHash() const {
+  uint32_t hash = CombineHash(size(), numberOfChildren());
+  for (TreeNode * c : directChildren()) {
+    hash = CombineHash(hash, c->hash());
+  }
+  return hash;
+}
+
 #if POINCARE_TREE_LOG
 void TreeNode::log(std::ostream & stream, bool recursive, int indentation, bool verbose) {
   stream << "\n";
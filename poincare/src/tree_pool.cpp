@@ -14,9 +14,21 @@ bool TreePool::s_treePoolLocked = false;
 
 TreePool * TreePool::SharedStaticPool = nullptr;
 
+uint16_t TreePool::generateIdentifier() {
+  /* Identifiers can only run out before the buffer when the pool size is
+   * raised beyond the number of identifiers. */
+  if (m_identifiers.isEmpty()) {
+#if POINCARE_TREE_POOL_STATISTICS
+    m_statistics.numberOfOverflows++;
+#endif
+    ExceptionCheckpoint::Raise();
+  }
+  return m_identifiers.pop();
+}
+
 void TreePool::freeIdentifier(uint16_t identifier) {
   if (TreeNode::IsValidIdentifier(identifier) && identifier < MaxNumberOfNodes) {
-    m_nodeForIdentifierOffset[identifier] = UINT16_MAX;
+    m_nodeForIdentifierOffset[identifier] = k_noNodeOffset;
     m_identifiers.push(identifier);
   }
 }
@@ -82,7 +94,9 @@ void TreePool::moveNodes(TreeNode * destination, TreeNode * source, size_t moveS
   size_t len = moveSize/4;
 
   if (Helpers::Rotate(dst, src, len)) {
-    updateNodeForIdentifierFromNode(dst < src ? destination : source);
+    /* Only the nodes between the former and the new position of the moved
+     * nodes changed address. */
+    updateNodeForIdentifierInRange(dst < src ? destination : source, reinterpret_cast<TreeNode *>(dst < src ? src + len : dst));
   }
 }
 
@@ -109,6 +123,15 @@ void TreePool::treeLog(std::ostream & stream, bool verbose) {
 
 #endif
 
+#if POINCARE_TREE_POOL_STATISTICS
+void TreePool::logStatistics() const {
+  std::cout << "TreePool size: " << BufferSize << " bytes" << std::endl;
+  std::cout << "Peak occupancy: " << m_statistics.peakOccupancy << " bytes" << std::endl;
+  std::cout << "Overflows: " << m_statistics.numberOfOverflows << std::endl;
+  std::cout << "Rollbacks: " << m_statistics.numberOfRollbacks << std::endl;
+}
+#endif
+
 int TreePool::numberOfNodes() const {
   int count = 0;
   TreeNode * firstNode = first();
@@ -128,10 +151,20 @@ void * TreePool::alloc(size_t size) {
 
   size = Helpers::AlignedSize(size, ByteAlignment);
   if (m_cursor + size > buffer() + BufferSize) {
+#if POINCARE_TREE_POOL_STATISTICS
+    m_statistics.numberOfOverflows++;
+#endif
     ExceptionCheckpoint::Raise();
   }
   void * result = m_cursor;
   m_cursor += size;
+  m_numberOfAllocations++;
+#if POINCARE_TREE_POOL_STATISTICS
+  size_t occupancy = m_cursor - buffer();
+  if (occupancy > m_statistics.peakOccupancy) {
+    m_statistics.peakOccupancy = occupancy;
+  }
+#endif
   return result;
 }
 
@@ -169,12 +202,13 @@ void TreePool::registerNode(TreeNode * node) {
   uint16_t nodeID = node->identifier();
   assert(nodeID < MaxNumberOfNodes);
   const int nodeOffset = (((char *)node) - (char *)m_alignedBuffer)/ByteAlignment;
-  assert(nodeOffset < k_maxNodeOffset); // Check that the offset can be stored in a uint16_t
+  assert(nodeOffset < k_maxNodeOffset); // Check that the offset can be stored in a NodeOffset
   m_nodeForIdentifierOffset[nodeID] = nodeOffset;
 }
 
-void TreePool::updateNodeForIdentifierFromNode(TreeNode * node) {
-  for (TreeNode * n : Nodes(node)) {
+void TreePool::updateNodeForIdentifierInRange(TreeNode * start, TreeNode * end) {
+  assert(start <= end && end <= last());
+  for (TreeNode * n = start; n < end; n = n->next()) {
     registerNode(n);
   }
 }
@@ -222,9 +256,9 @@ void TreePool::IdentifierStack::remove(uint16_t j) {
 }
 
 // Reset m_nodeForIdentifierOffset for all available identifiers
-void TreePool::IdentifierStack::resetNodeForIdentifierOffsets(uint16_t * nodeForIdentifierOffset) const {
+void TreePool::IdentifierStack::resetNodeForIdentifierOffsets(NodeOffset * nodeForIdentifierOffset) const {
   for (uint16_t i = 0; i < m_currentIndex; i++) {
-    nodeForIdentifierOffset[m_availableIdentifiers[i]] = UINT16_MAX;
+    nodeForIdentifierOffset[m_availableIdentifiers[i]] = k_noNodeOffset;
   }
 }
 
@@ -234,6 +268,10 @@ void TreePool::freePoolFromNode(TreeNode * firstNodeToDiscard) {
   assert(firstNodeToDiscard >= first());
   assert(firstNodeToDiscard <= last());
 
+#if POINCARE_TREE_POOL_STATISTICS
+  m_statistics.numberOfRollbacks++;
+#endif
+
   // Free all identifiers
   m_identifiers.reset();
   TreeNode * currentNode = first();
@@ -12,6 +12,7 @@
 #include <assert.h>
 #include <limits.h>
 #include <utility>
+#include "parsing/identifier_table.h"
 
 namespace Poincare {
 
@@ -298,29 +299,6 @@ int UnitNode::Representative::serialize(char * buffer, int bufferSize, const Pre
   return length;
 }
 
-bool UnitNode::Representative::canParseWithEquivalents(const char * symbol, size_t length, const Representative * * representative, const Prefix * * prefix) const {
-  const Representative * candidate = representativesOfSameDimension();
-  if (!candidate) {
-    return false;
-  }
-  for (int i = 0; i < numberOfRepresentatives(); i++) {
-    AliasesList rootSymbolAliasesList = (candidate + i)->rootSymbols();
-    for (const char * rootSymbolAlias : rootSymbolAliasesList) {
-      size_t rootSymbolLength = strlen(rootSymbolAlias);
-      int potentialPrefixLength = length - rootSymbolLength;
-      if (potentialPrefixLength >= 0
-      && strncmp(rootSymbolAlias, symbol + potentialPrefixLength, rootSymbolLength) == 0
-      && candidate[i].canParse(symbol, potentialPrefixLength, prefix)) {
-        if (representative) {
-          *representative = (candidate + i);
-        }
-        return true;
-      }
-    }
-  }
-  return false;
-}
-
 bool UnitNode::Representative::canParse(const char * symbol, size_t length, const Prefix * * prefix) const {
   if (!isInputPrefixable()) {
     if (prefix) {
@@ -797,17 +775,46 @@ Unit Unit::Builder(const Unit::Representative * representative, const Prefix * p
   return static_cast<Unit &>(h);
 }
 
+constexpr static size_t MaxPrefixLength() {
+  size_t maxLength = 0;
+  for (int i = 0; i < Unit::Prefix::k_numberOfPrefixes; i++) {
+    maxLength = std::max<size_t>(maxLength, Helpers::StringLength(Unit::k_prefixes[i].symbol()));
+  }
+  return maxLength;
+}
+
 bool Unit::CanParse(const char * symbol, size_t length, const Unit::Representative * * representative, const Unit::Prefix * * prefix) {
   if (symbol[0] == '_') {
     symbol++;
     length--;
   }
-  for (int i = 0; i < Representative::k_numberOfDimensions; i++) {
-    if (Representative::DefaultRepresentatives()[i]->canParseWithEquivalents(symbol, length, representative, prefix)) {
-      return true;
+  /* Look the root symbol up for each possible length of prefix. When several
+   * splits are valid, the first representative of DefaultRepresentatives is
+   * chosen. */
+  constexpr size_t k_maxPrefixLength = MaxPrefixLength();
+  const Representative * bestRepresentative = nullptr;
+  const Prefix * bestPrefix = nullptr;
+  int bestRank = INT_MAX;
+  for (size_t prefixLength = 0; prefixLength <= std::min(k_maxPrefixLength, length); prefixLength++) {
+    int rank;
+    const Representative * candidate = IdentifierTable::RepresentativeForRootSymbol(symbol + prefixLength, length - prefixLength, &rank);
+    const Prefix * candidatePrefix;
+    if (candidate && rank < bestRank && candidate->canParse(symbol, prefixLength, &candidatePrefix)) {
+      bestRepresentative = candidate;
+      bestPrefix = candidatePrefix;
+      bestRank = rank;
     }
   }
-  return false;
+  if (!bestRepresentative) {
+    return false;
+  }
+  if (representative) {
+    *representative = bestRepresentative;
+  }
+  if (prefix) {
+    *prefix = bestPrefix;
+  }
+  return true;
 }
 
 static void chooseBestRepresentativeAndPrefixForValueOnSingleUnit(Expression unit, double * value, const ReductionContext& reductionContext, bool optimizePrefix) {
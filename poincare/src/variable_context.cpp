@@ -30,6 +30,16 @@ bool VariableContext::setExpressionForSymbolAbstract(const Expression & expressi
   return ContextWithParent::setExpressionForSymbolAbstract(expression, symbol);
 }
 
+const ExpressionNode * VariableContext::approximableNodeForSymbol(const SymbolAbstract & symbol) {
+  if (m_name != nullptr && strcmp(symbol.name(), m_name) == 0) {
+    if (symbol.type() != ExpressionNode::Type::Symbol || m_value.isUninitialized() || !m_value.node()->canBeApproximatedOutOfPool()) {
+      return nullptr;
+    }
+    return m_value.node();
+  }
+  return parentContext()->approximableNodeForSymbol(symbol);
+}
+
 const Expression VariableContext::protectedExpressionForSymbolAbstract(const SymbolAbstract & symbol, bool clone, ContextWithParent * lastDescendantContext) {
   if (m_name != nullptr && strcmp(symbol.name(), m_name) == 0) {
     if (symbol.type() == ExpressionNode::Type::Symbol) {
@@ -22,6 +22,115 @@ void Zoom::HorizontalAsymptoteHelper::update(Coordinate2D<float> p, float slope)
   }
 }
 
+// AdaptiveSampler
+
+class Zoom::AdaptiveSampler {
+public:
+  AdaptiveSampler(SamplesEvaluation evaluation, const void * evaluationAux, SampleVisitor visitor, void * visitorAux) : m_evaluation(evaluation), m_evaluationAux(evaluationAux), m_visitor(visitor), m_visitorAux(visitorAux), m_pendingWeight(0.f) {}
+
+  void sample(Range1D tRange);
+
+private:
+  /* A bend is only worth refining if it is visible, i.e. if it deviates from
+   * a straight line by a few pixels. */
+  constexpr static float k_relativeTolerance = 0.01f;
+
+  /* Return true if the ordinate is defined at only one of a and b, or if it
+   * changes sign. Zeros are told apart from both signs, so that the sampling
+   * is also refined around roots. */
+  static bool Differ(Coordinate2D<float> a, Coordinate2D<float> b) {
+    float ya = a.x2(), yb = b.x2();
+    return std::isnan(ya) != std::isnan(yb) || (ya < 0.f) != (yb < 0.f) || (ya > 0.f) != (yb > 0.f);
+  }
+
+  Coordinate2D<float> evaluate(float t) const;
+  // Return true if b deviates from the middle of a and c.
+  bool bends(Coordinate2D<float> a, Coordinate2D<float> b, Coordinate2D<float> c) const;
+  void refine(float ta, Coordinate2D<float> a, float tb, Coordinate2D<float> b, int depth);
+  void visitInterval(Coordinate2D<float> b, float length);
+
+  SamplesEvaluation m_evaluation;
+  const void * m_evaluationAux;
+  SampleVisitor m_visitor;
+  void * m_visitorAux;
+  Coordinate2D<float> m_tolerance;
+  // Left end of the next interval to visit
+  Coordinate2D<float> m_pending;
+  float m_pendingWeight;
+};
+
+void Zoom::AdaptiveSampler::sample(Range1D tRange) {
+  constexpr int k_numberOfCoarseSamples = k_numberOfCoarseIntervals + 1;
+  float ts[k_numberOfCoarseSamples];
+  Coordinate2D<float> points[k_numberOfCoarseSamples];
+  float step = tRange.length() / k_numberOfCoarseIntervals;
+  for (int i = 0; i < k_numberOfCoarseSamples; i++) {
+    ts[i] = i == k_numberOfCoarseIntervals ? tRange.max() : tRange.min() + i * step;
+  }
+  for (int i = 0; i < k_numberOfCoarseSamples; i += k_batchSize) {
+    m_evaluation(ts + i, points + i, std::min(static_cast<int>(k_batchSize), k_numberOfCoarseSamples - i), m_evaluationAux);
+  }
+
+  /* Tolerances are relative to the spread of the coarse samples, which is a
+   * good estimate of the extent of the curve. */
+  Range2D spread;
+  for (int i = 0; i < k_numberOfCoarseSamples; i++) {
+    spread.extend(points[i], INFINITY);
+  }
+  m_tolerance = Coordinate2D<float>(k_relativeTolerance * spread.x()->length(), k_relativeTolerance * spread.y()->length());
+
+  m_pending = points[0];
+  m_pendingWeight = 0.f;
+  for (int i = 0; i < k_numberOfCoarseIntervals; i++) {
+    if (Differ(points[i], points[i + 1])
+     || (i > 0 && bends(points[i - 1], points[i], points[i + 1]))
+     || (i + 1 < k_numberOfCoarseIntervals && bends(points[i], points[i + 1], points[i + 2]))) {
+      refine(ts[i], points[i], ts[i + 1], points[i + 1], 0);
+    } else {
+      visitInterval(points[i + 1], ts[i + 1] - ts[i]);
+    }
+  }
+  m_visitor(m_pending, m_pendingWeight, m_visitorAux);
+}
+
+Coordinate2D<float> Zoom::AdaptiveSampler::evaluate(float t) const {
+  Coordinate2D<float> point;
+  m_evaluation(&t, &point, 1, m_evaluationAux);
+  return point;
+}
+
+bool Zoom::AdaptiveSampler::bends(Coordinate2D<float> a, Coordinate2D<float> b, Coordinate2D<float> c) const {
+  return std::fabs(b.x1() - (a.x1() + c.x1()) / 2.f) > m_tolerance.x1() || std::fabs(b.x2() - (a.x2() + c.x2()) / 2.f) > m_tolerance.x2();
+}
+
+void Zoom::AdaptiveSampler::refine(float ta, Coordinate2D<float> a, float tb, Coordinate2D<float> b, int depth) {
+  if (depth == k_maxRefinementDepth) {
+    visitInterval(b, tb - ta);
+    return;
+  }
+  float tm = (ta + tb) / 2.f;
+  Coordinate2D<float> m = evaluate(tm);
+  bool bent = bends(a, m, b);
+  if (bent || Differ(a, m)) {
+    refine(ta, a, tm, m, depth + 1);
+  } else {
+    visitInterval(m, tm - ta);
+  }
+  if (bent || Differ(m, b)) {
+    refine(tm, m, tb, b, depth + 1);
+  } else {
+    visitInterval(b, tb - tm);
+  }
+}
+
+void Zoom::AdaptiveSampler::visitInterval(Coordinate2D<float> b, float length) {
+  // Each end of the interval accounts for half of it.
+  m_pendingWeight += length / 2.f;
+  m_visitor(m_pending, m_pendingWeight, m_visitorAux);
+  m_pending = b;
+  m_pendingWeight = length / 2.f;
+}
+
 // Zoom - Public
 
 Range2D Zoom::Sanitize(Range2D range, float normalYXRatio, float maxFloat) {
@@ -96,11 +205,22 @@ void Zoom::fitPoint(Coordinate2D<float> xy, bool flipped, float leftMargin, floa
 }
 
 void Zoom::fitFullFunction(Function2DWithContext<float> f, const void * model) {
-  float step = m_bounds.length() / (k_sampleSize - 1);
-  for (size_t i = 0; i < k_sampleSize; i++) {
-    float t = m_bounds.min() + step * i;
-    privateFitPoint(f(t, model, m_context));
-  }
+  struct FullFunctionParameters {
+    Zoom * zoom;
+    Function2DWithContext<float> f;
+    const void * model;
+  };
+  FullFunctionParameters params = { .zoom = this, .f = f, .model = model };
+  SamplesEvaluation evaluation = [](const float * ts, Coordinate2D<float> * points, int n, const void * aux) {
+    const FullFunctionParameters * p = static_cast<const FullFunctionParameters *>(aux);
+    for (int i = 0; i < n; i++) {
+      points[i] = p->f(ts[i], p->model, p->zoom->m_context);
+    }
+  };
+  SampleVisitor visitor = [](Coordinate2D<float> point, float, void * aux) {
+    static_cast<FullFunctionParameters *>(aux)->zoom->privateFitPoint(point);
+  };
+  SampleAdaptively(m_bounds, evaluation, &params, visitor, &params);
 }
 
 static Solver<float>::Interest pointIsInterestingHelper(Coordinate2D<float> a, Coordinate2D<float> b, Coordinate2D<float> c, const void * aux) {
@@ -182,40 +302,66 @@ void Zoom::fitConditions(PiecewiseOperator p, Function2DWithContext<float> fullF
   fitWithSolver(&dummy, &dummy, evaluator, &params, test, hone, vertical);
 }
 
-void Zoom::fitMagnitude(Function2DWithContext<float> f, const void * model, bool vertical) {
+void Zoom::fitMagnitude(Function2DWithContext<float> f, const void * model, bool vertical, ValuesBatchWithContext<float> fBatch) {
   /* We compute the log mean value of the expression, which gives an idea of the
-   * order of magnitude of the function, to crop the Y axis. */
-  constexpr float aboutZero = Solver<float>::k_minimalAbsoluteStep;
-  Range1D sample;
-  float nSum = 0.f, pSum = 0.f;
-  int nPop = 0, pPop = 0;
-
+   * order of magnitude of the function, to crop the Y axis. Samples are
+   * weighted by the length they account for, as the sampling is denser where
+   * the function bends. */
+  struct MagnitudeParameters {
+    Function2DWithContext<float> f;
+    ValuesBatchWithContext<float> fBatch;
+    const void * model;
+    Context * context;
+    float (Coordinate2D<float>::*ordinate)() const;
+    Range1D sample;
+    float nSum, pSum;
+    float nPop, pPop;
+    float maxFloat;
+  };
   float (Coordinate2D<float>::*ordinate)() const = vertical ? &Coordinate2D<float>::x1 : &Coordinate2D<float>::x2;
-  Range2D saneRange = sanitizedRange();
-  Range1D xRange = *(vertical ? saneRange.y() : saneRange.x());
-  float step = xRange.length() / (k_sampleSize - 1);
-
-  for (size_t i = 0; i < k_sampleSize; i++) {
-    float x = xRange.min() + i * step;
-    float y = (f(x, model, m_context).*ordinate)();
-    sample.extend(y, m_maxFloat);
+  MagnitudeParameters params = { .f = f, .fBatch = fBatch, .model = model, .context = m_context, .ordinate = ordinate, .sample = Range1D(), .nSum = 0.f, .pSum = 0.f, .nPop = 0.f, .pPop = 0.f, .maxFloat = m_maxFloat };
+  SamplesEvaluation evaluation = [](const float * xs, Coordinate2D<float> * points, int n, const void * aux) {
+    const MagnitudeParameters * p = static_cast<const MagnitudeParameters *>(aux);
+    assert(n <= static_cast<int>(k_batchSize));
+    float ys[k_batchSize];
+    if (p->fBatch) {
+      p->fBatch(xs, ys, n, p->model, p->context);
+    } else {
+      for (int i = 0; i < n; i++) {
+        ys[i] = (p->f(xs[i], p->model, p->context).*p->ordinate)();
+      }
+    }
+    for (int i = 0; i < n; i++) {
+      points[i] = Coordinate2D<float>(xs[i], ys[i]);
+    }
+  };
+  SampleVisitor visitor = [](Coordinate2D<float> point, float weight, void * aux) {
+    constexpr float aboutZero = Solver<float>::k_minimalAbsoluteStep;
+    MagnitudeParameters * p = static_cast<MagnitudeParameters *>(aux);
+    float y = point.x2();
+    p->sample.extend(y, p->maxFloat);
     float yAbs = std::fabs(y);
     if (!(yAbs > aboutZero)) { // Negated to account for NANs
-      continue;
+      return;
     }
     float yLog = std::log(yAbs);
     if (y < 0.f) {
-      nSum += yLog;
-      nPop++;
+      p->nSum += weight * yLog;
+      p->nPop += weight;
     } else {
-      pSum += yLog;
-      pPop++;
+      p->pSum += weight * yLog;
+      p->pPop += weight;
     }
-  }
+  };
+
+  Range2D saneRange = sanitizedRange();
+  Range1D xRange = *(vertical ? saneRange.y() : saneRange.x());
+  SampleAdaptively(xRange, evaluation, &params, visitor, &params);
+
   Range1D * magnitudeRange = vertical ? m_magnitudeRange.x() : m_magnitudeRange.y();
-  float yMax = pPop > 0 ? std::min(sample.max(), std::exp(pSum / pPop  + 1.f)) : sample.max();
+  float yMax = params.pPop > 0.f ? std::min(params.sample.max(), std::exp(params.pSum / params.pPop  + 1.f)) : params.sample.max();
   magnitudeRange->extend(yMax, m_maxFloat);
-  float yMin = nPop > 0 ? std::max(sample.min(), -std::exp(nSum / nPop  + 1.f)) : sample.min();
+  float yMin = params.nPop > 0.f ? std::max(params.sample.min(), -std::exp(params.nSum / params.nPop  + 1.f)) : params.sample.min();
   magnitudeRange->extend(yMin, m_maxFloat);
 }
 
@@ -238,6 +384,11 @@ void Zoom::fitBounds(Function2DWithContext<float> f, const void * model, bool ve
 
 // Zoom - Private
 
+void Zoom::SampleAdaptively(Range1D tRange, SamplesEvaluation evaluation, const void * evaluationAux, SampleVisitor visitor, void * visitorAux) {
+  AdaptiveSampler sampler(evaluation, evaluationAux, visitor, visitorAux);
+  sampler.sample(tRange);
+}
+
 Solver<float>::Interest Zoom::PointIsInteresting(Coordinate2D<float> a, Coordinate2D<float> b, Coordinate2D<float> c, const void * aux) {
   const InterestParameters * params = static_cast<const InterestParameters *>(aux);
   float slope = (c.x2() - a.x2()) / (c.x1() - a.x1());
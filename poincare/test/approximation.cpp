@@ -1,8 +1,10 @@
 #include <apps/shared/global_context.h>
 #include <poincare/constant.h>
 #include <poincare/infinity.h>
+#include <poincare/integral.h>
 #include <poincare/list_sort.h>
 #include <poincare/undefined.h>
+#include <poincare/variable_context.h>
 #include "helper.h"
 
 using namespace Poincare;
@@ -664,6 +666,42 @@ QUIZ_CASE(poincare_approximation_integral) {
   assert_expression_approximates_to<double>("int(x*sin(1/x)*√(abs(1-x)),x,0,3)", "1.9819412", Radian, MetricUnitFormat, Cartesian, 8);
 }
 
+void assert_integral_approximates_at_upper_bounds(const char * expression, const double * upperBounds, int n) {
+  Shared::GlobalContext globalContext;
+  Expression e = parse_expression(expression, &globalContext, false);
+  quiz_assert(e.type() == ExpressionNode::Type::Integral);
+  Integral integral = static_cast<Integral &>(e);
+  quiz_assert_print_if_failure(integral.isAntiderivative("x", &globalContext), expression);
+  constexpr int k_maxNumberOfUpperBounds = 8;
+  assert(n <= k_maxNumberOfUpperBounds);
+  double values[k_maxNumberOfUpperBounds];
+  integral.approximateAtUpperBounds<double>(upperBounds, values, n, ApproximationContext(&globalContext, Real, Radian));
+  for (int i = 0; i < n; i++) {
+    double expected = integral.approximateWithValueForSymbol<double>("x", upperBounds[i], &globalContext, Real, Radian);
+    quiz_assert_print_if_failure(roughly_equal(values[i], expected, 1e-9, true, 1e-12), expression);
+  }
+}
+
+void assert_integral_is_not_antiderivative(const char * expression) {
+  Shared::GlobalContext globalContext;
+  Expression e = parse_expression(expression, &globalContext, false);
+  quiz_assert(e.type() == ExpressionNode::Type::Integral);
+  quiz_assert_print_if_failure(!static_cast<Integral &>(e).isAntiderivative("x", &globalContext), expression);
+}
+
+QUIZ_CASE(poincare_approximation_integral_at_upper_bounds) {
+  const double upperBounds[] = {-2., -1.5, -1., 0., 0.25, 0.5, 3., 1.};
+  constexpr int n = sizeof(upperBounds) / sizeof(double);
+  assert_integral_approximates_at_upper_bounds("int(e^(-t^2),t,0,x)", upperBounds, n);
+  assert_integral_approximates_at_upper_bounds("int(cos(x),x,1,x)", upperBounds, n);
+  assert_integral_approximates_at_upper_bounds("int(1/√(t),t,0,x)", upperBounds, n);
+  assert_integral_approximates_at_upper_bounds("int(1/t,t,-1,x)", upperBounds, n);
+
+  assert_integral_is_not_antiderivative("int(x×t,t,0,x)");
+  assert_integral_is_not_antiderivative("int(t,t,x,1)");
+  assert_integral_is_not_antiderivative("int(t,t,0,2x)");
+}
+
 QUIZ_CASE(poincare_approximation_trigonometry_functions) {
   /* cos: R  ->  R (oscillator)
    *      Ri ->  R (even)
@@ -1363,6 +1401,7 @@ QUIZ_CASE(poincare_approximation_lists_functions) {
   assert_expression_approximates_to_scalar<double>("med({1,6,3,5,2})", 3.);
   assert_expression_approximates_to_scalar<double>("med({1,6,3,4,5,2})", 3.5);
   assert_expression_approximates_to_scalar<double>("med({1,6,3,4,5,2},{2,3,0.1,2.8,3,1})", 5.);
+  assert_expression_approximates_to<double>("med({1,2,3},{-1,2,2})", Undefined::Name());
   assert_expression_approximates_to<double>("med({1,undef,6,3,5,undef,2})", Undefined::Name());
   assert_expression_approximates_to_scalar<double>("var({1,2,3,4,5,6})", 2.916666666666666);
   assert_expression_approximates_to<double>("var({1,2,3,undef,4,5,6})", Undefined::Name());
@@ -1408,6 +1447,49 @@ QUIZ_CASE(poincare_approximation_floor_ceil_integer) {
   }
 }
 
+template<typename T>
+void assert_scalar_approximation_is_allocation_free(const char * expression, Preferences::ComplexFormat complexFormat) {
+  Shared::GlobalContext globalContext;
+  Expression e = parse_expression(expression, &globalContext, false);
+  VariableContext variableContext("x", &globalContext);
+  for (T x = static_cast<T>(-4.); x < static_cast<T>(4.); x += static_cast<T>(0.5)) {
+    variableContext.setApproximationForVariable<T>(x);
+    // Approximate through Evaluation first, then read the scalar of its result
+    T expected = e.approximate<T>(&variableContext, complexFormat, Radian).template approximateToScalar<T>(&variableContext, complexFormat, Radian);
+    uint32_t numberOfAllocations = TreePool::sharedPool()->numberOfAllocations();
+    T result = e.approximateToScalar<T>(&variableContext, complexFormat, Radian);
+    quiz_assert_print_if_failure(TreePool::sharedPool()->numberOfAllocations() == numberOfAllocations, expression);
+    quiz_assert_print_if_failure(roughly_equal(result, expected, Poincare::Float<T>::EpsilonLax(), true), expression);
+  }
+}
+
+QUIZ_CASE(poincare_approximation_scalar_without_evaluation) {
+  constexpr const char * expressions[] = {
+    "sin(x)^2+cos(x)^2",
+    "3x^3-2x+1/2",
+    "√(x)",
+    "x^(1/3)",
+    "ln(x)+log(x,2)",
+    "-x/(x-1)",
+    "e^(x)×tan(x)",
+    "abs(x)+floor(x)+arg(x)",
+    "acos(x)+asinh(x)",
+    "(2.5x+π)!",
+  };
+  for (const char * expression : expressions) {
+    assert_scalar_approximation_is_allocation_free<float>(expression, Real);
+    assert_scalar_approximation_is_allocation_free<double>(expression, Real);
+    assert_scalar_approximation_is_allocation_free<double>(expression, Cartesian);
+  }
+  // Lists, matrices and booleans fall back on Evaluation
+  assert_expression_approximates_to_scalar<double>("{1,2}", NAN);
+  assert_expression_approximates_to_scalar<double>("[[1]]", NAN);
+  assert_expression_approximates_to_scalar<double>("True", NAN);
+  assert_expression_approximates_to_scalar<double>("sum({1,2})", 3.);
+  assert_expression_approximates_to_scalar<double>("√(-1)", NAN, Radian, Real);
+  assert_expression_approximates_to_scalar<double>("im(√(-4))", 2., Radian, Cartesian);
+}
+
 QUIZ_CASE(poincare_approximation_booleans) {
   assert_expression_approximates_to<float>("True and 3<π", "True");
   assert_expression_approximates_to<float>("3>π or False", "False");
@@ -97,6 +97,8 @@ QUIZ_CASE(poincare_arithmetic_gcd) {
   assert_gcd_equals_to(Integer(-8), Integer(-40), Integer(8));
   assert_gcd_equals_to(Integer("1234567899876543456"), Integer("234567890098765445678"), Integer(2));
   assert_gcd_equals_to(Integer("45678998789"), Integer("1461727961248"), Integer("45678998789"));
+  assert_gcd_equals_to(Integer("2156273670988218211945892152344576"), Integer("443773322181230683226112"), Integer("4482558809911421042688"));
+  assert_gcd_equals_to(Integer("265252859812191058636308480000000"), Integer("3833759992447475122176"), Integer("320979616137216"));
 }
 
 QUIZ_CASE(poincare_arithmetic_lcm) {
@@ -128,12 +130,22 @@ QUIZ_CASE(poincare_arithmetic_factorization) {
   int factors5[1] = {10007};
   int coefficients5[1] = {1};
   assert_prime_factorization_equals_to(Integer(10007), factors5, coefficients5, 1);
-  int factors6[0] = {};
-  int coefficients6[0] = {};
-  assert_prime_factorization_equals_to(Integer(10007*10007), factors6, coefficients6, -2);
+  int factors6[1] = {10007};
+  int coefficients6[1] = {2};
+  assert_prime_factorization_equals_to(Integer(10007*10007), factors6, coefficients6, 1);
   int factors7[0] = {};
   int coefficients7[0] = {};
   assert_prime_factorization_equals_to(Integer(1), factors7, coefficients7, 0);
+  int factors8[3] = {70001, 1000003, 2000000011};
+  int coefficients8[3] = {2, 1, 1};
+  assert_prime_factorization_equals_to(Integer("9800309456741707715620033"), factors8, coefficients8, 3);
+  // Strong pseudoprime to all the prime bases up to 37
+  Arithmetic arithmetic;
+  quiz_assert(arithmetic.PrimeFactorization(Integer("318665857834031151167461")) == 2);
+  quiz_assert(arithmetic.factorAtIndex(0)->isEqualTo(Integer("399165290221")) && arithmetic.factorAtIndex(1)->isEqualTo(Integer("798330580441")));
+  // Mersenne prime 2^127-1
+  quiz_assert(arithmetic.PrimeFactorization(Integer("170141183460469231731687303715884105727")) == 1);
+  quiz_assert(arithmetic.coefficientAtIndex(0)->isOne());
 }
 
 QUIZ_CASE(poincare_arithmetic_divisors) {
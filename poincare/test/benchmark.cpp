@@ -0,0 +1,352 @@
+#include <apps/shared/global_context.h>
+#include <poincare/addition.h>
+#include <poincare/helpers.h>
+#include <poincare/polynomial.h>
+#include <poincare/power.h>
+#include <poincare/print_float.h>
+#include <poincare/print_int.h>
+#include <poincare/rational.h>
+#include <poincare/solver.h>
+#include <poincare/statistics_dataset.h>
+#include <poincare/symbol.h>
+#include <quiz/stopwatch.h>
+#include "helper.h"
+
+using namespace Poincare;
+
+/* Benchmarks are quiz cases printing the time they took. They are only built
+ * with POINCARE_BENCHMARKS=1. Behaviors are checked by the tests of each
+ * module. */
+
+QUIZ_CASE(poincare_benchmark_parsing) {
+  // Inputs taken from poincare/test/parsing.cpp
+  constexpr const char * expressions[] = {
+    "1+2+(3+4)",
+    "3h40min5s",
+    "5mi4yd2ft3in",
+    "arccos(1)+arcosh(1)+arccot(1)+arccsc(1)+arcsec(1)+arcsin(1)",
+    "binomial(2,1)×permute(2,1)×gcd(1,2,3)×lcm(1,2,3)",
+    "diff(diff(yb,yb,xa),xa,3)",
+    "int(1,x,2,3)+sum(1,n,2,3)+product(1,n,2,3)",
+    "piecewise(2,x<1,3)",
+    "root(1,2)+round(1,2)+randint(1,2)",
+    "normcdf(2,0,1)+invnorm(0.5,0,1)+tpdf(1,2)",
+    "sin(π)+cos(π)+tan(e)+ln(e)+log(10)",
+    "{3,4,5}+[[1,2,3][4,5,6]]",
+    "_c×_G×_hplanck×_kg×_mm×_μs×_kat×_°C",
+    "inf+undef+nonreal+true+false",
+    "xyz+abc+xa+yb+ans",
+  };
+  constexpr int numberOfRuns = 100;
+  Shared::GlobalContext context;
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int run = 0; run < numberOfRuns; run++) {
+    for (const char * expression : expressions) {
+      Expression e = Expression::Parse(expression, &context, false);
+      quiz_assert_print_if_failure(!e.isUninitialized(), expression);
+    }
+  }
+  quiz_stopwatch_print_lap(startTime);
+}
+
+QUIZ_CASE(poincare_benchmark_simplification) {
+  // Inputs taken from poincare/test/simplification.cpp
+  constexpr const char * expressions[] = {
+    "(x+1)^5",
+    "(a+b)^3×(a-b)^2",
+    "x^2+3x+2x^2-x+4-x×x",
+    "2×x^2×3×y×x^(-1)+5×x×y",
+    "√(2)+4+3×π+√(5)+2×√(5)",
+    "3^(1/2)+2^(-2×3^(1/2)×e^π)/2",
+    "√(1/(ln(2)^2-2πln(2)+π^2))",
+    "root(2^6*3^24*5^9*7^3,12)",
+    "cos(62π/21)/(π×3×sin(62π/21))",
+    "sin(x)^2+cos(x)^2+2sin(x)cos(x)",
+    "ln(2×e^3)+log(100,10)-ln(√(e))",
+    "1+(1/(1+1/(1+1/(1+1))))",
+    "321654987123456789/112233445566778899",
+    "[[1,2+i][3,4][5,6]]×[[1,2+i,3,4][5,6+i,7,8]]",
+    "det([[1,2,3][4π,5,6][7,8,9]])",
+    "inverse([[π,2×π][3,2]])",
+    "_kg×_m^2×_s^(-2)×_A^(-1)",
+    "1_m+π_m+√(2)_m-cos(15)_m",
+  };
+  constexpr int numberOfRuns = 10;
+  Shared::GlobalContext context;
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int run = 0; run < numberOfRuns; run++) {
+    for (const char * expression : expressions) {
+      Expression e = parse_expression(expression, &context, false);
+      e = e.cloneAndSimplify(ReductionContext(&context, Cartesian, Radian, MetricUnitFormat, User));
+      quiz_assert_print_if_failure(!e.isUninitialized(), expression);
+    }
+  }
+  quiz_stopwatch_print_lap(startTime);
+}
+
+QUIZ_CASE(poincare_benchmark_tree_pool_moves) {
+  /* Shuffle the terms of a sum, as the reduction does when sorting operands,
+   * while other expressions occupy the rest of the pool. */
+  constexpr int numberOfTerms = 100;
+  constexpr int numberOfSwaps = 20000;
+  constexpr const char * otherExpressions[] = {
+    "[[1,2+i][3,4][5,6]]×[[1,2+i,3,4][5,6+i,7,8]]",
+    "int(1,x,2,3)+sum(1,n,2,3)+product(1,n,2,3)",
+    "arccos(1)+arcosh(1)+arccot(1)+arccsc(1)+arcsec(1)+arcsin(1)",
+    "normcdf(2,0,1)+invnorm(0.5,0,1)+tpdf(1,2)",
+  };
+  Shared::GlobalContext context;
+  Addition sum = Addition::Builder();
+  for (int i = 0; i < numberOfTerms; i++) {
+    Expression term = Rational::Builder(i);
+    if (i % 3 == 0) {
+      term = Power::Builder(Symbol::Builder('x'), term);
+    }
+    sum.addChildAtIndexInPlace(term, i, i);
+  }
+  Expression others[sizeof(otherExpressions) / sizeof(const char *)];
+  for (size_t i = 0; i < sizeof(otherExpressions) / sizeof(const char *); i++) {
+    others[i] = parse_expression(otherExpressions[i], &context, false);
+  }
+  uint32_t seed = 1;
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int i = 0; i < numberOfSwaps; i++) {
+    seed = seed * 1103515245 + 12345;
+    sum.swapChildrenInPlace((seed >> 8) % numberOfTerms, (seed >> 20) % numberOfTerms);
+  }
+  quiz_stopwatch_print_lap(startTime);
+  quiz_assert(sum.numberOfChildren() == numberOfTerms);
+}
+
+QUIZ_CASE(poincare_benchmark_big_rationals) {
+  constexpr const char * expressions[] = {
+    "150!",
+    "100!/(50!×50!)",
+    "binomial(200,100)",
+    "permute(150,70)",
+    "3^500/7^300",
+    "(123456789/987654321)^25",
+    "170!/(2^300×3^100)",
+    "gcd(120!,2^200×3^150)",
+    "lcm(97!,2^300)",
+  };
+  constexpr int numberOfRuns = 50;
+  Shared::GlobalContext context;
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int run = 0; run < numberOfRuns; run++) {
+    for (const char * expression : expressions) {
+      Expression e = parse_expression(expression, &context, false);
+      e = e.cloneAndSimplify(ReductionContext(&context, Cartesian, Radian, MetricUnitFormat, User));
+      quiz_assert_print_if_failure(!e.isUninitialized(), expression);
+    }
+  }
+  quiz_stopwatch_print_lap(startTime);
+}
+
+QUIZ_CASE(poincare_benchmark_exact_matrices) {
+  constexpr const char * expressions[] = {
+    "det([[-65,46,96,-83,-34][-69,27,95,16,21][67,-2,-46,-75,25][-92,0,11,56,96][97,-99,79,15,-31]])",
+    "inverse([[-65,46,96,-83,-34][-69,27,95,16,21][67,-2,-46,-75,25][-92,0,11,56,96][97,-99,79,15,-31]])",
+    "rref([[3,1/2,-7,4,0,2][1,-5,2/3,8,1,0][-2,4,1,1/7,3,5][6,0,-1,2,9,-4]])",
+    "inverse([[1,1/2,1/3,1/4,1/5][1/2,1/3,1/4,1/5,1/6][1/3,1/4,1/5,1/6,1/7][1/4,1/5,1/6,1/7,1/8][1/5,1/6,1/7,1/8,1/9]])",
+  };
+  constexpr int numberOfRuns = 10;
+  Shared::GlobalContext context;
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int run = 0; run < numberOfRuns; run++) {
+    for (const char * expression : expressions) {
+      Expression e = parse_expression(expression, &context, false);
+      e = e.cloneAndSimplify(ReductionContext(&context, Cartesian, Radian, MetricUnitFormat, User));
+      quiz_assert_print_if_failure(!e.isUninitialized(), expression);
+    }
+  }
+  quiz_stopwatch_print_lap(startTime);
+}
+
+QUIZ_CASE(poincare_benchmark_factor) {
+  constexpr const char * expressions[] = {
+    "factor(1002101470343)",
+    "factor(12000000097000000133)",
+    "factor(99999999100000001881)",
+    "factor(10000000000000000051)",
+    "factor(2^64-1)",
+    "factor(10^20+1)",
+  };
+  Shared::GlobalContext context;
+  uint64_t startTime = quiz_stopwatch_start();
+  for (const char * expression : expressions) {
+    Expression e = parse_expression(expression, &context, false);
+    e = e.cloneAndSimplify(ReductionContext(&context, Cartesian, Radian, MetricUnitFormat, User));
+    quiz_assert_print_if_failure(!e.isUninitialized(), expression);
+  }
+  quiz_stopwatch_print_lap(startTime);
+}
+
+QUIZ_CASE(poincare_benchmark_scalar_approximation) {
+  constexpr const char * expressions[] = {
+    "sin(x)^2+cos(x)^2",
+    "3x^3-2x+1/2",
+    "ln(x)×√(x)/(x+1)",
+    "x^(1/3)+e^(-x)",
+  };
+  constexpr int numberOfPoints = 2000;
+  Shared::GlobalContext context;
+  uint64_t startTime = quiz_stopwatch_start();
+  for (const char * expression : expressions) {
+    Expression e = parse_expression(expression, &context, false);
+    for (int i = 0; i < numberOfPoints; i++) {
+      e.approximateWithValueForSymbol<double>("x", 0.01 * i, &context, Real, Radian);
+    }
+  }
+  quiz_stopwatch_print_lap(startTime);
+}
+
+QUIZ_CASE(poincare_benchmark_stored_symbols_approximation) {
+  // As in a values table of a function using stored variables
+  constexpr int numberOfPoints = 2000;
+  Shared::GlobalContext context;
+  Symbol a = Symbol::Builder('a');
+  Symbol b = Symbol::Builder('b');
+  context.setExpressionForSymbolAbstract(Rational::Builder(3, 7), a);
+  context.setExpressionForSymbolAbstract(parse_expression("√(2)+1/3", &context, false), b);
+  Expression e = parse_expression("a×x^2+b×x", &context, false);
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int i = 0; i < numberOfPoints; i++) {
+    e.approximateWithValueForSymbol<double>("x", 0.01 * i, &context, Real, Radian);
+  }
+  quiz_stopwatch_print_lap(startTime);
+  Ion::Storage::FileSystem::sharedFileSystem()->recordNamed("a.exp").destroy();
+  Ion::Storage::FileSystem::sharedFileSystem()->recordNamed("b.exp").destroy();
+}
+
+QUIZ_CASE(poincare_benchmark_polynomial_roots) {
+  // Interval sweep first, then simultaneous approximation of all the roots
+  constexpr const char * polynomial = "x^8-36x^7+546x^6-4536x^5+22449x^4-67284x^3+118123x^2-109584x+40320";
+  constexpr int numberOfRuns = 10;
+  Shared::GlobalContext context;
+  Expression e = parse_expression(polynomial, &context, false).cloneAndReduce(ReductionContext(&context, Real, Radian, MetricUnitFormat, SystemForApproximation));
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int run = 0; run < numberOfRuns; run++) {
+    Solver<double> solver(-10., 10., "x", &context, Real, Radian);
+    while (std::isfinite(solver.nextRoot(e).x1())) {}
+  }
+  quiz_stopwatch_print_lap(startTime);
+  startTime = quiz_stopwatch_start();
+  for (int run = 0; run < numberOfRuns; run++) {
+    double coefficients[Polynomial::k_maxApproximatedDegree + 1];
+    double roots[Polynomial::k_maxApproximatedDegree];
+    int degree = Polynomial::ApproximateCoefficients(e, "x", coefficients, &context, Real, Radian);
+    quiz_assert(Polynomial::ApproximateRealRoots(coefficients, degree, roots) == 8);
+  }
+  quiz_stopwatch_print_lap(startTime);
+}
+
+QUIZ_CASE(poincare_benchmark_print_float) {
+  // Values spread over many orders of magnitude, as in a values table
+  constexpr int numberOfValues = 100000;
+  char buffer[PrintFloat::k_maxFloatCharSize];
+  uint32_t seed = 1;
+  for (Preferences::PrintFloatMode mode : {Preferences::PrintFloatMode::Decimal, Preferences::PrintFloatMode::Scientific}) {
+    uint64_t startTime = quiz_stopwatch_start();
+    for (int i = 0; i < numberOfValues; i++) {
+      seed = seed * 1103515245 + 12345;
+      double value = static_cast<double>(seed) / (1 + (seed >> 24)) * std::pow(10.0, static_cast<int>(seed % 17) - 8);
+      PrintFloat::ConvertFloatToText<double>(value, buffer, PrintFloat::k_maxFloatCharSize, PrintFloat::k_maxFloatGlyphLength, PrintFloat::k_numberOfStoredSignificantDigits, mode);
+      PrintFloat::ConvertFloatToText<float>(value, buffer, PrintFloat::k_maxFloatCharSize, PrintFloat::k_maxFloatGlyphLength, PrintFloat::k_floatNumberOfSignificantDigits, mode);
+    }
+    quiz_stopwatch_print_lap(startTime);
+  }
+}
+
+QUIZ_CASE(poincare_benchmark_sort) {
+  constexpr int numberOfSizes = 3;
+  constexpr int sizes[numberOfSizes] = {100, 1000, 10000};
+  static int values[10000];
+  for (int size : sizes) {
+    uint32_t seed = 1;
+    for (int i = 0; i < size; i++) {
+      seed = seed * 1103515245 + 12345;
+      values[i] = (seed >> 16) % size;
+    }
+    uint64_t startTime = quiz_stopwatch_start();
+    Helpers::Sort(
+        [](int i, int j, void * context, int n) {
+          int * v = static_cast<int *>(context);
+          int t = v[i];
+          v[i] = v[j];
+          v[j] = t;
+        },
+        [](int i, int j, void * context, int n) {
+          int * v = static_cast<int *>(context);
+          return v[i] >= v[j];
+        },
+        values,
+        size);
+    quiz_stopwatch_print_lap(startTime);
+  }
+}
+
+QUIZ_CASE(poincare_benchmark_list_sort) {
+  /* Sort lists as the calculation app does. The pool cannot hold lists much
+   * longer than a few hundred elements. */
+  constexpr int numberOfSizes = 2;
+  constexpr int sizes[numberOfSizes] = {100, 400};
+  constexpr int bufferSize = 4096;
+  char buffer[bufferSize];
+  Shared::GlobalContext context;
+  for (int size : sizes) {
+    int length = strlcpy(buffer, "sort({", bufferSize);
+    uint32_t seed = 1;
+    for (int i = 0; i < size; i++) {
+      seed = seed * 1103515245 + 12345;
+      length += PrintInt::Left((seed >> 16) % 1000, buffer + length, bufferSize - length);
+      buffer[length++] = i < size - 1 ? ',' : '}';
+    }
+    strlcpy(buffer + length, ")", bufferSize - length);
+    Expression e = parse_expression(buffer, &context, false);
+    uint64_t startTime = quiz_stopwatch_start();
+    e = e.cloneAndSimplify(ReductionContext(&context, Cartesian, Radian, MetricUnitFormat, User));
+    quiz_stopwatch_print_lap(startTime);
+    quiz_assert(e.type() == ExpressionNode::Type::List && e.numberOfChildren() == size);
+  }
+}
+
+QUIZ_CASE(poincare_benchmark_statistics_dataset) {
+  // A full column of the statistics app, with integer frequencies
+  constexpr int datasetLength = 100;
+  constexpr int numberOfRuns = 50;
+  FloatList<double> values = FloatList<double>::Builder();
+  FloatList<double> weights = FloatList<double>::Builder();
+  uint32_t seed = 1;
+  for (int i = 0; i < datasetLength; i++) {
+    seed = seed * 1103515245 + 12345;
+    values.addValueAtIndex((seed >> 16) % 1000, i);
+    weights.addValueAtIndex(1 + (seed >> 8) % 3, i);
+  }
+  // Median of a new dataset
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int run = 0; run < numberOfRuns; run++) {
+    StatisticsDataset<double> dataset(&values, &weights);
+    dataset.median();
+  }
+  quiz_stopwatch_print_lap(startTime);
+  // Quartiles after editing a single value
+  StatisticsDataset<double> dataset(&values, &weights);
+  for (bool incrementalUpdate : {false, true}) {
+    startTime = quiz_stopwatch_start();
+    for (int run = 0; run < numberOfRuns; run++) {
+      seed = seed * 1103515245 + 12345;
+      int index = (seed >> 16) % datasetLength;
+      values.replaceValueAtIndex((seed >> 8) % 1000, index);
+      if (incrementalUpdate) {
+        dataset.setValueHasBeenModified(index);
+      } else {
+        dataset.setHasBeenModified();
+      }
+      dataset.sortedElementAtCumulatedFrequency(0.25, false);
+      dataset.median();
+      dataset.sortedElementAtCumulatedFrequency(0.75, false);
+    }
+    quiz_stopwatch_print_lap(startTime);
+  }
+}
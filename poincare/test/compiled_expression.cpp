@@ -0,0 +1,211 @@
+#include "helper.h"
+#include <apps/shared/global_context.h>
+#include <poincare/compiled_expression.h>
+
+using namespace Poincare;
+
+template<typename T>
+static bool identical(T a, T b) {
+  return (std::isnan(a) && std::isnan(b)) || a == b;
+}
+
+void assert_compiles_and_approximates_like_tree(const char * expression, Preferences::ComplexFormat complexFormat = Real, Preferences::AngleUnit angleUnit = Radian) {
+  Shared::GlobalContext context;
+  Expression e = parse_expression(expression, &context, false).cloneAndReduce(ReductionContext(&context, complexFormat, angleUnit, MetricUnitFormat, SystemForApproximation));
+  CompiledExpression compiledExpression;
+  quiz_assert_print_if_failure(compiledExpression.compile(e, "x", &context, complexFormat, angleUnit), expression);
+  quiz_assert_print_if_failure(!compiledExpression.needsCompilationFor(complexFormat, angleUnit), expression);
+  constexpr double values[] = {-3.7, -2.0, -1.0, -0.5, -0.0, 0.0, 0.25, 1.0, 1.5, 2.0, 3.0, 10.0, 1e10, NAN, INFINITY};
+  for (double x : values) {
+    quiz_assert_print_if_failure(identical(compiledExpression.approximateWithValue<double>(x), e.approximateWithValueForSymbol<double>("x", x, &context, complexFormat, angleUnit)), expression);
+    quiz_assert_print_if_failure(identical(compiledExpression.approximateWithValue<float>(x), e.approximateWithValueForSymbol<float>("x", x, &context, complexFormat, angleUnit)), expression);
+  }
+
+  // Batches take different paths through the program
+  constexpr int numberOfValues = sizeof(values) / sizeof(double);
+  constexpr int batchSize = 2 * CompiledExpression::k_batchSize + 3;
+  double xs[batchSize];
+  float xsFloat[batchSize];
+  for (int i = 0; i < batchSize; i++) {
+    xs[i] = values[(7 * i) % numberOfValues];
+    xsFloat[i] = xs[i];
+  }
+  double ys[batchSize];
+  float ysFloat[batchSize];
+  compiledExpression.approximateBatch(xs, ys, batchSize);
+  compiledExpression.approximateBatch(xsFloat, ysFloat, batchSize);
+  for (int i = 0; i < batchSize; i++) {
+    quiz_assert_print_if_failure(identical(ys[i], compiledExpression.approximateWithValue<double>(xs[i])), expression);
+    quiz_assert_print_if_failure(identical(ysFloat[i], compiledExpression.approximateWithValue<float>(xsFloat[i])), expression);
+  }
+  e.approximateBatch("x", xs, ys, batchSize, &context, complexFormat, angleUnit);
+  for (int i = 0; i < batchSize; i++) {
+    quiz_assert_print_if_failure(identical(ys[i], e.approximateWithValueForSymbol<double>("x", xs[i], &context, complexFormat, angleUnit)), expression);
+  }
+}
+
+void assert_does_not_compile(const char * expression, Preferences::ComplexFormat complexFormat = Real) {
+  Shared::GlobalContext context;
+  Expression e = parse_expression(expression, &context, false).cloneAndReduce(ReductionContext(&context, complexFormat, Radian, MetricUnitFormat, SystemForApproximation));
+  CompiledExpression compiledExpression;
+  quiz_assert_print_if_failure(!compiledExpression.compile(e, "x", &context, complexFormat, Radian), expression);
+  quiz_assert_print_if_failure(!compiledExpression.isCompiled(), expression);
+  // A failed compilation is not retried
+  quiz_assert_print_if_failure(!compiledExpression.needsCompilationFor(complexFormat, Radian), expression);
+  quiz_assert_print_if_failure(compiledExpression.needsCompilationFor(complexFormat, Degree), expression);
+  if (!e.recursivelyMatches(Expression::IsRandom, &context)) {
+    // Batches fall back on the tree approximation
+    float xs[] = {-1.0f, 0.5f, 2.0f};
+    float ys[3];
+    e.approximateBatch("x", xs, ys, 3, &context, complexFormat, Radian);
+    for (int i = 0; i < 3; i++) {
+      quiz_assert_print_if_failure(identical(ys[i], e.approximateWithValueForSymbol<float>("x", xs[i], &context, complexFormat, Radian)), expression);
+    }
+  }
+}
+
+QUIZ_CASE(poincare_compiled_expression_approximation) {
+  assert_compiles_and_approximates_like_tree("x");
+  assert_compiles_and_approximates_like_tree("-x");
+  assert_compiles_and_approximates_like_tree("3");
+  assert_compiles_and_approximates_like_tree("undef");
+  assert_compiles_and_approximates_like_tree("x^2-3x+2");
+  assert_compiles_and_approximates_like_tree("2x^3-x/7+π");
+  assert_compiles_and_approximates_like_tree("1/x");
+  assert_compiles_and_approximates_like_tree("x^(1/3)");
+  assert_compiles_and_approximates_like_tree("x^(2/3)", Cartesian);
+  assert_compiles_and_approximates_like_tree("√(x)");
+  assert_compiles_and_approximates_like_tree("√(x)", Cartesian);
+  assert_compiles_and_approximates_like_tree("ln(x)");
+  assert_compiles_and_approximates_like_tree("log(x)", Polar);
+  assert_compiles_and_approximates_like_tree("e^(-x^2)");
+  assert_compiles_and_approximates_like_tree("sin(x)+cos(2x)");
+  assert_compiles_and_approximates_like_tree("tan(x)", Real, Degree);
+  assert_compiles_and_approximates_like_tree("arcsin(x)", Cartesian, Gradian);
+  assert_compiles_and_approximates_like_tree("sinh(x)/cosh(x)");
+  assert_compiles_and_approximates_like_tree("floor(x)+ceil(x)-frac(x)");
+  assert_compiles_and_approximates_like_tree("abs(x-1)*sign(x)");
+  assert_compiles_and_approximates_like_tree("x!");
+  assert_compiles_and_approximates_like_tree("re(√(x))+im(√(x))", Cartesian);
+  assert_compiles_and_approximates_like_tree("arg(x)", Cartesian);
+  assert_compiles_and_approximates_like_tree("ln(x)+ln(-x)");
+  assert_compiles_and_approximates_like_tree("piecewise(-x,x<0,x)");
+  assert_compiles_and_approximates_like_tree("piecewise(1,x≤1,2,x>1.5)");
+  assert_compiles_and_approximates_like_tree("piecewise(√(x-2),x≥2,√(-x),x!=3)");
+  assert_compiles_and_approximates_like_tree("int(t^2,t,0,2)x");
+  assert_compiles_and_approximates_like_tree("sum(1/k,k,1,5)+x");
+}
+
+QUIZ_CASE(poincare_compiled_expression_fallback) {
+  assert_does_not_compile("random()*x");
+  assert_does_not_compile("{1,2}*x");
+  assert_does_not_compile("[[x,1]]");
+  assert_does_not_compile("a*x");
+  assert_does_not_compile("int(t*x,t,0,1)");
+  assert_does_not_compile("x<3");
+  assert_does_not_compile("round(x,2)");
+}
+
+void assert_derivatives_are(const char * expression, double x, const double * expectedDerivatives, int order) {
+  Shared::GlobalContext context;
+  Expression e = parse_expression(expression, &context, false);
+  CompiledExpression compiledExpression;
+  quiz_assert_print_if_failure(compiledExpression.compile(e, "x", &context, Real, Radian), expression);
+  double derivatives[CompiledExpression::k_maxDerivativeOrder + 1];
+  bool isDifferentiable = compiledExpression.approximateDerivatives(x, order, derivatives);
+  quiz_assert_print_if_failure(isDifferentiable == (expectedDerivatives != nullptr), expression);
+  for (int k = 0; isDifferentiable && k <= order; k++) {
+    quiz_assert_print_if_failure(roughly_equal(derivatives[k], expectedDerivatives[k], 1e-12), expression);
+  }
+}
+
+QUIZ_CASE(poincare_compiled_expression_derivatives) {
+  constexpr double polynomial[] = {7.0, 0.0, -8.0, 6.0, 0.0};
+  assert_derivatives_are("x^3-x^2-5x+4", -1.0, polynomial, 4);
+  constexpr double exponential[] = {1.0, 2.0, 4.0, 8.0, 16.0};
+  assert_derivatives_are("e^(2x)", 0.0, exponential, 4);
+  constexpr double sine[] = {0.0, 1.0, 0.0, -1.0};
+  assert_derivatives_are("sin(x)", 0.0, sine, 3);
+  constexpr double inverse[] = {0.5, -0.25, 0.25};
+  assert_derivatives_are("1/x", 2.0, inverse, 2);
+  constexpr double logarithm[] = {0.0, 1.0, -1.0};
+  assert_derivatives_are("ln(x)", 1.0, logarithm, 2);
+  constexpr double arcTangent[] = {M_PI / 4.0, 0.5, -0.5};
+  assert_derivatives_are("atan(x)", 1.0, arcTangent, 2);
+  constexpr double power[] = {4.0, 4.0 + 4.0 * M_LN2};
+  assert_derivatives_are("x^x", 2.0, power, 1);
+  constexpr double cubeRoot[] = {2.0, 1.0 / 12.0};
+  assert_derivatives_are("x^(1/3)", 8.0, cubeRoot, 1);
+  // Not smooth, undefined or not real
+  assert_derivatives_are("abs(x)", 0.0, nullptr, 1);
+  assert_derivatives_are("floor(x)", 0.5, nullptr, 1);
+  assert_derivatives_are("piecewise(x,x>0,-x)", 1.0, nullptr, 1);
+  assert_derivatives_are("√(x)", 0.0, nullptr, 1);
+  assert_derivatives_are("ln(x)", -1.0, nullptr, 1);
+  assert_derivatives_are("1/x", 0.0, nullptr, 1);
+}
+
+template<typename T>
+void assert_enclosure_is(const char * expression, T xMin, T xMax, bool isContinuous, Preferences::AngleUnit angleUnit = Radian) {
+  Shared::GlobalContext context;
+  Expression e = parse_expression(expression, &context, false).cloneAndReduce(ReductionContext(&context, Real, angleUnit, MetricUnitFormat, SystemForApproximation));
+  CompiledExpression compiledExpression;
+  quiz_assert_print_if_failure(compiledExpression.compile(e, "x", &context, Real, angleUnit), expression);
+  CompiledExpression::Enclosure<T> enclosure;
+  quiz_assert_print_if_failure(compiledExpression.approximateOnInterval(xMin, xMax, &enclosure), expression);
+  quiz_assert_print_if_failure(enclosure.isContinuous == isContinuous, expression);
+  if (!isContinuous) {
+    return;
+  }
+  // The enclosure contains the values of the tree, up to rounding errors
+  constexpr int numberOfSamples = 100;
+  T tolerance = 100 * Float<T>::Epsilon() * std::max(static_cast<T>(1.0), std::max(std::fabs(enclosure.min), std::fabs(enclosure.max)));
+  for (int i = 0; i <= numberOfSamples; i++) {
+    T x = xMin + (xMax - xMin) * i / numberOfSamples;
+    T y = e.approximateWithValueForSymbol<T>("x", x, &context, Real, angleUnit);
+    quiz_assert_print_if_failure(enclosure.min - tolerance <= y && y <= enclosure.max + tolerance, expression);
+  }
+}
+
+QUIZ_CASE(poincare_compiled_expression_enclosure) {
+  assert_enclosure_is<double>("x^2-3x+2", -1.0, 4.0, true);
+  assert_enclosure_is<float>("x^2-3x+2", -1.0f, 4.0f, true);
+  assert_enclosure_is<double>("1/x", 0.5, 2.0, true);
+  assert_enclosure_is<double>("x^(1/3)", -8.0, 8.0, true);
+  assert_enclosure_is<double>("x^(2/3)", -8.0, 1.0, true);
+  assert_enclosure_is<double>("e^(-x^2)", -2.0, 3.0, true);
+  assert_enclosure_is<double>("x^x", 0.5, 2.0, true);
+  assert_enclosure_is<double>("sin(x)+cos(2x)", -1.0, 5.0, true);
+  assert_enclosure_is<float>("sin(x)+cos(2x)", -1.0f, 5.0f, true);
+  assert_enclosure_is<double>("tan(x)", -1.0, 1.0, true);
+  assert_enclosure_is<double>("tan(x)", 100.0, 170.0, true, Degree);
+  assert_enclosure_is<double>("atan(x)+arcsin(x/2)", -1.0, 1.0, true);
+  assert_enclosure_is<double>("cosh(x)-sinh(x)", -1.0, 2.0, true);
+  assert_enclosure_is<double>("ln(x)", 0.1, 10.0, true);
+  assert_enclosure_is<double>("√(x)", 0.0, 4.0, true);
+  assert_enclosure_is<double>("abs(x-1)", -3.0, 0.5, true);
+  assert_enclosure_is<double>("floor(x)", 1.2, 1.8, true);
+  assert_enclosure_is<double>("frac(x)", 2.1, 2.9, true);
+  assert_enclosure_is<double>("piecewise(-x,x<0,x)", 1.0, 2.0, true);
+  assert_enclosure_is<double>("piecewise(-x,x<0,x)", -2.0, -1.0, true);
+  // Asymptotes, jumps and domain boundaries
+  assert_enclosure_is<double>("1/x", -1.0, 1.0, false);
+  assert_enclosure_is<double>("tan(x)", 1.0, 2.0, false);
+  assert_enclosure_is<double>("tan(x)", 80.0, 100.0, false, Degree);
+  assert_enclosure_is<double>("√(x)", -1.0, 1.0, false);
+  assert_enclosure_is<double>("ln(x)", -1.0, 1.0, false);
+  assert_enclosure_is<double>("sign(x)", -1.0, 1.0, false);
+  assert_enclosure_is<double>("floor(x)", 0.5, 1.5, false);
+  assert_enclosure_is<double>("frac(x)", 0.5, 1.5, false);
+  assert_enclosure_is<float>("frac(x)", 0.5f, 1.5f, false);
+  assert_enclosure_is<double>("piecewise(-x,x<0,x)", -1.0, 1.0, false);
+  // Undefined on the whole interval
+  assert_enclosure_is<double>("√(-x-1)", 0.0, 1.0, false);
+  assert_enclosure_is<double>("x!", 0.2, 0.8, false);
+
+  Shared::GlobalContext context;
+  CompiledExpression compiledExpression;
+  quiz_assert(compiledExpression.compile(parse_expression("√(x)", &context, false), "x", &context, Cartesian, Radian));
+  CompiledExpression::Enclosure<double> enclosure;
+  quiz_assert(!compiledExpression.approximateOnInterval(-1.0, 1.0, &enclosure));
+}
@@ -1,9 +1,11 @@
 #include <apps/shared/global_context.h>
 #include <poincare/addition.h>
+#include <poincare/cosine.h>
 #include <poincare/rational.h>
 #include <poincare/serialization_helper.h>
 #include <poincare/subtraction.h>
 #include <poincare/undefined.h>
+#include <poincare/variable_context.h>
 #include "helper.h"
 
 using namespace Poincare;
@@ -218,5 +220,40 @@ QUIZ_CASE(poincare_context_function_evaluate_at_undef) {
   Ion::Storage::FileSystem::sharedFileSystem()->recordNamed("g.func").destroy();
 }
 
+QUIZ_CASE(poincare_context_approximable_node_for_symbol) {
+  Shared::GlobalContext context;
+  /* Stored expressions are read in place when they are aligned. Successive
+   * records with names one character longer shift the expression by one
+   * byte, so that one name in ByteAlignment is aligned. */
+  constexpr const char * names[] = {"a", "ab", "abc", "abcd", "abcde", "abcdef", "abcdefg", "abcdefgh"};
+  int numberOfNodesReadInPlace = 0;
+  for (const char * name : names) {
+    Symbol symbol = Symbol::Builder(name, strlen(name));
+    quiz_assert(context.setExpressionForSymbolAbstract(Rational::Builder(3), symbol));
+    const ExpressionNode * node = context.approximableNodeForSymbol(symbol);
+    if (node) {
+      quiz_assert(node->type() == ExpressionNode::Type::Rational);
+      numberOfNodesReadInPlace++;
+    }
+    quiz_assert(Addition::Builder(symbol, Rational::Builder(1)).approximateToScalar<double>(&context, Cartesian, Radian) == 4.);
+    Ion::Storage::FileSystem::sharedFileSystem()->recordBaseNamedWithExtension(name, Ion::Storage::expExtension).destroy();
+  }
+  quiz_assert(numberOfNodesReadInPlace == 8 / ByteAlignment);
+
+  // Expressions needing the context are copied
+  Symbol a = Symbol::Builder('a');
+  quiz_assert(context.setExpressionForSymbolAbstract(Cosine::Builder(Rational::Builder(2)), a));
+  quiz_assert(context.approximableNodeForSymbol(a) == nullptr);
+  assert_roughly_equal(a.approximateToScalar<double>(&context, Cartesian, Radian), std::cos(2.));
+  Ion::Storage::FileSystem::sharedFileSystem()->recordNamed("a.exp").destroy();
+
+  // Variables are read from the pool
+  VariableContext variableContext("t", &context);
+  variableContext.setApproximationForVariable<double>(2.);
+  const ExpressionNode * t = variableContext.approximableNodeForSymbol(Symbol::Builder('t'));
+  quiz_assert(t && t->type() == ExpressionNode::Type::Double);
+  quiz_assert(variableContext.approximableNodeForSymbol(a) == nullptr);
+}
+
 template void assert_parsed_expression_approximates_with_value_for_symbol(Poincare::Expression, const char *, float, float, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit);
 template void assert_parsed_expression_approximates_with_value_for_symbol(Poincare::Expression, const char *, double, double, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit);
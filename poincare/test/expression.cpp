@@ -128,3 +128,33 @@ QUIZ_CASE(poincare_expression_generalization) {
   assert_generalizes_to_and_extract("√(e+tan(e^(e^(π^4))))", "√(e+tan(e^(e^(x^4))))", M_PI);
   assert_generalizes_to_and_extract("abs(i+3)", "abs(i+x)", 3.f);
 }
+
+QUIZ_CASE(poincare_expression_swap_children_in_place) {
+  /* Shuffle the terms of a sum, as the reduction does when sorting operands,
+   * and undo the swaps in reverse order. */
+  constexpr int numberOfTerms = 30;
+  constexpr int numberOfSwaps = 200;
+  Addition sum = Addition::Builder();
+  for (int i = 0; i < numberOfTerms; i++) {
+    Expression term = Rational::Builder(i);
+    if (i % 3 == 0) {
+      term = Power::Builder(Symbol::Builder('x'), term);
+    }
+    sum.addChildAtIndexInPlace(term, i, i);
+  }
+  Expression reference = sum.clone();
+  int swaps[numberOfSwaps][2];
+  uint32_t seed = 1;
+  for (int i = 0; i < numberOfSwaps; i++) {
+    seed = seed * 1103515245 + 12345;
+    swaps[i][0] = (seed >> 8) % numberOfTerms;
+    swaps[i][1] = (seed >> 20) % numberOfTerms;
+    sum.swapChildrenInPlace(swaps[i][0], swaps[i][1]);
+  }
+  quiz_assert(sum.numberOfChildren() == numberOfTerms);
+  quiz_assert(!sum.isIdenticalTo(reference));
+  for (int i = numberOfSwaps - 1; i >= 0; i--) {
+    sum.swapChildrenInPlace(swaps[i][0], swaps[i][1]);
+  }
+  quiz_assert(sum.isIdenticalTo(reference));
+}
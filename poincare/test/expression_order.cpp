@@ -226,3 +226,29 @@ QUIZ_CASE(poincare_expression_order_addition_multiplication) {
     assert_multiplication_or_addition_is_ordered_as(e1, e2);
   }
 }
+
+QUIZ_CASE(poincare_expression_order_identical) {
+  // Trees edited in place after being compared
+  Addition a1 = Addition::Builder(Symbol::Builder('x'), Symbol::Builder('y'));
+  Addition a2 = Addition::Builder(Symbol::Builder('x'), Symbol::Builder('z'));
+  Expression e1 = Multiplication::Builder(Rational::Builder(2), a1);
+  Expression e2 = Multiplication::Builder(Rational::Builder(2), a2);
+  quiz_assert(!e1.isIdenticalTo(e2));
+  a2.replaceChildAtIndexInPlace(1, Symbol::Builder('y'));
+  quiz_assert(e1.isIdenticalTo(e2));
+  a1.addChildAtIndexInPlace(Symbol::Builder('z'), 2, 2);
+  quiz_assert(!e1.isIdenticalTo(e2));
+  a1.removeChildAtIndexInPlace(2);
+  quiz_assert(e1.isIdenticalTo(e2));
+  // x^1 and unary operations are ordered as x
+  Expression x = Symbol::Builder('x');
+  Rational r = Rational::Builder(-1);
+  Expression p = Power::Builder(Symbol::Builder('x'), r);
+  quiz_assert(!p.isIdenticalTo(x));
+  r.setSign(true);
+  quiz_assert(p.isIdenticalTo(x));
+  quiz_assert(Multiplication::Builder(Symbol::Builder('x')).isIdenticalTo(x));
+  quiz_assert(Addition::Builder(Power::Builder(Symbol::Builder('x'), Rational::Builder(1))).isIdenticalTo(x));
+  // Functions are compared by name
+  quiz_assert(Function::Builder("f", 1, Symbol::Builder('x')).isIdenticalTo(Function::Builder("f", 1, Rational::Builder(2))));
+}
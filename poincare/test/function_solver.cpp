@@ -59,6 +59,48 @@ void assert_intersections_are(const char * expression1, const char * expression2
   assert_solutions_are(expression1, start, end, expected, Interest::Intersection, angleUnit, expression2);
 }
 
+struct VisitedSolutions {
+  constexpr static int k_maxNumberOfSolutions = 16;
+  Coordinate2D<double> solutions[k_maxNumberOfSolutions];
+  Interest interests[k_maxNumberOfSolutions];
+  int numberOfSolutions;
+};
+
+void visit_solution(Coordinate2D<double> solution, Interest interest, void * aux) {
+  VisitedSolutions * visited = static_cast<VisitedSolutions *>(aux);
+  assert(visited->numberOfSolutions < VisitedSolutions::k_maxNumberOfSolutions);
+  visited->solutions[visited->numberOfSolutions] = solution;
+  visited->interests[visited->numberOfSolutions] = interest;
+  visited->numberOfSolutions++;
+}
+
+void assert_roots_and_extrema_are_visited(const char * expression, double start, double end, Preferences::AngleUnit angleUnit = Degree) {
+  Shared::GlobalContext context;
+  Expression e = parse_expression(expression, &context, false);
+  Solver<double> solver(start, end, "x", &context, Real, angleUnit);
+  quiz_assert_print_if_failure(solver.canVisitRoots(e), expression);
+  VisitedSolutions visited;
+  visited.numberOfSolutions = 0;
+  solver.visitRootsAndExtrema(e, true, true, visit_solution, &visited);
+
+  // The single sweep finds the solutions of the separate ones
+  constexpr double relativePrecision = 2. * Helpers::SquareRoot(2. * Float<double>::Epsilon());
+  int numberOfSolutions = 0;
+  for (Interest interest : { Interest::Root, Interest::LocalMinimum, Interest::LocalMaximum }) {
+    Solver<double> separateSolver(start, end, "x", &context, Real, angleUnit);
+    Coordinate2D<double> solution;
+    while (std::isfinite((solution = interest == Interest::Root ? separateSolver.nextRoot(e) : interest == Interest::LocalMinimum ? separateSolver.nextMinimum(e) : separateSolver.nextMaximum(e)).x1())) { // assignment in condition
+      numberOfSolutions++;
+      bool found = false;
+      for (int i = 0; i < visited.numberOfSolutions; i++) {
+        found = found || (visited.interests[i] == interest && Helpers::RelativelyEqual(visited.solutions[i].x1(), solution.x1(), relativePrecision) && Helpers::RelativelyEqual(visited.solutions[i].x2(), solution.x2(), relativePrecision));
+      }
+      quiz_assert_print_if_failure(found, expression);
+    }
+  }
+  quiz_assert_print_if_failure(visited.numberOfSolutions == numberOfSolutions, expression);
+}
+
 Coordinate2D<double> R(double x) { return Coordinate2D<double>(x, 0.); }
 Coordinate2D<double> XY(double x, double y) { return Coordinate2D<double>(x, y); }
 
@@ -133,3 +175,38 @@ QUIZ_CASE(poincare_solver_intersections) {
   // TODO assert_intersections_are("x", "√(x)", -666., 666., { XY(0., 0.), XY(1., 1.) });
   // TODO assert_intersections_are("x^2-3x-2", "log(x^2-2x)", -8., 10., { XY(-0.609961198731614, 0.2019362602), XY(i-0.00516870705322244, -1.984467163), XY(2.00005000450738i, -3.999949993), XY(3.75110444134456, 0.8174712058) });
 }
+
+QUIZ_CASE(poincare_solver_roots_and_extrema) {
+  assert_roots_and_extrema_are_visited("cos(x)", -1., 500.);
+  assert_roots_and_extrema_are_visited("x^2-4", -5., 100.);
+  assert_roots_and_extrema_are_visited("x^2+2x+1", -10., 10.);
+  assert_roots_and_extrema_are_visited("x^3-3x", -10., 10.);
+  assert_roots_and_extrema_are_visited("csc(x)+tan(2×x)", -6., 6., Radian);
+  assert_roots_and_extrema_are_visited("5+4/sin(x)-2/tan(x)", 10., -10., Radian);
+  assert_roots_and_extrema_are_visited("tan(x)", -100., 100.);
+  assert_roots_and_extrema_are_visited("3", -1e28, 1e28);
+  assert_roots_and_extrema_are_visited("piecewise(-x,x<=0,x-1)", -10, 10);
+}
+
+static int s_numberOfEvaluations;
+
+QUIZ_CASE(poincare_solver_roots_and_extrema_evaluations) {
+  Solver<double>::FunctionEvaluation countedSine = [](double x, const void *) {
+    s_numberOfEvaluations++;
+    return std::sin(x);
+  };
+  s_numberOfEvaluations = 0;
+  Solver<double> rootSolver(-10., 10.);
+  while (std::isfinite(rootSolver.nextRoot(countedSine, nullptr).x1())) {}
+  int numberOfEvaluationsForRoots = s_numberOfEvaluations;
+
+  s_numberOfEvaluations = 0;
+  VisitedSolutions visited;
+  visited.numberOfSolutions = 0;
+  Solver<double> solver(-10., 10.);
+  solver.visitRootsAndExtrema(countedSine, nullptr, true, true, visit_solution, &visited);
+  quiz_assert(visited.numberOfSolutions == 7 + 6);
+  /* Searching the roots alone already sweeps the interval once: the extrema
+   * come at the cost of honing them. */
+  quiz_assert(2 * s_numberOfEvaluations < 3 * numberOfEvaluationsForRoots);
+}
@@ -1,17 +1,6 @@
 #include <poincare/helpers.h>
 #include "helper.h"
 
-static inline void assert_gcd_is(size_t a, size_t b, size_t g) {
-  quiz_assert(Poincare::Helpers::Gcd(a, b) == g);
-}
-
-QUIZ_CASE(poincare_helpers_gcd) {
-  assert_gcd_is(1, 1, 1);
-  assert_gcd_is(2, 3, 1);
-  assert_gcd_is(7, 5, 1);
-  assert_gcd_is(3, 9, 3);
-}
-
 QUIZ_CASE(poincare_helpers_insert_simple_swap) {
   constexpr size_t bufSize = 3;
   uint32_t buf[bufSize];
@@ -106,3 +95,91 @@ QUIZ_CASE(poincare_helpers_rotate) {
     }
   }
 }
+
+QUIZ_CASE(poincare_helpers_rotate_large_blocks) {
+  // Blocks longer than Rotate's buffer are rotated with reversals
+  constexpr size_t bufSize = 400;
+  uint32_t buf[bufSize];
+  for (size_t dst = 0; dst < bufSize; dst += 13) {
+    for (size_t src = 0; src < bufSize; src += 17) {
+      for (size_t len = 0; len < bufSize - src + 1; len += 29) {
+        for (size_t i = 0; i < bufSize; i++) {
+          buf[i] = (uint32_t) i;
+        }
+        test_rotate(buf, bufSize, dst, src, len);
+      }
+    }
+  }
+}
+
+struct SortTestElement {
+  int key;
+  int tag;
+};
+
+struct SortTestContext {
+  SortTestElement * elements;
+  bool lenientCompare;
+};
+
+static void swap_sort_test_elements(int i, int j, void * context, int numberOfElements) {
+  SortTestElement * elements = static_cast<SortTestContext *>(context)->elements;
+  SortTestElement t = elements[i];
+  elements[i] = elements[j];
+  elements[j] = t;
+}
+
+static bool compare_sort_test_elements(int i, int j, void * context, int numberOfElements) {
+  SortTestContext * c = static_cast<SortTestContext *>(context);
+  return c->lenientCompare ? c->elements[i].key >= c->elements[j].key : c->elements[i].key > c->elements[j].key;
+}
+
+static void assert_sort_matches_insertion_sort(SortTestElement * elements, int numberOfElements, bool lenientCompare) {
+  constexpr int maxNumberOfElements = 300;
+  assert(numberOfElements <= maxNumberOfElements);
+  // Sort a copy with the insertion sort Sort used to be
+  SortTestElement expected[maxNumberOfElements];
+  SortTestContext expectedContext = {expected, lenientCompare};
+  for (int i = 0; i < numberOfElements; i++) {
+    expected[i] = elements[i];
+  }
+  for (int i = 1; i < numberOfElements; i++) {
+    for (int j = i - 1; j >= 0 && !compare_sort_test_elements(j+1, j, &expectedContext, numberOfElements); j--) {
+      swap_sort_test_elements(j, j+1, &expectedContext, numberOfElements);
+    }
+  }
+  SortTestContext context = {elements, lenientCompare};
+  Poincare::Helpers::Sort(swap_sort_test_elements, compare_sort_test_elements, &context, numberOfElements);
+  for (int i = 0; i < numberOfElements; i++) {
+    quiz_assert(elements[i].key == expected[i].key && elements[i].tag == expected[i].tag);
+  }
+}
+
+QUIZ_CASE(poincare_helpers_sort) {
+  constexpr int numberOfSizes = 7;
+  constexpr int sizes[numberOfSizes] = {0, 1, 2, 15, 33, 100, 300};
+  constexpr int maxSize = 300;
+  SortTestElement elements[maxSize];
+  uint32_t seed = 1;
+  for (int s = 0; s < numberOfSizes; s++) {
+    int n = sizes[s];
+    for (int numberOfKeys : {3, 50, maxSize}) {
+      for (bool lenientCompare : {true, false}) {
+        // Pseudo-random keys, with many duplicates when numberOfKeys is small
+        for (int i = 0; i < n; i++) {
+          seed = seed * 1103515245 + 12345;
+          elements[i] = {static_cast<int>((seed >> 16) % numberOfKeys), i};
+        }
+        assert_sort_matches_insertion_sort(elements, n, lenientCompare);
+        // Sorted and reversed inputs
+        assert_sort_matches_insertion_sort(elements, n, lenientCompare);
+        for (int i = 0; i < n / 2; i++) {
+          SortTestElement t = elements[i];
+          elements[i] = elements[n - 1 - i];
+          elements[n - 1 - i] = t;
+        }
+        assert_sort_matches_insertion_sort(elements, n, lenientCompare);
+      }
+    }
+  }
+}
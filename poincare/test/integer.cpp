@@ -188,6 +188,7 @@ QUIZ_CASE(poincare_integer_divide) {
   assert_div_to(Integer("2305843009213693952"), Integer("2305843009213693921"), Integer("1"), Integer("31"));
   assert_div_to(MaxInteger(), MaxInteger(), Integer(1), Integer(0));
   assert_div_to(Integer("18446744073709551615"), Integer(10), Integer("1844674407370955161"), Integer(5));
+  assert_div_to(Integer("1000000000000000000000000000000000000000000000000000000000007"), Integer("18446744073709551615"), Integer("54210108624275221703311375920552804341370"), Integer("3929786791905187457"));
   assert_div_to(MaxInteger(), Integer(10), Integer("17976931348623159077293051907890247336179769789423065727343008115773267580550096313270847732240753602112011387987139335765878976881441662249284743063947412437776789342486548527630221960124609411945308295208500576883815068234246288147391311054082723716335051068458629823994724593847971630483535632962422413721"), Integer(5));
 }
 
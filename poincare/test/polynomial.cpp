@@ -68,3 +68,68 @@ QUIZ_CASE(poincare_polynomial_roots_cubic) {
   assert_roots_of_polynomial_are("x^3+x^2+x-39999999", {"3.416612ᴇ2", "-1.713306ᴇ2-2.961771ᴇ2×i", "-1.713306ᴇ2+2.961771ᴇ2×i"}, "-43199998400000016", Cartesian);
   assert_roots_of_polynomial_are("x^3+x^2+x+1-80*π*200000", {"3.687201ᴇ2", "-1.8486ᴇ2-3.196107ᴇ2×i", "-1.8486ᴇ2+3.196107ᴇ2×i"}, "-6912000000000000×π^2+640000000×π-16", Cartesian);
 }
+
+void assert_approximated_real_roots_are(const char * polynomial, std::initializer_list<double> roots) {
+  Shared::GlobalContext context;
+  Expression e = parse_expression(polynomial, &context, false).cloneAndReduce(ReductionContext(&context, Real, Radian, MetricUnitFormat, SystemForApproximation));
+  double coefficients[Polynomial::k_maxApproximatedDegree + 1];
+  int degree = Polynomial::ApproximateCoefficients(e, "x", coefficients, &context, Real, Radian);
+  quiz_assert_print_if_failure(degree >= 0, polynomial);
+  double approximatedRoots[Polynomial::k_maxApproximatedDegree];
+  int numberOfRoots = Polynomial::ApproximateRealRoots(coefficients, degree, approximatedRoots);
+  quiz_assert_print_if_failure(numberOfRoots == static_cast<int>(roots.size()), polynomial);
+  int i = 0;
+  for (double root : roots) {
+    quiz_assert_print_if_failure(roughly_equal(approximatedRoots[i++], root, 1e-9, false, 1e-12), polynomial);
+  }
+}
+
+QUIZ_CASE(poincare_polynomial_approximate_coefficients) {
+  Shared::GlobalContext context;
+  double coefficients[Polynomial::k_maxApproximatedDegree + 1];
+  Expression e = parse_expression("(x+1)^3×(2x-1)+x^2/4", &context, false).cloneAndReduce(ReductionContext(&context, Real, Radian, MetricUnitFormat, SystemForApproximation));
+  quiz_assert(Polynomial::ApproximateCoefficients(e, "x", coefficients, &context, Real, Radian) == 4);
+  const double expected[] = {-1., -1., 3.25, 5., 2.};
+  for (int i = 0; i <= 4; i++) {
+    assert_roughly_equal(coefficients[i], expected[i]);
+  }
+  e = parse_expression("x^2+cos(x)", &context, false).cloneAndReduce(ReductionContext(&context, Real, Radian, MetricUnitFormat, SystemForApproximation));
+  quiz_assert(Polynomial::ApproximateCoefficients(e, "x", coefficients, &context, Real, Radian) == -1);
+  e = parse_expression("x^17+1", &context, false).cloneAndReduce(ReductionContext(&context, Real, Radian, MetricUnitFormat, SystemForApproximation));
+  quiz_assert(Polynomial::ApproximateCoefficients(e, "x", coefficients, &context, Real, Radian) == -1);
+}
+
+QUIZ_CASE(poincare_polynomial_approximate_roots) {
+  // Complex roots
+  const double coefficients[] = {1., 0., 0., 0., 1.};
+  std::complex<double> roots[4];
+  quiz_assert(Polynomial::ApproximateRoots(coefficients, 4, roots));
+  for (std::complex<double> root : roots) {
+    assert_roughly_equal(std::abs(root), 1., 1e-14);
+    assert_roughly_equal(std::fabs(root.real()), M_SQRT1_2, 1e-14);
+  }
+
+  // Real roots
+  assert_approximated_real_roots_are("x^4-5x^2+4", {-2., -1., 1., 2.});
+  assert_approximated_real_roots_are("x^8-36x^7+546x^6-4536x^5+22449x^4-67284x^3+118124x^2-109584x+40320", {1., 2., 3., 4., 5., 6., 7., 8.});
+  {
+    // Perturbed Wilkinson polynomial, whose roots are close to each other
+    Shared::GlobalContext context;
+    Expression e = parse_expression("x^8-36x^7+546x^6-4536x^5+22449x^4-67284x^3+118123x^2-109584x+40320", &context, false).cloneAndReduce(ReductionContext(&context, Real, Radian, MetricUnitFormat, SystemForApproximation));
+    double coefficients[Polynomial::k_maxApproximatedDegree + 1];
+    double roots[Polynomial::k_maxApproximatedDegree];
+    int degree = Polynomial::ApproximateCoefficients(e, "x", coefficients, &context, Real, Radian);
+    quiz_assert(Polynomial::ApproximateRealRoots(coefficients, degree, roots) == 8);
+  }
+  assert_approximated_real_roots_are("x^8+x^2+1", {});
+  assert_approximated_real_roots_are("x^3×(x^4-16)", {-2., 0., 2.});
+  assert_approximated_real_roots_are("(x+1)^5-x^5", {});
+  assert_approximated_real_roots_are("(x^2+1)(x-0.1)(x-0.1001)(x-3)", {0.1, 0.1001, 3.});
+  // Multiple roots are counted once
+  assert_approximated_real_roots_are("(x-1)^2×(x+1)^2", {-1., 1.});
+  assert_approximated_real_roots_are("(x-10)^7", {10.});
+  assert_approximated_real_roots_are("(x^2-2)^3×(x^2+1)^2", {-M_SQRT2, M_SQRT2});
+  // Nearly real complex conjugate roots are not real
+  assert_approximated_real_roots_are("(x^2+1ᴇ-14)(x-3)", {3.});
+  assert_approximated_real_roots_are("((x-1)^2+1ᴇ-10)×(x+2)^2", {-2.});
+}
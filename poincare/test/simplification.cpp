@@ -1,5 +1,7 @@
+#include <apps/shared/global_context.h>
 #include <ion/storage/file_system.h>
 #include <poincare/constant.h>
+#include <poincare/exception_checkpoint.h>
 #include <poincare/function.h>
 #include <poincare/infinity.h>
 #include <poincare/rational.h>
@@ -713,9 +715,7 @@ QUIZ_CASE(poincare_simplification_power) {
   assert_parsed_expression_simplify_to("10^log(1.23)", "123/100");
   assert_parsed_expression_simplify_to("2^log(3,2)", "3");
   assert_parsed_expression_simplify_to("1881676377434183981909562699940347954480361860897069^(1/3)", "1.2345678912346ᴇ17");
-  /* This does not reduce but should not as the prime decomposition involves
-   * factors above k_maxNumberOfPrimeFactors. */
-  assert_parsed_expression_simplify_to("1002101470343^(1/3)", "root(1002101470343,3)");
+  assert_parsed_expression_simplify_to("1002101470343^(1/3)", "10007");
   assert_parsed_expression_simplify_to("π×π×π", "π^3");
   assert_parsed_expression_simplify_to("(x+π)^(3)", "x^3+3×π×x^2+3×π^2×x+π^3");
   assert_parsed_expression_simplify_to("(5+√(2))^(-8)", "\u00121446241-1003320×√(2)\u0013/78310985281");
@@ -819,9 +819,7 @@ QUIZ_CASE(poincare_simplification_logarithm) {
   assert_parsed_expression_simplify_to("log((23π)^4,23π)", "4");
   assert_parsed_expression_simplify_to("log(10^(2+π))", "π+2");
   assert_parsed_expression_simplify_to("ln(1881676377434183981909562699940347954480361860897069)", "ln(1.8816763774342ᴇ51)");
-  /* log(1002101470343) does no reduce to 3×log(10007) because it involves
-   * prime factors above k_biggestPrimeFactor */
-  assert_parsed_expression_simplify_to("log(1002101470343)", "log(1002101470343)");
+  assert_parsed_expression_simplify_to("log(1002101470343)", "3×log(10007)");
   assert_parsed_expression_simplify_to("log(64,2)", "6");
   assert_parsed_expression_simplify_to("log(2,64)", "log(2,64)");
   assert_parsed_expression_simplify_to("log(1476225,5)", "10×log(3,5)+2");
@@ -890,7 +888,10 @@ QUIZ_CASE(poincare_simplification_function) {
   assert_parsed_expression_simplify_to("factor(-10008/6895)", "-\u00122^3×3^2×139\u0013/\u00125×7×197\u0013");
   assert_parsed_expression_simplify_to("factor(1008/6895)", "\u00122^4×3^2\u0013/\u00125×197\u0013");
   assert_parsed_expression_simplify_to("factor(10007)", "10007");
-  assert_parsed_expression_simplify_to("factor(10007^2)", Undefined::Name());
+  assert_parsed_expression_simplify_to("factor(10007^2)", "10007^2");
+  assert_parsed_expression_simplify_to("factor(12000000097000000133)", "3000000019×4000000007");
+  assert_parsed_expression_simplify_to("factor(10000000000000000051)", "10000000000000000051");
+  assert_parsed_expression_simplify_to("factor(3000000019×4000000007×9999999943×9999999967)", "3000000019×4000000007×9999999943×9999999967");
   assert_parsed_expression_simplify_to("factor(i)", Undefined::Name());
   assert_parsed_expression_simplify_to("floor(-1.3)", "-2");
   assert_parsed_expression_simplify_to("floor(2π)", "6");
@@ -1217,6 +1218,9 @@ QUIZ_CASE(poincare_simplification_matrix) {
   assert_parsed_expression_simplify_to("det([[1,2,3][4,5,6][7,8,9]])", "0");
   assert_parsed_expression_simplify_to("det([[1,2,3][4π,5,6][7,8,9]])", "24×π-24");
   assert_parsed_expression_simplify_to("det(identity(5))", "1");
+  assert_parsed_expression_simplify_to("det([[-65,46,96,-83,-34][-69,27,95,16,21][67,-2,-46,-75,25][-92,0,11,56,96][97,-99,79,15,-31]])", "8009235113");
+  assert_parsed_expression_simplify_to("det([[1,1/2,1/3,1/4][1/2,1/3,1/4,1/5][1/3,1/4,1/5,1/6][1/4,1/5,1/6,1/7]])", "1/6048000");
+  assert_parsed_expression_simplify_to("det([[1,2,3,4][0,1,0,1][2,5,6,9][7,3,1,0]])", "0");
 
   // Dimension
   assert_parsed_expression_simplify_to("dim(3)", Undefined::Name());
@@ -1226,6 +1230,8 @@ QUIZ_CASE(poincare_simplification_matrix) {
   assert_parsed_expression_simplify_to("inverse([[1/√(2),1/2,3][2,1,-3]])", Undefined::Name());
   assert_parsed_expression_simplify_to("inverse([[1,2][3,4]])", "[[-2,1][3/2,-1/2]]");
   assert_parsed_expression_simplify_to("inverse([[π,2×π][3,2]])", "[[-1/\u00122×π\u0013,1/2][3/\u00124×π\u0013,-1/4]]");
+  assert_parsed_expression_simplify_to("inverse([[1,1/2,1/3,1/4][1/2,1/3,1/4,1/5][1/3,1/4,1/5,1/6][1/4,1/5,1/6,1/7]])", "[[16,-120,240,-140][-120,1200,-2700,1680][240,-2700,6480,-4200][-140,1680,-4200,2800]]");
+  assert_parsed_expression_simplify_to("inverse([[1,2,3,4][0,1,0,1][2,5,6,9][7,3,1,0]])", Undefined::Name());
 
   // Divison : should be undefined
   assert_parsed_expression_simplify_to("[[1,2][3,4]]/[[1,2][-2,3]]", Undefined::Name());
@@ -1854,6 +1860,48 @@ QUIZ_CASE(poincare_simplification_system_circuit_breaker_handled) {
   assert_parsed_expression_simplify_to("(π+i)^√(i×(i+2))", "(π+i)^√(2×i-1)");
   // Multiplication overflows --> don't reduce
   assert_parsed_expression_simplify_to("20^23×20^23×20^23×20^23×20^23×20^23×25^23×20^23×20^23×20^23×20^23×20^23×20^23×25^23", "20^23×20^23×20^23×20^23×20^23×20^23×25^23×20^23×20^23×20^23×20^23×20^23×20^23×25^23");
+  // Too many reduction steps --> don't reduce
+  assert_parsed_expression_simplify_to("[[1,2,3,4,5][6,7,8,9,10][1,3,5,7,9][2,4,6,8,1][5,4,3,2,2]]^100", "[[1,2,3,4,5][6,7,8,9,10][1,3,5,7,9][2,4,6,8,1][5,4,3,2,2]]^100");
+}
+
+QUIZ_CASE(poincare_simplification_reduction_step_budget_rollback) {
+#if !__EMSCRIPTEN__
+  // A jump out of a reduction must not leave its budget armed
+  {
+    ExceptionCheckpoint ecp;
+    if (ExceptionRun(ecp)) {
+      Expression::SetReductionStepBudget(0);
+      ExceptionCheckpoint::Raise();
+    }
+  }
+  quiz_assert(Expression::ReductionStepBudget() < 0);
+  assert_parsed_expression_simplify_to("1+1", "2");
+#endif
+}
+
+QUIZ_CASE(poincare_simplification_reduction_step_budget_nested) {
+#if !__EMSCRIPTEN__
+  Shared::GlobalContext context;
+  Expression e = parse_expression("1+2+3+4", &context, false);
+  bool nestedReduceFailure = false;
+  bool ownerCaughtException = false;
+  {
+    ExceptionCheckpoint ecp;
+    if (ExceptionRun(ecp)) {
+      // The outermost reduction owns the budget
+      Expression::SetReductionStepBudget(1);
+      ReductionContext reductionContext(&context, Cartesian, Radian, MetricUnitFormat, User);
+      e.cloneAndDeepReduceWithSystemCheckpoint(&reductionContext, &nestedReduceFailure);
+      // The nested reduction does not refund the steps it used
+      quiz_assert(Expression::ReductionStepBudget() == 0);
+      ExceptionCheckpoint::Raise();
+    } else {
+      ownerCaughtException = true;
+    }
+  }
+  quiz_assert(nestedReduceFailure && ownerCaughtException);
+  quiz_assert(Expression::ReductionStepBudget() < 0);
+#endif
 }
 
 QUIZ_CASE(poincare_simplification_list) {
@@ -1920,6 +1968,7 @@ QUIZ_CASE(poincare_simplification_list) {
   assert_parsed_expression_simplify_to("sort({1})", "{1}");
   assert_parsed_expression_simplify_to("sort({3,2,1})", "{1,2,3}");
   assert_parsed_expression_simplify_to("sort({undef,-1,-2,-inf,inf})", "{-∞,-2,-1,∞,undef}");
+  assert_parsed_expression_simplify_to("sort({5,3,9,3,1,8,2,7,5,0,6,4,9,1,2,8,0,7})", "{0,0,1,1,2,2,3,3,4,5,5,6,7,7,8,8,9,9}");
   // Mean of a list
   assert_parsed_expression_simplify_to("mean({})", Undefined::Name());
   assert_parsed_expression_simplify_to("mean({1,2,3})", "2");
@@ -1970,6 +2019,7 @@ QUIZ_CASE(poincare_simplification_list) {
   assert_parsed_expression_simplify_to("med({1,x,2,3})","med({1,x,2,3})");
   assert_parsed_expression_simplify_to("med({1,6,3,4,5,2},{1,2,1,1,2,2})", "4");
   assert_parsed_expression_simplify_to("med({1,6,3},{1,1,undef})", "undef");
+  assert_parsed_expression_simplify_to("med({1,2,3},{-1,2,2})", "undef");
   // Do not reduce if a child can't be approximated
   assert_parsed_expression_simplify_to("med({1,6,3},{1,1,x})", "med({1,6,3},{1,1,x})");
   // List sequences
@@ -1,5 +1,6 @@
 #include <quiz.h>
 #include <poincare/tree_handle.h>
+#include <poincare/tree_pool.h>
 #include <poincare/init.h>
 #include <poincare/exception_checkpoint.h>
 #include "blob_node.h"
@@ -87,6 +88,27 @@ QUIZ_CASE(tree_handle_memory_failure) {
 #endif
 }
 
+QUIZ_CASE(tree_handle_pool_statistics) {
+#if POINCARE_TREE_POOL_STATISTICS && !__EMSCRIPTEN__
+  // See tree_handle_memory_failure for the web simulator
+  TreePool::Statistics initialStatistics = TreePool::sharedPool()->statistics();
+  char * initialCursor = TreePool::sharedPool()->cursor();
+  char * cursorBeforeFailure = initialCursor;
+  Poincare::ExceptionCheckpoint ecp;
+  if (ExceptionRun(ecp)) {
+    TreeHandle tree = BlobByReference::Builder(1);
+    while (true) {
+      cursorBeforeFailure = TreePool::sharedPool()->cursor();
+      tree = PairByReference::Builder(tree, BlobByReference::Builder(1));
+    }
+  }
+  const TreePool::Statistics & statistics = TreePool::sharedPool()->statistics();
+  quiz_assert(statistics.numberOfOverflows == initialStatistics.numberOfOverflows + 1);
+  quiz_assert(statistics.numberOfRollbacks == initialStatistics.numberOfRollbacks + 1);
+  quiz_assert(statistics.peakOccupancy >= static_cast<size_t>(cursorBeforeFailure - initialCursor));
+#endif
+}
+
 QUIZ_CASE(tree_handle_does_not_copy) {
   int initialPoolSize = pool_size();
   BlobByReference b1 = BlobByReference::Builder(1);
@@ -16,8 +16,11 @@ class ZoomTest {
 public:
   ZoomTest(Range1D bounds, Context * context) : m_zoom(bounds.min(), bounds.max(), k_normalRatio, context, Range1D::k_maxFloat) {}
 
+  constexpr static size_t k_sampleSize = Zoom::k_sampleSize;
+
   Zoom * zoom() { return &m_zoom; }
   Range2D interestingRange() const { return m_zoom.m_interestingRange; }
+  Range2D magnitudeRange() const { return m_zoom.m_magnitudeRange; }
 
 private:
   Zoom m_zoom;
@@ -51,12 +54,31 @@ template <typename T> Coordinate2D<T> expressionEvaluator(T t, const void * mode
   return Coordinate2D<T>(t, e->approximateWithValueForSymbol(k_symbol, t, context, Real, Radian));
 }
 
+static int s_numberOfEvaluations = 0;
+
+Coordinate2D<float> countingEvaluator(float t, const void * model, Context * context) {
+  s_numberOfEvaluations++;
+  return expressionEvaluator<float>(t, model, context);
+}
+
 void assert_full_function_range_is(const char * expression, Range1D bounds, Range2D expectedRange) {
   Shared::GlobalContext context;
   Expression e = parse_expression(expression, &context, false);
   ZoomTest zoom(bounds, &context);
-  zoom.zoom()->fitFullFunction(expressionEvaluator<float>, &e);
+  s_numberOfEvaluations = 0;
+  zoom.zoom()->fitFullFunction(countingEvaluator, &e);
   assert_ranges_equal(zoom.interestingRange(), expectedRange, expression);
+  // The sampling is never denser than k_sampleSize uniform samples
+  quiz_assert_print_if_failure(s_numberOfEvaluations <= static_cast<int>(ZoomTest::k_sampleSize) + 1, expression);
+}
+
+void assert_full_function_is_sampled_less_than(const char * expression, Range1D bounds, int maxNumberOfEvaluations) {
+  Shared::GlobalContext context;
+  Expression e = parse_expression(expression, &context, false);
+  ZoomTest zoom(bounds, &context);
+  s_numberOfEvaluations = 0;
+  zoom.zoom()->fitFullFunction(countingEvaluator, &e);
+  quiz_assert_print_if_failure(s_numberOfEvaluations < maxNumberOfEvaluations, expression);
 }
 
 QUIZ_CASE(poincare_zoom_fit_full_function) {
@@ -67,6 +89,33 @@ QUIZ_CASE(poincare_zoom_fit_full_function) {
   assert_full_function_range_is("[[cos(x)][sin(x)]]", Range1D(0, 2 * M_PI), Range2D(-1, 1, -1, 1));
   assert_full_function_range_is("[[-x^2+1][-2x]]", Range1D(0, 1), Range2D(0, 1, -2, 0));
   assert_full_function_range_is("[[acos(x)][asin(x)]]", Range1D(0, 1), Range2D(0, M_PI/2, 0, M_PI/2));
+
+  // Straight parts of the curve are not refined
+  constexpr int k_sampleSize = ZoomTest::k_sampleSize;
+  assert_full_function_is_sampled_less_than("1", Range1D(-10, 10), k_sampleSize / 4);
+  assert_full_function_is_sampled_less_than("x", Range1D(-10, 10), k_sampleSize / 4);
+  assert_full_function_is_sampled_less_than("e^x", Range1D(-10, 10), k_sampleSize / 2);
+  assert_full_function_is_sampled_less_than("1+1/x", Range1D(0.1, 2), k_sampleSize / 2);
+  assert_full_function_is_sampled_less_than("[[-x^2+1][-2x]]", Range1D(0, 1), k_sampleSize / 2);
+}
+
+void assert_magnitude_range_is(const char * expression, Range1D expectedRange, int maxNumberOfEvaluations) {
+  Shared::GlobalContext context;
+  Expression e = parse_expression(expression, &context, false);
+  ZoomTest zoom(Range1D(-k_maxFloat, k_maxFloat), &context);
+  s_numberOfEvaluations = 0;
+  zoom.zoom()->fitMagnitude(countingEvaluator, &e);
+  assert_ranges_equal(*zoom.magnitudeRange().y(), expectedRange, expression);
+  quiz_assert_print_if_failure(s_numberOfEvaluations < maxNumberOfEvaluations, expression);
+}
+
+QUIZ_CASE(poincare_zoom_fit_magnitude) {
+  constexpr int k_sampleSize = ZoomTest::k_sampleSize;
+  assert_magnitude_range_is("1", Range1D(1, 1), k_sampleSize / 4);
+  assert_magnitude_range_is("x", Range1D(-10, 10), k_sampleSize / 4);
+  assert_magnitude_range_is("-2x+1", Range1D(-19, 21), k_sampleSize / 4);
+  assert_magnitude_range_is("e^x", Range1D(std::exp(-10.f), 15.76), k_sampleSize / 2);
+  assert_magnitude_range_is("x^2", Range1D(0, 38.52), k_sampleSize / 4);
 }
 
 void assert_points_of_interest_range_is(const char * expression, Range2D expectedRange) {
@@ -5,6 +5,7 @@
 #include <poincare/tree_pool.h>
 #include <poincare/exception_checkpoint.h>
 #include <poincare/print.h>
+#include <poincare/reduction_profiler.h>
 
 void quiz_print(const char * message) {
   Ion::Console::writeLine(message);
@@ -80,6 +81,9 @@ void ion_main(int argc, const char * const argv[]) {
   Poincare::Init(); // Initialize Poincare::TreePool::sharedPool
   const char * testFilter = nullptr;
   sSkipAssertions = false;
+#if POINCARE_TREE_POOL_STATISTICS
+  bool logPoolStatistics = false;
+#endif
 #if !PLATFORM_DEVICE
   for (int i=1; i<argc; i++) {
     if (strcmp(argv[i], "--filter") == 0) {
@@ -88,6 +92,16 @@ void ion_main(int argc, const char * const argv[]) {
     } else if (strcmp(argv[i], "--skip-assertions") == 0) {
       sSkipAssertions = true;
     }
+#if POINCARE_REDUCTION_PROFILER
+    else if (strcmp(argv[i], "--reduction-profile") == 0) {
+      Poincare::ReductionProfiler::Start();
+    }
+#endif
+#if POINCARE_TREE_POOL_STATISTICS
+    else if (strcmp(argv[i], "--pool-statistics") == 0) {
+      logPoolStatistics = true;
+    }
+#endif
   }
   /* s_stackStart must be defined as early as possible to ensure that there
    * cannot be allocated memory pointers before. Otherwise, with MicroPython for
@@ -99,6 +113,16 @@ void ion_main(int argc, const char * const argv[]) {
   Poincare::ExceptionCheckpoint ecp;
   if (ExceptionRun(ecp)) {
     ion_main_inner(testFilter);
+#if POINCARE_REDUCTION_PROFILER
+    if (Poincare::ReductionProfiler::IsRunning()) {
+      Poincare::ReductionProfiler::Log();
+    }
+#endif
+#if POINCARE_TREE_POOL_STATISTICS
+    if (logPoolStatistics) {
+      Poincare::TreePool::sharedPool()->logStatistics();
+    }
+#endif
   } else {
     // There has been a memory allocation problem
 #if POINCARE_TREE_LOG